@@ -16,7 +16,9 @@ public class BlueprintExporter : ModuleRules
 			"KismetCompiler",
 			"Json",
 			"JsonUtilities",
-			"HTTPServer"
+			"HTTPServer",
+			"Slate",
+			"SlateCore"
 		});
 	}
 }
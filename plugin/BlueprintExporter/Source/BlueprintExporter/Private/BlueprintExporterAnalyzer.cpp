@@ -0,0 +1,589 @@
+#include "BlueprintExporterAnalyzer.h"
+#include "BlueprintExporterUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node.h"
+#include "K2Node_FunctionEntry.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Misc/FileHelper.h"
+
+// Assumed iteration count for loop macro bodies
+static const double LOOP_ITERATIONS = 10.0;
+
+// Weight for entries that run every frame (one second at 60 fps)
+static const double TICK_WEIGHT = 60.0;
+
+static const TCHAR* TickEvents[] =
+{
+	TEXT("ReceiveTick"),
+	TEXT("Tick"),
+	TEXT("BlueprintUpdateAnimation"),
+};
+
+static const TCHAR* LoopMacros[] =
+{
+	TEXT("ForEachLoop"),
+	TEXT("ForEachLoopWithBreak"),
+	TEXT("ReverseForEachLoop"),
+	TEXT("ForLoop"),
+	TEXT("ForLoopWithBreak"),
+	TEXT("WhileLoop"),
+};
+
+// World queries that walk every actor or widget
+static const TCHAR* GetAllActorsFunctions[] =
+{
+	TEXT("GetAllActorsOfClass"),
+	TEXT("GetAllActorsOfClassWithTag"),
+	TEXT("GetAllActorsWithTag"),
+	TEXT("GetAllActorsWithInterface"),
+	TEXT("GetActorOfClass"),
+	TEXT("GetAllWidgetsOfClass"),
+	TEXT("GetAllWidgetsWithInterface"),
+};
+
+// Prefixes of other calls that cost far more than an ordinary native call
+static const TCHAR* ExpensiveFunctionPrefixes[] =
+{
+	TEXT("LineTrace"),
+	TEXT("SphereTrace"),
+	TEXT("BoxTrace"),
+	TEXT("CapsuleTrace"),
+	TEXT("SphereOverlap"),
+	TEXT("BoxOverlap"),
+	TEXT("CapsuleOverlap"),
+	TEXT("ComponentOverlap"),
+	TEXT("GetComponentsByClass"),
+	TEXT("K2_GetComponentsByClass"),
+	TEXT("GetComponentsByTag"),
+	TEXT("FindPath"),
+};
+
+// Node classes that allocate every time they run
+static const TCHAR* AllocatingNodeClasses[] =
+{
+	TEXT("K2Node_SpawnActorFromClass"),
+	TEXT("K2Node_CreateWidget"),
+	TEXT("K2Node_GenericCreateObject"),
+	TEXT("K2Node_ConstructObjectFromClass"),
+	TEXT("K2Node_MakeArray"),
+	TEXT("K2Node_MakeMap"),
+	TEXT("K2Node_MakeSet"),
+	TEXT("K2Node_FormatText"),
+};
+
+// Prefixes of library calls that allocate strings, text or objects
+static const TCHAR* AllocatingFunctionPrefixes[] =
+{
+	TEXT("Concat_"),
+	TEXT("BuildString_"),
+	TEXT("Format"),
+	TEXT("Join"),
+	TEXT("SpawnEmitter"),
+	TEXT("SpawnSound"),
+	TEXT("SpawnSystem"),
+	TEXT("SpawnDecal"),
+	TEXT("BeginDeferredActorSpawnFromClass"),
+};
+
+template <int32 N>
+static bool IsOneOf(const FString& Value, const TCHAR* (&Candidates)[N])
+{
+	for (const TCHAR* Candidate : Candidates)
+	{
+		if (Value.Equals(Candidate))
+			return true;
+	}
+	return false;
+}
+
+template <int32 N>
+static bool StartsWithAny(const FString& Value, const TCHAR* (&Prefixes)[N])
+{
+	for (const TCHAR* Prefix : Prefixes)
+	{
+		if (Value.StartsWith(Prefix, ESearchCase::CaseSensitive))
+			return true;
+	}
+	return false;
+}
+
+static bool IsLoopMacro(const FBlueprintAnalysisNode& Node)
+{
+	return Node.NodeType == MACRO_NODE_TYPE && IsOneOf(Node.MacroName, LoopMacros);
+}
+
+static bool IsGetAllActorsCall(const FBlueprintAnalysisNode& Node)
+{
+	return Node.NodeType == TEXT("CallFunction") && IsOneOf(Node.FunctionName, GetAllActorsFunctions);
+}
+
+static bool IsExpensiveCall(const FBlueprintAnalysisNode& Node)
+{
+	return IsGetAllActorsCall(Node) || (Node.NodeType == TEXT("CallFunction") && StartsWithAny(Node.FunctionName, ExpensiveFunctionPrefixes));
+}
+
+static bool IsAllocatingNode(const FBlueprintAnalysisNode& Node)
+{
+	if (IsOneOf(Node.ClassName, AllocatingNodeClasses))
+		return true;
+
+	if (Node.NodeType != TEXT("CallFunction"))
+		return false;
+
+	// Conv_IntToString, Conv_FloatToText and friends build a new string every call
+	if (Node.FunctionName.StartsWith(TEXT("Conv_")) && (Node.FunctionName.EndsWith(TEXT("ToString")) || Node.FunctionName.EndsWith(TEXT("ToText"))))
+		return true;
+
+	return StartsWithAny(Node.FunctionName, AllocatingFunctionPrefixes);
+}
+
+static double GetNodeCost(const FBlueprintAnalysisNode& Node)
+{
+	if (Node.ClassName == TEXT("K2Node_Knot"))
+		return 0.0;
+	if (IsExpensiveCall(Node))
+		return 100.0;
+	if (IsAllocatingNode(Node))
+		return 50.0;
+	if (Node.NodeType == TEXT("CallFunction"))
+		return 10.0;
+	if (Node.NodeType == TEXT("Cast"))
+		return 5.0;
+	if (Node.NodeType == MACRO_NODE_TYPE)
+		return 5.0;
+	if (Node.NodeType == TEXT("Branch"))
+		return 2.0;
+	if (Node.NodeType == TEXT("VariableGet") || Node.NodeType == TEXT("VariableSet"))
+		return 1.0;
+	return 3.0;
+}
+
+void FBlueprintExporterAnalyzer::SnapshotBlueprints(const FString& Filter, TArray<FBlueprintAnalysisSnapshot>& OutSnapshots)
+{
+	check(IsInGameThread());
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	TArray<FAssetData> AssetList;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetList, true);
+
+	for (const FAssetData& Asset : AssetList)
+	{
+		const FString PackageName = Asset.PackageName.ToString();
+		if (!PackageName.StartsWith(TEXT("/Game/")))
+			continue;
+		if (!Filter.IsEmpty() && !PackageName.Contains(Filter))
+			continue;
+
+		const UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset());
+		if (!Blueprint)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Could not load blueprint at %s"), *PackageName);
+			continue;
+		}
+
+		SnapshotBlueprint(Blueprint, OutSnapshots.AddDefaulted_GetRef());
+	}
+}
+
+static void SnapshotGraph(const UEdGraph* Graph, const TCHAR* GraphType, FBlueprintAnalysisGraph& OutGraph)
+{
+	OutGraph.Name = Graph->GetName();
+	OutGraph.Type = GraphType;
+
+	// Disabled nodes never run, so they are left out along with their links
+	TMap<const UEdGraphNode*, int32> NodeIndices;
+	TArray<const UEdGraphNode*> Nodes;
+	for (const UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (Node && Node->IsNodeEnabled())
+			NodeIndices.Add(Node, Nodes.Add(Node));
+	}
+
+	OutGraph.Nodes.SetNum(Nodes.Num());
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
+	{
+		const UEdGraphNode* Node = Nodes[NodeIndex];
+		FBlueprintAnalysisNode& NodeData = OutGraph.Nodes[NodeIndex];
+
+		const FBlueprintNodeInfo Info = DescribeBlueprintNode(Node);
+		NodeData.Title = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+		NodeData.ClassName = Node->GetClass()->GetName();
+		NodeData.NodeType = Info.NodeType;
+		NodeData.FunctionName = Info.FunctionName;
+		NodeData.MacroName = Info.MacroName;
+
+		if (const UK2Node* K2Node = Cast<UK2Node>(Node))
+			NodeData.bPure = K2Node->IsNodePure();
+
+		if (IsGraphEntryNode(Node))
+		{
+			NodeData.bEntry = true;
+			// Custom events are named by DescribeBlueprintNode too; anything still unnamed goes by its title
+			NodeData.EntryName = Node->IsA<UK2Node_FunctionEntry>() ? Graph->GetName() : Info.EventName;
+			if (NodeData.EntryName.IsEmpty() || NodeData.EntryName == TEXT("None"))
+				NodeData.EntryName = NodeData.Title;
+		}
+
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin)
+				continue;
+
+			const bool bExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const int32* LinkedIndex = LinkedPin ? NodeIndices.Find(LinkedPin->GetOwningNode()) : nullptr;
+				if (!LinkedIndex)
+					continue;
+
+				if (bExecPin && Pin->Direction == EGPD_Output)
+					NodeData.ExecOutputs.Emplace(Pin->PinName, *LinkedIndex);
+				else if (!bExecPin && Pin->Direction == EGPD_Input)
+					NodeData.DataInputs.AddUnique(*LinkedIndex);
+			}
+		}
+	}
+}
+
+void FBlueprintExporterAnalyzer::SnapshotBlueprint(const UBlueprint* Blueprint, FBlueprintAnalysisSnapshot& OutSnapshot)
+{
+	OutSnapshot.BlueprintPath = Blueprint->GetOutermost()->GetName();
+	if (Blueprint->ParentClass)
+		OutSnapshot.ParentClass = Blueprint->ParentClass->GetName();
+
+	for (const UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		if (Graph)
+			SnapshotGraph(Graph, TEXT("EventGraph"), OutSnapshot.Graphs.AddDefaulted_GetRef());
+	}
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (Graph)
+			SnapshotGraph(Graph, TEXT("FunctionGraph"), OutSnapshot.Graphs.AddDefaulted_GetRef());
+	}
+}
+
+// Walks everything one entry node runs, accumulating cost and issues
+class FEntryCostWalker
+{
+public:
+	FEntryCostWalker(const FBlueprintAnalysisGraph& InGraph, const TSet<FString>& InLocalFunctions, FBlueprintAnalysisEntry& InEntry, TArray<FBlueprintAnalysisIssue>& InIssues)
+		: Graph(InGraph)
+		, LocalFunctions(InLocalFunctions)
+		, Entry(InEntry)
+		, Issues(InIssues)
+	{
+	}
+
+	void Walk(int32 EntryNode)
+	{
+		struct FPending
+		{
+			int32 Node;
+			double Multiplier;
+			bool bInLoop;
+			bool bFromCastFailed;
+		};
+
+		TSet<int32> ExecVisited;
+		TArray<FPending> Stack;
+		Stack.Add({ EntryNode, 1.0, false, false });
+
+		while (Stack.Num() > 0)
+		{
+			const FPending Item = Stack.Pop(false);
+
+			bool bAlreadyVisited = false;
+			ExecVisited.Add(Item.Node, &bAlreadyVisited);
+			if (bAlreadyVisited)
+				continue;
+
+			const FBlueprintAnalysisNode& Node = Graph.Nodes[Item.Node];
+			VisitNode(Node, Item.Multiplier, Item.bInLoop);
+			VisitPureInputs(Node, Item.Multiplier, Item.bInLoop);
+
+			// Chains are reported once, from the cast that starts them
+			const bool bCast = Node.NodeType == TEXT("Cast");
+			if (bCast && !Item.bFromCastFailed)
+				CheckCastChain(Item.Node);
+
+			const bool bLoop = IsLoopMacro(Node);
+			for (const TPair<FName, int32>& ExecOutput : Node.ExecOutputs)
+			{
+				const bool bLoopBody = bLoop && ExecOutput.Key == TEXT("LoopBody");
+				const bool bCastFailed = bCast && ExecOutput.Key == UEdGraphSchema_K2::PN_CastFailed;
+				Stack.Add({ ExecOutput.Value, bLoopBody ? Item.Multiplier * LOOP_ITERATIONS : Item.Multiplier, Item.bInLoop || bLoopBody, bCastFailed });
+			}
+		}
+	}
+
+private:
+	// Pure nodes run again for every exec node that reads them, so they are costed per consumer
+	void VisitPureInputs(const FBlueprintAnalysisNode& Consumer, double Multiplier, bool bInLoop)
+	{
+		TSet<int32> PureVisited;
+		TArray<int32> Stack = Consumer.DataInputs;
+
+		while (Stack.Num() > 0)
+		{
+			const int32 NodeIndex = Stack.Pop(false);
+			const FBlueprintAnalysisNode& Node = Graph.Nodes[NodeIndex];
+			if (!Node.bPure)
+				continue;
+
+			bool bAlreadyVisited = false;
+			PureVisited.Add(NodeIndex, &bAlreadyVisited);
+			if (bAlreadyVisited)
+				continue;
+
+			VisitNode(Node, Multiplier, bInLoop);
+			Stack.Append(Node.DataInputs);
+		}
+	}
+
+	void VisitNode(const FBlueprintAnalysisNode& Node, double Multiplier, bool bInLoop)
+	{
+		Entry.NodeCount++;
+		Entry.EstimatedCost += GetNodeCost(Node) * Multiplier;
+
+		if (Node.NodeType == TEXT("CallFunction") && LocalFunctions.Contains(Node.FunctionName))
+			Entry.LocalCalls.Add(Node.FunctionName);
+
+		const FString& Detail = Node.FunctionName.IsEmpty() ? Node.ClassName : Node.FunctionName;
+
+		if (IsGetAllActorsCall(Node))
+			AddIssue(TEXT("get_all_actors"), Node, Detail);
+
+		if (IsExpensiveCall(Node) && bInLoop)
+			AddIssue(TEXT("expensive_call_in_loop"), Node, Detail);
+
+		if (IsAllocatingNode(Node) && (Entry.bOnTick || bInLoop))
+			AddIssue(Entry.bOnTick ? TEXT("per_frame_allocation") : TEXT("allocation_in_loop"), Node, Detail);
+	}
+
+	// A cast whose failure path falls through to another cast, typically a chain of type checks
+	void CheckCastChain(int32 CastNode)
+	{
+		int32 ChainLength = 1;
+		int32 Current = CastNode;
+		TSet<int32> Seen;
+		Seen.Add(Current);
+
+		for (;;)
+		{
+			int32 Next = INDEX_NONE;
+			for (const TPair<FName, int32>& ExecOutput : Graph.Nodes[Current].ExecOutputs)
+			{
+				if (ExecOutput.Key == UEdGraphSchema_K2::PN_CastFailed && Graph.Nodes[ExecOutput.Value].NodeType == TEXT("Cast"))
+					Next = ExecOutput.Value;
+			}
+
+			if (Next == INDEX_NONE)
+				break;
+
+			bool bAlreadySeen = false;
+			Seen.Add(Next, &bAlreadySeen);
+			if (bAlreadySeen)
+				break;
+
+			ChainLength++;
+			Current = Next;
+		}
+
+		if (ChainLength >= 2)
+			AddIssue(TEXT("cast_chain"), Graph.Nodes[CastNode], FString::Printf(TEXT("%d casts"), ChainLength));
+	}
+
+	void AddIssue(const TCHAR* Kind, const FBlueprintAnalysisNode& Node, const FString& Detail)
+	{
+		Entry.Flags.Add(Kind);
+
+		FBlueprintAnalysisIssue& Issue = Issues.AddDefaulted_GetRef();
+		Issue.Kind = Kind;
+		Issue.Graph = Graph.Name;
+		Issue.Entry = Entry.Entry;
+		Issue.Node = Node.Title;
+		Issue.Detail = Detail;
+	}
+
+	const FBlueprintAnalysisGraph& Graph;
+	const TSet<FString>& LocalFunctions;
+	FBlueprintAnalysisEntry& Entry;
+	TArray<FBlueprintAnalysisIssue>& Issues;
+};
+
+static void AnalyzeBlueprint(const FBlueprintAnalysisSnapshot& Snapshot, FBlueprintAnalysisResult& OutResult)
+{
+	OutResult.BlueprintPath = Snapshot.BlueprintPath;
+	OutResult.ParentClass = Snapshot.ParentClass;
+
+	TSet<FString> LocalFunctions;
+	for (const FBlueprintAnalysisGraph& Graph : Snapshot.Graphs)
+	{
+		if (Graph.Type == TEXT("FunctionGraph"))
+			LocalFunctions.Add(Graph.Name);
+	}
+
+	// Which entries run per frame has to be known before walking, because it changes which
+	// allocations are reported. Tick events are known up front; functions they call are found
+	// by walking tick entries first and then re-walking any function they reach.
+	TSet<FString> TickFunctions;
+	TArray<FBlueprintAnalysisEntry> Entries;
+	TArray<FBlueprintAnalysisIssue> Issues;
+
+	auto WalkEntries = [&]()
+	{
+		Entries.Reset();
+		Issues.Reset();
+
+		for (const FBlueprintAnalysisGraph& Graph : Snapshot.Graphs)
+		{
+			for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); NodeIndex++)
+			{
+				const FBlueprintAnalysisNode& Node = Graph.Nodes[NodeIndex];
+				if (!Node.bEntry)
+					continue;
+
+				FBlueprintAnalysisEntry& Entry = Entries.AddDefaulted_GetRef();
+				Entry.Graph = Graph.Name;
+				Entry.Entry = Node.EntryName;
+				Entry.bOnTick = IsOneOf(Node.EntryName, TickEvents) || (Graph.Type == TEXT("FunctionGraph") && TickFunctions.Contains(Graph.Name));
+
+				FEntryCostWalker(Graph, LocalFunctions, Entry, Issues).Walk(NodeIndex);
+			}
+		}
+	};
+
+	for (;;)
+	{
+		WalkEntries();
+
+		const int32 NumTickFunctions = TickFunctions.Num();
+		for (const FBlueprintAnalysisEntry& Entry : Entries)
+		{
+			if (Entry.bOnTick)
+				TickFunctions.Append(Entry.LocalCalls);
+		}
+		if (TickFunctions.Num() == NumTickFunctions)
+			break;
+	}
+
+	for (const FBlueprintAnalysisEntry& Entry : Entries)
+	{
+		OutResult.NodeCount += Entry.NodeCount;
+		OutResult.Score += Entry.EstimatedCost * (Entry.bOnTick ? TICK_WEIGHT : 1.0);
+	}
+
+	Entries.Sort([](const FBlueprintAnalysisEntry& A, const FBlueprintAnalysisEntry& B)
+	{
+		const double ScoreA = A.EstimatedCost * (A.bOnTick ? TICK_WEIGHT : 1.0);
+		const double ScoreB = B.EstimatedCost * (B.bOnTick ? TICK_WEIGHT : 1.0);
+		return ScoreA > ScoreB;
+	});
+
+	OutResult.Entries = MoveTemp(Entries);
+	OutResult.Issues = MoveTemp(Issues);
+}
+
+void FBlueprintExporterAnalyzer::Analyze(const TArray<FBlueprintAnalysisSnapshot>& Snapshots, TArray<FBlueprintAnalysisResult>& OutResults)
+{
+	OutResults.SetNum(Snapshots.Num());
+
+	ParallelFor(Snapshots.Num(), [&Snapshots, &OutResults](int32 Index)
+	{
+		AnalyzeBlueprint(Snapshots[Index], OutResults[Index]);
+	});
+
+	OutResults.Sort([](const FBlueprintAnalysisResult& A, const FBlueprintAnalysisResult& B)
+	{
+		return A.Score > B.Score;
+	});
+}
+
+TSharedPtr<FJsonObject> FBlueprintExporterAnalyzer::BuildReport(const TArray<FBlueprintAnalysisResult>& Results)
+{
+	TArray<TSharedPtr<FJsonValue>> Blueprints;
+	for (int32 Rank = 0; Rank < Results.Num(); Rank++)
+	{
+		const FBlueprintAnalysisResult& Result = Results[Rank];
+
+		TSharedPtr<FJsonObject> BlueprintObj = MakeShareable(new FJsonObject());
+		BlueprintObj->SetNumberField(TEXT("rank"), Rank + 1);
+		BlueprintObj->SetStringField(TEXT("blueprint"), Result.BlueprintPath);
+		BlueprintObj->SetStringField(TEXT("parent_class"), Result.ParentClass);
+		BlueprintObj->SetNumberField(TEXT("score"), FMath::RoundToDouble(Result.Score));
+		BlueprintObj->SetNumberField(TEXT("node_count"), Result.NodeCount);
+
+		bool bHasTick = false;
+		TArray<TSharedPtr<FJsonValue>> Functions;
+		for (const FBlueprintAnalysisEntry& Entry : Result.Entries)
+		{
+			bHasTick |= Entry.bOnTick;
+
+			TSharedPtr<FJsonObject> EntryObj = MakeShareable(new FJsonObject());
+			EntryObj->SetStringField(TEXT("graph"), Entry.Graph);
+			EntryObj->SetStringField(TEXT("entry"), Entry.Entry);
+			EntryObj->SetNumberField(TEXT("node_count"), Entry.NodeCount);
+			EntryObj->SetNumberField(TEXT("estimated_cost"), FMath::RoundToDouble(Entry.EstimatedCost));
+			EntryObj->SetBoolField(TEXT("on_tick"), Entry.bOnTick);
+
+			TArray<TSharedPtr<FJsonValue>> Flags;
+			for (const FString& Flag : Entry.Flags)
+				Flags.Add(MakeShareable(new FJsonValueString(Flag)));
+			EntryObj->SetArrayField(TEXT("flags"), Flags);
+
+			Functions.Add(MakeShareable(new FJsonValueObject(EntryObj)));
+		}
+		BlueprintObj->SetBoolField(TEXT("has_tick"), bHasTick);
+		BlueprintObj->SetArrayField(TEXT("functions"), Functions);
+
+		TArray<TSharedPtr<FJsonValue>> Issues;
+		for (const FBlueprintAnalysisIssue& Issue : Result.Issues)
+		{
+			TSharedPtr<FJsonObject> IssueObj = MakeShareable(new FJsonObject());
+			IssueObj->SetStringField(TEXT("kind"), Issue.Kind);
+			IssueObj->SetStringField(TEXT("graph"), Issue.Graph);
+			IssueObj->SetStringField(TEXT("entry"), Issue.Entry);
+			IssueObj->SetStringField(TEXT("node"), Issue.Node);
+			IssueObj->SetStringField(TEXT("detail"), Issue.Detail);
+			Issues.Add(MakeShareable(new FJsonValueObject(IssueObj)));
+		}
+		BlueprintObj->SetArrayField(TEXT("issues"), Issues);
+
+		Blueprints.Add(MakeShareable(new FJsonValueObject(BlueprintObj)));
+	}
+
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	Root->SetNumberField(TEXT("blueprint_count"), Results.Num());
+	Root->SetArrayField(TEXT("blueprints"), Blueprints);
+	return Root;
+}
+
+bool FBlueprintExporterAnalyzer::WriteReport(const TArray<FBlueprintAnalysisResult>& Results, const FString& OutputPath)
+{
+	TSharedPtr<FJsonObject> Root = BuildReport(Results);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+	if (FFileHelper::SaveStringToFile(OutputString, *OutputPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Wrote analysis of %d blueprints to %s"), Results.Num(), *OutputPath);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write analysis %s"), *OutputPath);
+	return false;
+}
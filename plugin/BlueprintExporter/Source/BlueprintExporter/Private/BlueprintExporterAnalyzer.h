@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class FJsonObject;
+
+/** Plain-data copy of a graph node, safe to read off the game thread */
+struct FBlueprintAnalysisNode
+{
+	FString Title;
+	FString ClassName;
+	FString NodeType;
+	FString FunctionName;
+	FString MacroName;
+	FString EntryName;
+	bool bPure = false;
+	bool bEntry = false;
+
+	/** Exec output pin name and the node index it leads to, one per link */
+	TArray<TPair<FName, int32>> ExecOutputs;
+
+	/** Nodes feeding this node's data inputs */
+	TArray<int32> DataInputs;
+};
+
+struct FBlueprintAnalysisGraph
+{
+	FString Name;
+	FString Type;
+	TArray<FBlueprintAnalysisNode> Nodes;
+};
+
+struct FBlueprintAnalysisSnapshot
+{
+	FString BlueprintPath;
+	FString ParentClass;
+	TArray<FBlueprintAnalysisGraph> Graphs;
+};
+
+struct FBlueprintAnalysisIssue
+{
+	FString Kind;
+	FString Graph;
+	FString Entry;
+	FString Node;
+	FString Detail;
+};
+
+/** Cost of everything one event or function runs */
+struct FBlueprintAnalysisEntry
+{
+	FString Graph;
+	FString Entry;
+	int32 NodeCount = 0;
+	double EstimatedCost = 0.0;
+	bool bOnTick = false;
+	TSet<FString> Flags;
+
+	/** Functions of the same Blueprint this entry calls, used to propagate bOnTick */
+	TSet<FString> LocalCalls;
+};
+
+struct FBlueprintAnalysisResult
+{
+	FString BlueprintPath;
+	FString ParentClass;
+	double Score = 0.0;
+	int32 NodeCount = 0;
+	TArray<FBlueprintAnalysisEntry> Entries;
+	TArray<FBlueprintAnalysisIssue> Issues;
+};
+
+/**
+ * Static performance estimate for Blueprints, used to decide which ones to port first.
+ *
+ * Snapshots are taken on the game thread; scoring only reads the snapshots and runs in
+ * parallel on worker threads. Costs are rough VM units: a native call is ~10, a variable
+ * access ~1, loop bodies count LOOP_ITERATIONS times, and anything reachable from Tick is
+ * weighted as if it ran every frame for a second.
+ */
+class FBlueprintExporterAnalyzer
+{
+public:
+	/** Loads and snapshots every project Blueprint whose path contains Filter. Game thread only. */
+	static void SnapshotBlueprints(const FString& Filter, TArray<FBlueprintAnalysisSnapshot>& OutSnapshots);
+
+	static void SnapshotBlueprint(const UBlueprint* Blueprint, FBlueprintAnalysisSnapshot& OutSnapshot);
+
+	/** Scores every snapshot in parallel; results are ranked by descending score. Any thread. */
+	static void Analyze(const TArray<FBlueprintAnalysisSnapshot>& Snapshots, TArray<FBlueprintAnalysisResult>& OutResults);
+
+	static TSharedPtr<FJsonObject> BuildReport(const TArray<FBlueprintAnalysisResult>& Results);
+
+	static bool WriteReport(const TArray<FBlueprintAnalysisResult>& Results, const FString& OutputPath);
+};
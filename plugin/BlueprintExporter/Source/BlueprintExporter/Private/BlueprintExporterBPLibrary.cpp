@@ -1,10 +1,16 @@
 #include "BlueprintExporterBPLibrary.h"
+#include "BlueprintExporterUtils.h"
+#include "BlueprintExporterValues.h"
+#include "BlueprintExporterBytecode.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/UserDefinedStruct.h"
 #include "Engine/UserDefinedEnum.h"
+#include "Engine/DataTable.h"
+#include "Engine/DataAsset.h"
+#include "DataTableUtils.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraph/EdGraphPin.h"
@@ -17,16 +23,34 @@
 #include "K2Node_MacroInstance.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_FunctionResult.h"
-#include "K2Node_CustomEvent.h"
 #include "K2Node_DynamicCast.h"
 #include "K2Node_TemporaryVariable.h"
+#include "K2Node_EditablePinBase.h"
+#include "Kismet2/BlueprintEditorUtils.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
 #include "Misc/FileHelper.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Hash/xxhash.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Serialization/JsonReader.h"
+#include "Misc/PackageName.h"
+#include "HAL/FileManager.h"
+#include "Algo/AllOf.h"
+#include "Algo/StableSort.h"
 #include "UObject/PropertyIterator.h"
+#include "BlueprintExporterTrace.h"
+
+// Bump when the catalogue entry layout changes so stale catalogues are rebuilt from scratch
+static const int32 TYPE_CATALOGUE_VERSION = 1;
+
+// Streamed exports are flushed to disk whenever this many characters are buffered
+static const int32 STREAMED_EXPORT_CHUNK_CHARS = 64 * 1024;
+
+// Engine macro library holding ForEachLoop, DoOnce, Gate and the other standard macros
+static const TCHAR* STANDARD_MACROS_PATH = TEXT("/Engine/EditorBlueprintResources/StandardMacros.StandardMacros");
 
 static FString ExtractBlueprintPath(const FString& ValueStr)
 {
@@ -106,6 +130,8 @@ static FString GetStructSource(FStructProperty* StructProp)
 
 static FString GetPinTypeString(const FEdGraphPinType& PinType)
 {
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::GetPinTypeString);
+
 	FString TypeStr;
 
 	if (PinType.PinCategory == UEdGraphSchema_K2::PC_Boolean)
@@ -175,7 +201,7 @@ static FString GetPinTypeString(const FEdGraphPinType& PinType)
 	else if (PinType.IsSet())
 		TypeStr = FString::Printf(TEXT("TSet<%s>"), *TypeStr);
 	else if (PinType.IsMap())
-		TypeStr = FString::Printf(TEXT("TMap<%s, Value>"), *TypeStr);
+		TypeStr = FString::Printf(TEXT("TMap<%s, %s>"), *TypeStr, *GetPinTypeString(FEdGraphPinType::GetPinTypeForTerminalType(PinType.PinValueType)));
 
 	if (PinType.bIsReference)
 		TypeStr += TEXT("&");
@@ -183,10 +209,194 @@ static FString GetPinTypeString(const FEdGraphPinType& PinType)
 	return TypeStr;
 }
 
-static TSharedPtr<FJsonObject> ExportPin(const UEdGraphPin* Pin)
+static FString GetPropertyTypeString(const FProperty* Property)
+{
+	// Same spelling as graph pins, so signatures and node pins can be compared directly
+	FEdGraphPinType PinType;
+	if (!GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Property, PinType))
+		return Property->GetCPPType();
+
+	PinType.bIsReference = false;
+	return GetPinTypeString(PinType);
+}
+
+/** ExportTextItem under its own trace scope; large structs make it the bulk of the defaults and component diffs */
+static void ExportPropertyText(const FProperty* Property, FString& OutValue, const void* Value)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportTextItem);
+	Property->ExportTextItem_Direct(OutValue, Value, nullptr, nullptr, PPF_None);
+}
+
+// A class default, variable default or component property value, cut short if it is a long container
+struct FBoundedPropertyValue
+{
+	FString Text;
+	TSharedPtr<FJsonValue> Typed;
+
+	// Full element count when the value was cut, INDEX_NONE otherwise
+	int32 NumElements = INDEX_NONE;
+};
+
+/** ExportText (and typed JSON) of Property in Container, keeping only the first MaxElements elements of longer arrays, sets and maps */
+static FBoundedPropertyValue ExportBoundedPropertyValue(const FProperty* Property, const void* Container, int32 MaxElements, bool bTypedValues)
+{
+	FBoundedPropertyValue Value;
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Container);
+
+	const int32 NumElements = MaxElements > 0 ? GetContainerNum(Property, ValuePtr) : INDEX_NONE;
+	if (NumElements <= MaxElements)
+	{
+		ExportPropertyText(Property, Value.Text, ValuePtr);
+		if (bTypedValues)
+			Value.Typed = PropertyToJson_InContainer(Property, Container);
+		return Value;
+	}
+
+	// Same text format as the container's ExportText, so a cut value parses like a whole one
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportBoundedContainer);
+	TArray<FString> ElementText;
+	TArray<TSharedPtr<FJsonValue>> TypedElements;
+	ContainerElementsToJson(Property, ValuePtr, 0, MaxElements, ElementText, bTypedValues ? &TypedElements : nullptr);
+
+	Value.Text = TEXT("(") + FString::Join(ElementText, TEXT(",")) + TEXT(")");
+	if (bTypedValues)
+		Value.Typed = MakeShareable(new FJsonValueArray(TypedElements));
+	Value.NumElements = NumElements;
+	return Value;
+}
+
+static FString MakePropertyPageRequest(const FString& BlueprintPath, const FString& PropertyName, int32 Offset, int32 Limit, bool bTypedValues)
+{
+	// Variable names may contain spaces and other characters a query string can't carry as-is
+	return FString::Printf(TEXT("/export-property?path=%s&name=%s&offset=%d&limit=%d%s"),
+		*FGenericPlatformHttp::UrlEncode(BlueprintPath), *FGenericPlatformHttp::UrlEncode(PropertyName), Offset, Limit, bTypedValues ? TEXT("&typed=1") : TEXT(""));
+}
+
+/** Marks a value ExportBoundedPropertyValue cut short, with the /export-property request for the elements after it */
+static void AddContainerContinuation(const TSharedPtr<FJsonObject>& Obj, const FBoundedPropertyValue& Value, const FString& BlueprintPath, const FString& PropertyName, const FBlueprintExportOptions& Options)
+{
+	if (Value.NumElements == INDEX_NONE)
+		return;
+
+	Obj->SetNumberField(TEXT("element_count"), Value.NumElements);
+	Obj->SetBoolField(TEXT("truncated"), true);
+	Obj->SetStringField(TEXT("continuation"), MakePropertyPageRequest(BlueprintPath, PropertyName, Options.MaxContainerElements, Options.MaxContainerElements, Options.bTypedValues));
+}
+
+static FString GetVariableFlagsString(const FBPVariableDescription& Var)
+{
+	TArray<FString> Flags;
+	if (Var.PropertyFlags & CPF_Edit) Flags.Add(TEXT("EditAnywhere"));
+	if (Var.PropertyFlags & CPF_BlueprintVisible) Flags.Add(TEXT("BlueprintVisible"));
+	if (Var.PropertyFlags & CPF_BlueprintReadOnly) Flags.Add(TEXT("BlueprintReadOnly"));
+	if (Var.PropertyFlags & CPF_ExposeOnSpawn) Flags.Add(TEXT("ExposeOnSpawn"));
+	if (Var.PropertyFlags & CPF_Interp) Flags.Add(TEXT("Interp"));
+
+	return FString::Join(Flags, TEXT(", "));
+}
+
+static void HashString(FXxHash64Builder& Builder, const FString& Str)
+{
+	const int32 Len = Str.Len();
+	Builder.Update(&Len, sizeof(Len));
+	Builder.Update(*Str, Len * sizeof(TCHAR));
+}
+
+static FString HashToString(const FXxHash64& Hash)
+{
+	return FString::Printf(TEXT("%016llx"), Hash.Hash);
+}
+
+// Canonical mode compares case-sensitively so the order never depends on locale or FName casing
+static bool CanonicalLess(const FString& A, const FString& B)
+{
+	return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+}
+
+/** Canonical mode: orders string values by value and objects by their KeyField */
+static void SortJsonValues(TArray<TSharedPtr<FJsonValue>>& Values, const TCHAR* KeyField = TEXT("name"))
+{
+	auto GetKey = [KeyField](const TSharedPtr<FJsonValue>& Value)
+	{
+		FString Key;
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		if (Value->TryGetObject(Object))
+			(*Object)->TryGetStringField(KeyField, Key);
+		else
+			Value->TryGetString(Key);
+		return Key;
+	};
+
+	Values.StableSort([&GetKey](const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+	{
+		return CanonicalLess(GetKey(A), GetKey(B));
+	});
+}
+
+/** Canonical mode: SortJsonValues on each named array field of Object that is present */
+static void SortJsonArrayFields(const TSharedPtr<FJsonObject>& Object, std::initializer_list<const TCHAR*> FieldNames)
+{
+	for (const TCHAR* FieldName : FieldNames)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (Object->TryGetArrayField(FieldName, Values))
+		{
+			TArray<TSharedPtr<FJsonValue>> Sorted = *Values;
+			SortJsonValues(Sorted);
+			Object->SetArrayField(FieldName, Sorted);
+		}
+	}
+}
+
+// State shared by every node and pin written for one ExportBlueprintToJsonWithOptions call
+struct FBlueprintExportContext
+{
+	const FBlueprintExportOptions& Options;
+
+	// Nodes that survive pruning; null when every node is exported
+	const TSet<const UEdGraphNode*>* LiveNodes = nullptr;
+
+	// Integer ids of the current graph's exported nodes and pins, filled when adjacency is requested
+	TMap<const UEdGraphNode*, int32> NodeIds;
+	TMap<const UEdGraphPin*, int32> PinIds;
+
+	// Functions called by exported nodes in first-use order, filled when the function table is requested
+	TArray<const UFunction*> CalledFunctions;
+	TMap<const UFunction*, int32> CalledFunctionIndices;
+
+	explicit FBlueprintExportContext(const FBlueprintExportOptions& InOptions)
+		: Options(InOptions)
+	{
+	}
+
+	bool IsExported(const UEdGraphNode* Node) const
+	{
+		return !LiveNodes || LiveNodes->Contains(Node);
+	}
+
+	/** Index of the node's resolved target function in CalledFunctions, INDEX_NONE for other nodes and unresolved calls */
+	int32 AddCalledFunction(const UEdGraphNode* Node)
+	{
+		const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+		const UFunction* Function = CallNode ? CallNode->GetTargetFunction() : nullptr;
+		if (!Function)
+			return INDEX_NONE;
+
+		if (const int32* Existing = CalledFunctionIndices.Find(Function))
+			return *Existing;
+		return CalledFunctionIndices.Add(Function, CalledFunctions.Add(Function));
+	}
+};
+
+static TSharedPtr<FJsonObject> ExportPin(const UEdGraphPin* Pin, const FBlueprintExportContext& Context)
 {
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportPin);
+
 	TSharedPtr<FJsonObject> PinObj = MakeShareable(new FJsonObject());
 
+	if (const int32* PinId = Context.PinIds.Find(Pin))
+		PinObj->SetNumberField(TEXT("id"), *PinId);
+
 	PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
 	PinObj->SetStringField(TEXT("type"), GetPinTypeString(Pin->PinType));
 	PinObj->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("Input") : TEXT("Output"));
@@ -194,6 +404,12 @@ static TSharedPtr<FJsonObject> ExportPin(const UEdGraphPin* Pin)
 	if (!Pin->DefaultValue.IsEmpty())
 		PinObj->SetStringField(TEXT("default_value"), Pin->DefaultValue);
 
+	if (Context.Options.bTypedValues)
+	{
+		if (TSharedPtr<FJsonValue> TypedDefault = PinDefaultToJson(Pin))
+			PinObj->SetField(TEXT("typed_default_value"), TypedDefault);
+	}
+
 	if (!Pin->DefaultTextValue.IsEmpty())
 		PinObj->SetStringField(TEXT("default_text"), Pin->DefaultTextValue.ToString());
 
@@ -204,7 +420,7 @@ static TSharedPtr<FJsonObject> ExportPin(const UEdGraphPin* Pin)
 	TArray<TSharedPtr<FJsonValue>> Connections;
 	for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
 	{
-		if (LinkedPin && LinkedPin->GetOwningNode())
+		if (LinkedPin && LinkedPin->GetOwningNode() && Context.IsExported(LinkedPin->GetOwningNode()))
 		{
 			TSharedPtr<FJsonObject> ConnObj = MakeShareable(new FJsonObject());
 			ConnObj->SetStringField(TEXT("node"), LinkedPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
@@ -213,91 +429,201 @@ static TSharedPtr<FJsonObject> ExportPin(const UEdGraphPin* Pin)
 			Connections.Add(MakeShareable(new FJsonValueObject(ConnObj)));
 		}
 	}
+
+	// LinkedTo follows the order links were made in; sort by the node's object name, then the pin
+	if (Context.Options.bCanonical)
+	{
+		Connections.StableSort([](const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+		{
+			const TSharedPtr<FJsonObject>& ConnA = A->AsObject();
+			const TSharedPtr<FJsonObject>& ConnB = B->AsObject();
+			const FString NodeA = ConnA->GetStringField(TEXT("node_name"));
+			const FString NodeB = ConnB->GetStringField(TEXT("node_name"));
+			if (NodeA != NodeB)
+				return CanonicalLess(NodeA, NodeB);
+			return CanonicalLess(ConnA->GetStringField(TEXT("pin")), ConnB->GetStringField(TEXT("pin")));
+		});
+	}
+
 	if (Connections.Num() > 0)
 		PinObj->SetArrayField(TEXT("connections"), Connections);
 
 	return PinObj;
 }
 
-static TSharedPtr<FJsonObject> ExportNode(const UEdGraphNode* Node)
+void GetExportPins(const UEdGraphNode* Node, TArray<const UEdGraphPin*>& OutPins)
 {
-	TSharedPtr<FJsonObject> NodeObj = MakeShareable(new FJsonObject());
-
-	NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
-	NodeObj->SetStringField(TEXT("name"), Node->GetName());
-	NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
-	NodeObj->SetStringField(TEXT("compact_title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+	OutPins.Reset(Node->Pins.Num());
+	for (const UEdGraphPin* Pin : Node->Pins)
+	{
+		if (Pin && !Pin->bHidden)
+			OutPins.Add(Pin);
+	}
+}
 
-	if (!Node->NodeComment.IsEmpty())
-		NodeObj->SetStringField(TEXT("comment"), Node->NodeComment);
+FBlueprintNodeInfo DescribeBlueprintNode(const UEdGraphNode* Node)
+{
+	FBlueprintNodeInfo Info;
 
-	// Node-specific data
 	if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("CallFunction"));
-		NodeObj->SetStringField(TEXT("function_name"), CallNode->FunctionReference.GetMemberName().ToString());
+		Info.NodeType = TEXT("CallFunction");
+		Info.FunctionName = CallNode->FunctionReference.GetMemberName().ToString();
 		if (UClass* MemberParent = CallNode->FunctionReference.GetMemberParentClass())
-			NodeObj->SetStringField(TEXT("target_class"), MemberParent->GetName());
+			Info.TargetClass = MemberParent->GetName();
 	}
+	// Custom events derive from UK2Node_Event and keep the node_type; GetFunctionName gives their
+	// own name, where EventReference is empty. An unnamed event is left empty rather than "None"
 	else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("Event"));
-		NodeObj->SetStringField(TEXT("event_name"), EventNode->EventReference.GetMemberName().ToString());
-	}
-	else if (const UK2Node_CustomEvent* CustomEventNode = Cast<UK2Node_CustomEvent>(Node))
-	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("CustomEvent"));
-		NodeObj->SetStringField(TEXT("event_name"), CustomEventNode->CustomFunctionName.ToString());
+		Info.NodeType = TEXT("Event");
+		const FName EventName = EventNode->GetFunctionName();
+		if (!EventName.IsNone())
+			Info.EventName = EventName.ToString();
 	}
 	else if (const UK2Node_VariableGet* VarGetNode = Cast<UK2Node_VariableGet>(Node))
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("VariableGet"));
-		NodeObj->SetStringField(TEXT("variable_name"), VarGetNode->VariableReference.GetMemberName().ToString());
+		Info.NodeType = TEXT("VariableGet");
+		Info.VariableName = VarGetNode->VariableReference.GetMemberName().ToString();
 	}
 	else if (const UK2Node_VariableSet* VarSetNode = Cast<UK2Node_VariableSet>(Node))
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("VariableSet"));
-		NodeObj->SetStringField(TEXT("variable_name"), VarSetNode->VariableReference.GetMemberName().ToString());
+		Info.NodeType = TEXT("VariableSet");
+		Info.VariableName = VarSetNode->VariableReference.GetMemberName().ToString();
 	}
-	else if (const UK2Node_IfThenElse* BranchNode = Cast<UK2Node_IfThenElse>(Node))
+	else if (Node->IsA<UK2Node_IfThenElse>())
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("Branch"));
+		Info.NodeType = TEXT("Branch");
 	}
 	else if (const UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("Cast"));
+		Info.NodeType = TEXT("Cast");
 		if (CastNode->TargetType)
-			NodeObj->SetStringField(TEXT("target_type"), CastNode->TargetType->GetName());
+			Info.TargetType = CastNode->TargetType->GetName();
 	}
-	else if (const UK2Node_FunctionEntry* EntryNode = Cast<UK2Node_FunctionEntry>(Node))
+	else if (Node->IsA<UK2Node_FunctionEntry>())
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("FunctionEntry"));
+		Info.NodeType = TEXT("FunctionEntry");
 	}
-	else if (const UK2Node_FunctionResult* ResultNode = Cast<UK2Node_FunctionResult>(Node))
+	else if (Node->IsA<UK2Node_FunctionResult>())
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("FunctionResult"));
+		Info.NodeType = TEXT("FunctionResult");
 	}
 	else if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
 	{
-		NodeObj->SetStringField(TEXT("node_type"), TEXT("Macro"));
+		Info.NodeType = MACRO_NODE_TYPE;
 		if (MacroNode->GetMacroGraph())
-			NodeObj->SetStringField(TEXT("macro_name"), MacroNode->GetMacroGraph()->GetName());
+		{
+			Info.MacroName = MacroNode->GetMacroGraph()->GetName();
+			Info.MacroId = MacroNode->GetMacroGraph()->GetPathName();
+		}
 	}
 	else
 	{
-		NodeObj->SetStringField(TEXT("node_type"), Node->GetClass()->GetName());
+		Info.NodeType = Node->GetClass()->GetName();
+	}
+
+	return Info;
+}
+
+void CollectReachableNodes(const UEdGraphNode* Root, TSet<const UEdGraphNode*>& OutReachable)
+{
+	// A node reached only through a data pin is evaluated but doesn't run its exec outputs,
+	// so exec and data visits are tracked separately
+	TSet<const UEdGraphNode*> ExecVisited;
+	TSet<const UEdGraphNode*> DataVisited;
+	TArray<TPair<const UEdGraphNode*, bool>> Stack;
+	Stack.Emplace(Root, true);
+
+	while (Stack.Num() > 0)
+	{
+		const TPair<const UEdGraphNode*, bool> Item = Stack.Pop(false);
+		const UEdGraphNode* Node = Item.Key;
+		const bool bViaExec = Item.Value;
+
+		if (!Node || !Node->IsNodeEnabled())
+			continue;
+
+		bool bAlreadyVisited = false;
+		(bViaExec ? ExecVisited : DataVisited).Add(Node, &bAlreadyVisited);
+		if (bAlreadyVisited)
+			continue;
+
+		OutReachable.Add(Node);
+
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin)
+				continue;
+
+			const bool bExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+			const bool bFollowExec = bViaExec && bExecPin && Pin->Direction == EGPD_Output;
+			const bool bFollowData = !bExecPin && Pin->Direction == EGPD_Input;
+			if (!bFollowExec && !bFollowData)
+				continue;
+
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				if (LinkedPin && LinkedPin->GetOwningNode())
+					Stack.Emplace(LinkedPin->GetOwningNode(), bFollowExec);
+			}
+		}
+	}
+}
+
+static TSharedPtr<FJsonObject> ExportNode(const UEdGraphNode* Node, FBlueprintExportContext& Context)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportNode);
+
+	TSharedPtr<FJsonObject> NodeObj = MakeShareable(new FJsonObject());
+
+	if (const int32* NodeId = Context.NodeIds.Find(Node))
+		NodeObj->SetNumberField(TEXT("id"), *NodeId);
+
+	NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+	NodeObj->SetStringField(TEXT("name"), Node->GetName());
+	if (Context.Options.bCanonical)
+		NodeObj->SetStringField(TEXT("guid"), Node->NodeGuid.ToString());
+	{
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::GetNodeTitle);
+		NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+		NodeObj->SetStringField(TEXT("compact_title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
 	}
 
+	if (!Node->NodeComment.IsEmpty())
+		NodeObj->SetStringField(TEXT("comment"), Node->NodeComment);
+
+	// Node-specific data
+	const FBlueprintNodeInfo Info = DescribeBlueprintNode(Node);
+	const int32 FunctionIndex = Context.Options.bFunctionTable ? Context.AddCalledFunction(Node) : INDEX_NONE;
+	NodeObj->SetStringField(TEXT("node_type"), Info.NodeType);
+	if (!Info.FunctionName.IsEmpty())
+		NodeObj->SetStringField(TEXT("function_name"), Info.FunctionName);
+	if (FunctionIndex != INDEX_NONE)
+		NodeObj->SetNumberField(TEXT("function_index"), FunctionIndex);
+	else if (!Info.TargetClass.IsEmpty())
+		NodeObj->SetStringField(TEXT("target_class"), Info.TargetClass);
+	if (!Info.EventName.IsEmpty())
+		NodeObj->SetStringField(TEXT("event_name"), Info.EventName);
+	if (!Info.VariableName.IsEmpty())
+		NodeObj->SetStringField(TEXT("variable_name"), Info.VariableName);
+	if (!Info.TargetType.IsEmpty())
+		NodeObj->SetStringField(TEXT("target_type"), Info.TargetType);
+	if (!Info.MacroName.IsEmpty())
+		NodeObj->SetStringField(TEXT("macro_name"), Info.MacroName);
+	if (!Info.MacroId.IsEmpty())
+		NodeObj->SetStringField(TEXT("macro_id"), Info.MacroId);
+
 	// Export all pins
 	TArray<TSharedPtr<FJsonValue>> InputPins;
 	TArray<TSharedPtr<FJsonValue>> OutputPins;
 
-	for (const UEdGraphPin* Pin : Node->Pins)
-	{
-		if (!Pin || Pin->bHidden)
-			continue;
+	TArray<const UEdGraphPin*> Pins;
+	GetExportPins(Node, Pins);
 
-		TSharedPtr<FJsonObject> PinObj = ExportPin(Pin);
+	for (const UEdGraphPin* Pin : Pins)
+	{
+		TSharedPtr<FJsonObject> PinObj = ExportPin(Pin, Context);
 
 		if (Pin->Direction == EGPD_Input)
 			InputPins.Add(MakeShareable(new FJsonValueObject(PinObj)));
@@ -307,299 +633,1208 @@ static TSharedPtr<FJsonObject> ExportNode(const UEdGraphNode* Node)
 
 	NodeObj->SetArrayField(TEXT("inputs"), InputPins);
 	NodeObj->SetArrayField(TEXT("outputs"), OutputPins);
+	BLUEPRINT_EXPORTER_TRACE_COUNT(BlueprintExporter_PinsExported, InputPins.Num() + OutputPins.Num());
 
 	return NodeObj;
 }
 
-bool UBlueprintExporterBPLibrary::ExportBlueprintToJson(const FString& BlueprintPath, const FString& OutputPath)
+bool IsGraphEntryNode(const UEdGraphNode* Node)
 {
-	// Load the blueprint
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
-	if (!Blueprint)
+	if (Node->IsA<UK2Node_Event>() || Node->IsA<UK2Node_FunctionEntry>())
+		return true;
+
+	// Input action/key events and similar nodes don't derive from UK2Node_Event
+	bool bHasExecInput = false;
+	bool bHasExecOutput = false;
+	for (const UEdGraphPin* Pin : Node->Pins)
 	{
-		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load blueprint at %s"), *BlueprintPath);
-		return false;
+		if (!Pin || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+			continue;
+
+		if (Pin->Direction == EGPD_Input)
+			bHasExecInput = true;
+		else
+			bHasExecOutput = true;
 	}
+	return bHasExecOutput && !bHasExecInput;
+}
 
-	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded %s"), *Blueprint->GetName());
+/**
+ * Edge list over the exported nodes with CSR offsets. Edges run from output pin to input pin and
+ * are sorted by source node, so a node's outgoing edges are edges[out_offsets[id]..out_offsets[id+1]).
+ * Incoming edges are in_edges[in_offsets[id]..in_offsets[id+1]), as indices into edges.
+ */
+static TSharedPtr<FJsonObject> BuildGraphAdjacency(const TArray<const UEdGraphNode*>& ExportedNodes, const FBlueprintExportContext& Context)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::BuildGraphAdjacency);
 
-	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	struct FEdge
+	{
+		int32 SrcNode;
+		int32 SrcPin;
+		int32 DstNode;
+		int32 DstPin;
+		bool bExec;
+	};
+
+	TArray<FEdge> Edges;
+	TArray<int32> OutOffsets;
+	OutOffsets.Reserve(ExportedNodes.Num() + 1);
+
+	TArray<const UEdGraphPin*> Pins;
+	for (int32 NodeId = 0; NodeId < ExportedNodes.Num(); NodeId++)
+	{
+		OutOffsets.Add(Edges.Num());
 
-	Root->SetStringField(TEXT("name"), Blueprint->GetName());
-	Root->SetStringField(TEXT("blueprint_path"), BlueprintPath);
+		GetExportPins(ExportedNodes[NodeId], Pins);
+		for (int32 PinId = 0; PinId < Pins.Num(); PinId++)
+		{
+			const UEdGraphPin* Pin = Pins[PinId];
+			if (Pin->Direction != EGPD_Output)
+				continue;
 
-	// Parent class
-	if (Blueprint->ParentClass)
-		Root->SetStringField(TEXT("parent_class"), Blueprint->ParentClass->GetName());
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const int32* DstNode = LinkedPin ? Context.NodeIds.Find(LinkedPin->GetOwningNode()) : nullptr;
+				const int32* DstPin = LinkedPin ? Context.PinIds.Find(LinkedPin) : nullptr;
+				if (!DstNode || !DstPin)
+					continue;
 
-	// ---- Class Default Values ----
-	// Export CDO properties that differ from parent class defaults
-	TArray<TSharedPtr<FJsonValue>> ClassDefaults;
+				Edges.Add({ NodeId, PinId, *DstNode, *DstPin, Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec });
+			}
+		}
+	}
+	OutOffsets.Add(Edges.Num());
+
+	// Counting sort of edge indices by destination node
+	TArray<int32> InOffsets;
+	InOffsets.SetNumZeroed(ExportedNodes.Num() + 1);
+	for (const FEdge& Edge : Edges)
+		InOffsets[Edge.DstNode + 1]++;
+	for (int32 NodeId = 0; NodeId < ExportedNodes.Num(); NodeId++)
+		InOffsets[NodeId + 1] += InOffsets[NodeId];
+
+	TArray<int32> InEdges;
+	InEdges.SetNumUninitialized(Edges.Num());
+	TArray<int32> InCursor(InOffsets.GetData(), ExportedNodes.Num());
+	for (int32 EdgeIndex = 0; EdgeIndex < Edges.Num(); EdgeIndex++)
+		InEdges[InCursor[Edges[EdgeIndex].DstNode]++] = EdgeIndex;
+
+	auto ToJsonArray = [](const TArray<int32>& Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonValues;
+		JsonValues.Reserve(Values.Num());
+		for (const int32 Value : Values)
+			JsonValues.Add(MakeShareable(new FJsonValueNumber(Value)));
+		return JsonValues;
+	};
+
+	// Each edge is [src_node, src_pin, dst_node, dst_pin, is_exec]
+	TArray<TSharedPtr<FJsonValue>> EdgeValues;
+	EdgeValues.Reserve(Edges.Num());
+	for (const FEdge& Edge : Edges)
+		EdgeValues.Add(MakeShareable(new FJsonValueArray(ToJsonArray({ Edge.SrcNode, Edge.SrcPin, Edge.DstNode, Edge.DstPin, Edge.bExec ? 1 : 0 }))));
+
+	TSharedPtr<FJsonObject> AdjacencyObj = MakeShareable(new FJsonObject());
+	AdjacencyObj->SetArrayField(TEXT("edges"), EdgeValues);
+	AdjacencyObj->SetArrayField(TEXT("out_offsets"), ToJsonArray(OutOffsets));
+	AdjacencyObj->SetArrayField(TEXT("in_edges"), ToJsonArray(InEdges));
+	AdjacencyObj->SetArrayField(TEXT("in_offsets"), ToJsonArray(InOffsets));
+	return AdjacencyObj;
+}
 
-	if (Blueprint->GeneratedClass && Blueprint->ParentClass)
+// Pure to the Blueprint compiler, but each call yields a new value (random numbers, clocks)
+static const TCHAR* NondeterministicFunctionPrefixes[] = {
+	TEXT("Random"),
+	TEXT("GetRealTime"),
+	TEXT("GetAccurateRealTime"),
+	TEXT("GetGameTime"),
+	TEXT("GetTimeSeconds"),
+	TEXT("GetUnpausedTimeSeconds"),
+	TEXT("GetPlatformTime"),
+	TEXT("Now"),
+	TEXT("UtcNow"),
+	TEXT("Today"),
+	TEXT("NewGuid"),
+};
+
+/** A BlueprintPure call that returns the same value when evaluated twice with the same inputs and state */
+static bool IsRepeatablePureCall(const UK2Node_CallFunction* CallNode)
+{
+	const UFunction* Function = CallNode->GetTargetFunction();
+	if (!Function || !Function->HasAnyFunctionFlags(FUNC_BlueprintPure))
+		return false;
+
+	const FString FunctionName = Function->GetName();
+	for (const TCHAR* Prefix : NondeterministicFunctionPrefixes)
 	{
-		UObject* ClassCDO = Blueprint->GeneratedClass->GetDefaultObject();
-		UObject* ParentCDO = Blueprint->ParentClass->GetDefaultObject();
+		if (FunctionName.StartsWith(Prefix, ESearchCase::CaseSensitive))
+			return false;
+	}
 
-		if (ClassCDO && ParentCDO)
+	// A non-const reference parameter (FRandomStream&) is written by every call
+	for (TFieldIterator<FProperty> PropIt(Function); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+	{
+		if (PropIt->HasAnyPropertyFlags(CPF_ReferenceParm) && !PropIt->HasAnyPropertyFlags(CPF_ConstParm))
+			return false;
+	}
+	return true;
+}
+
+/**
+ * Structural hashes of pure node subtrees. Two pure nodes hash equal when they have the same
+ * class, function/variable reference and unlinked pin defaults, and their data inputs come from
+ * equal pure subtrees or from the same impure node's output. Pure nodes are re-evaluated for
+ * every consumer, so equal hashes mean the same value is computed more than once.
+ */
+struct FPureSubtreeHasher
+{
+	const FBlueprintExportContext& Context;
+	TMap<const UEdGraphNode*, uint64> Hashes;
+	TMap<const UEdGraphNode*, int32> SubtreeSizes;
+	TSet<const UEdGraphNode*> InProgress;
+
+	explicit FPureSubtreeHasher(const FBlueprintExportContext& InContext)
+		: Context(InContext)
+	{
+	}
+
+	bool IsCandidate(const UEdGraphNode* Node) const
+	{
+		const UK2Node* K2Node = Cast<UK2Node>(Node);
+		if (!K2Node || !K2Node->IsNodePure() || !Context.IsExported(Node))
+			return false;
+
+		// Pure but not repeatable; two calls must stay two calls
+		if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+			return IsRepeatablePureCall(CallNode);
+		return true;
+	}
+
+	uint64 Hash(const UEdGraphNode* Node)
+	{
+		if (const uint64* Existing = Hashes.Find(Node))
+			return *Existing;
+
+		// Pure cycles don't compile; give each node on one its own class
+		if (InProgress.Contains(Node))
+			return reinterpret_cast<UPTRINT>(Node);
+		InProgress.Add(Node);
+
+		const FBlueprintNodeInfo Info = DescribeBlueprintNode(Node);
+
+		FXxHash64Builder Builder;
+		HashString(Builder, Node->GetClass()->GetPathName());
+		HashString(Builder, Info.NodeType);
+		HashString(Builder, Info.FunctionName);
+		HashString(Builder, Info.TargetClass);
+		HashString(Builder, Info.VariableName);
+		HashString(Builder, Info.TargetType);
+		HashString(Builder, Info.MacroId);
+
+		int32 Size = 1;
+
+		TArray<const UEdGraphPin*> Pins;
+		GetExportPins(Node, Pins);
+		for (const UEdGraphPin* Pin : Pins)
 		{
-			// Get list of blueprint variable names to skip (handled separately)
-			TSet<FName> BlueprintVariableNames;
-			for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+			if (Pin->Direction != EGPD_Input || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+				continue;
+
+			HashString(Builder, Pin->PinName.ToString());
+
+			if (Pin->LinkedTo.Num() == 0)
 			{
-				BlueprintVariableNames.Add(Var.VarName);
+				HashString(Builder, Pin->DefaultValue);
+				HashString(Builder, Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : FString());
+				HashString(Builder, Pin->DefaultTextValue.ToString());
+				continue;
 			}
 
-			for (TFieldIterator<FProperty> PropIt(Blueprint->GeneratedClass); PropIt; ++PropIt)
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
 			{
-				FProperty* Property = *PropIt;
-
-				// Skip transient properties
-				if (!Property || Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+				const UEdGraphNode* Source = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+				if (!Source)
 					continue;
 
-				// Skip blueprint variables (handled in variables section)
-				if (BlueprintVariableNames.Contains(Property->GetFName()))
-					continue;
+				HashString(Builder, LinkedPin->PinName.ToString());
+				if (IsCandidate(Source))
+				{
+					const uint64 SourceHash = Hash(Source);
+					Builder.Update(&SourceHash, sizeof(SourceHash));
+					Size += SubtreeSizes.FindRef(Source);
+				}
+				else
+				{
+					// Values from impure nodes are only equal when they are the same output
+					HashString(Builder, Source->GetPathName());
+				}
+			}
+		}
 
-				// Skip component properties (handled in components section)
-				if (CastField<FObjectProperty>(Property) && Property->GetName().StartsWith(TEXT("K2Node_")))
-					continue;
+		InProgress.Remove(Node);
 
-				// Only export if property exists in parent class and differs
-				FProperty* ParentProperty = Blueprint->ParentClass->FindPropertyByName(Property->GetFName());
-				if (!ParentProperty)
-					continue;
+		const uint64 Result = Builder.Finalize().Hash;
+		Hashes.Add(Node, Result);
+		SubtreeSizes.Add(Node, Size);
+		return Result;
+	}
+};
 
-				const void* ChildValue = Property->ContainerPtrToValuePtr<void>(ClassCDO);
-				const void* ParentValue = ParentProperty->ContainerPtrToValuePtr<void>(ParentCDO);
+/** The impure nodes whose execution evaluates Node: itself when impure, else those its outputs feed through pure nodes */
+static void CollectEvaluatingStatements(const UEdGraphNode* Node, const FBlueprintExportContext& Context, TSet<const UEdGraphNode*>& Visited, TArray<const UEdGraphNode*>& OutStatements)
+{
+	bool bAlreadyVisited = false;
+	Visited.Add(Node, &bAlreadyVisited);
+	if (bAlreadyVisited)
+		return;
 
-				// Compare values - only export if different
-				if (!Property->Identical(ChildValue, ParentValue))
-				{
-					TSharedPtr<FJsonObject> DefaultObj = MakeShareable(new FJsonObject());
-					DefaultObj->SetStringField(TEXT("name"), Property->GetName());
+	const UK2Node* K2Node = Cast<UK2Node>(Node);
+	if (!K2Node || !K2Node->IsNodePure())
+	{
+		OutStatements.AddUnique(Node);
+		return;
+	}
 
-					FString ValueStr;
-					Property->ExportTextItem_Direct(ValueStr, ChildValue, nullptr, nullptr, PPF_None);
-					DefaultObj->SetStringField(TEXT("value"), ValueStr);
+	for (const UEdGraphPin* Pin : Node->Pins)
+	{
+		if (!Pin || Pin->Direction != EGPD_Output || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+			continue;
 
-					// Get property type
-					FString TypeStr;
-					if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-					{
-						TypeStr = StructProp->Struct->GetName();
+		for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+		{
+			if (LinkedPin && Context.IsExported(LinkedPin->GetOwningNode()))
+				CollectEvaluatingStatements(LinkedPin->GetOwningNode(), Context, Visited, OutStatements);
+		}
+	}
+}
 
-						// Add struct source information
-						FString StructSource = GetStructSource(StructProp);
-						DefaultObj->SetStringField(TEXT("struct_source"), StructSource);
+/**
+ * Pure expressions computed more than once within one statement: structurally equal pure subtrees
+ * whose outputs reach two or more consumer pins evaluated by the same impure node. Pure nodes are
+ * re-evaluated for every statement that reads them and state can change in between (a Set between
+ * two Gets), so uses in different statements are never grouped. A group is left out when all of
+ * its consumers belong to one other reported group, since evaluating that one once covers it.
+ * Lone variable reads and literals aren't reported; a temp would cost as much as the read.
+ */
+static TArray<TSharedPtr<FJsonValue>> BuildGraphCommonSubexpressions(const TArray<const UEdGraphNode*>& ExportedNodes, const FBlueprintExportContext& Context)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::BuildGraphCommonSubexpressions);
 
-						if (StructSource == TEXT("blueprint") && IsUserDefinedStruct(ValueStr))
-						{
-							FString StructName = ExtractBlueprintPath(ValueStr);
-							if (!StructName.IsEmpty())
-							{
-								DefaultObj->SetStringField(TEXT("struct_reference"), StructName);
-								DefaultObj->SetBoolField(TEXT("is_struct_reference"), true);
-							}
-						}
-					}
-					else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
-						TypeStr = ObjProp->PropertyClass->GetName();
-					else if (FClassProperty* ClassProp = CastField<FClassProperty>(Property))
-						TypeStr = FString::Printf(TEXT("TSubclassOf<%s>"), *ClassProp->MetaClass->GetName());
-					else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
-					{
-						if (UEnum* Enum = EnumProp->GetEnum())
-							TypeStr = Enum->GetName();
-						else
-							TypeStr = TEXT("uint8");
-					}
-					else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
-					{
-						if (ByteProp->Enum)
-							TypeStr = ByteProp->Enum->GetName();
-						else
-							TypeStr = TEXT("uint8");
-					}
-					else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-						TypeStr = TEXT("bool");
-					else
-						TypeStr = Property->GetCPPType();
+	FPureSubtreeHasher Hasher(Context);
 
-					DefaultObj->SetStringField(TEXT("type"), TypeStr);
+	TArray<uint64> ClassHashes;
+	TMap<uint64, TArray<const UEdGraphNode*>> Classes;
+	for (const UEdGraphNode* Node : ExportedNodes)
+	{
+		if (!Hasher.IsCandidate(Node))
+			continue;
 
-					// Check if this is a blueprint reference
-					if (IsBlueprintReference(ValueStr))
-					{
-						FString BPName = ExtractBlueprintPath(ValueStr);
-						if (!BPName.IsEmpty())
-						{
-							DefaultObj->SetStringField(TEXT("blueprint_reference"), BPName);
-							DefaultObj->SetBoolField(TEXT("is_blueprint_reference"), true);
-						}
-					}
+		const uint64 NodeHash = Hasher.Hash(Node);
+		TArray<const UEdGraphNode*>* Members = Classes.Find(NodeHash);
+		if (!Members)
+		{
+			ClassHashes.Add(NodeHash);
+			Members = &Classes.Add(NodeHash);
+		}
+		Members->Add(Node);
+	}
 
-					ClassDefaults.Add(MakeShareable(new FJsonValueObject(DefaultObj)));
-					UE_LOG(LogTemp, Log, TEXT("  Class Default: %s = %s"), *Property->GetName(), *ValueStr);
+	struct FConsumer
+	{
+		const UEdGraphNode* Node;
+		FName PinName;
+	};
+
+	// One class's uses evaluated by one statement
+	struct FGroup
+	{
+		uint64 ClassHash;
+		const UEdGraphNode* Statement;
+		TArray<const UEdGraphNode*> Members;
+		TArray<FConsumer> Consumers;
+	};
+
+	// Keyed on member and statement: a member read by two statements is in a group for each
+	TArray<FGroup> Groups;
+	TMap<TPair<const UEdGraphNode*, const UEdGraphNode*>, int32> ReportedGroupOf;
+	for (const uint64 ClassHash : ClassHashes)
+	{
+		const TArray<const UEdGraphNode*>& Members = Classes[ClassHash];
+
+		bool bHasLinkedInput = false;
+		TMap<const UEdGraphNode*, FGroup> ByStatement;
+		for (const UEdGraphNode* Member : Members)
+		{
+			for (const UEdGraphPin* Pin : Member->Pins)
+			{
+				if (!Pin || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+					continue;
+
+				if (Pin->Direction == EGPD_Input)
+				{
+					bHasLinkedInput |= Pin->LinkedTo.Num() > 0;
+					continue;
+				}
+
+				for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					const UEdGraphNode* Consumer = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+					if (!Consumer || !Context.IsExported(Consumer))
+						continue;
+
+					// A pure consumer read by several statements runs once per statement; its own pins
+					// still share one evaluation, so it becomes a statement of its own
+					TSet<const UEdGraphNode*> Visited;
+					TArray<const UEdGraphNode*> Statements;
+					CollectEvaluatingStatements(Consumer, Context, Visited, Statements);
+					const UEdGraphNode* Statement = Statements.Num() == 1 ? Statements[0] : Consumer;
+
+					FGroup& Group = ByStatement.FindOrAdd(Statement, FGroup{ ClassHash, Statement });
+					Group.Members.AddUnique(Member);
+					Group.Consumers.Add({ Consumer, LinkedPin->PinName });
 				}
 			}
 		}
+
+		if (!bHasLinkedInput && DescribeBlueprintNode(Members[0]).FunctionName.IsEmpty())
+			continue;
+
+		for (TPair<const UEdGraphNode*, FGroup>& Pair : ByStatement)
+		{
+			if (Pair.Value.Consumers.Num() < 2)
+				continue;
+
+			const int32 GroupIndex = Groups.Add(MoveTemp(Pair.Value));
+			for (const UEdGraphNode* Member : Groups[GroupIndex].Members)
+				ReportedGroupOf.Add({ Member, Groups[GroupIndex].Statement }, GroupIndex);
+		}
 	}
 
-	if (ClassDefaults.Num() > 0)
+	TArray<TSharedPtr<FJsonValue>> Result;
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); GroupIndex++)
 	{
-		Root->SetArrayField(TEXT("class_defaults"), ClassDefaults);
-		UE_LOG(LogTemp, Log, TEXT("  Exported %d class default values"), ClassDefaults.Num());
+		const FGroup& Group = Groups[GroupIndex];
+		const TArray<FConsumer>* Consumers = &Group.Consumers;
+
+		const int32* EnclosingGroup = ReportedGroupOf.Find({ (*Consumers)[0].Node, Group.Statement });
+		const bool bSubsumed = EnclosingGroup && *EnclosingGroup != GroupIndex && Algo::AllOf(*Consumers, [&](const FConsumer& Consumer)
+		{
+			const int32* ConsumerGroup = ReportedGroupOf.Find({ Consumer.Node, Group.Statement });
+			return ConsumerGroup && *ConsumerGroup == *EnclosingGroup;
+		});
+		if (bSubsumed)
+			continue;
+
+		const uint64 ClassHash = Group.ClassHash;
+		const TArray<const UEdGraphNode*>& Members = Group.Members;
+		const FBlueprintNodeInfo Info = DescribeBlueprintNode(Members[0]);
+
+		FString TempBase = !Info.FunctionName.IsEmpty() ? Info.FunctionName : Info.NodeType;
+		TempBase.ReplaceInline(TEXT(" "), TEXT(""));
+
+		TArray<TSharedPtr<FJsonValue>> MemberNames;
+		for (const UEdGraphNode* Member : Members)
+			MemberNames.Add(MakeShareable(new FJsonValueString(Member->GetName())));
+
+		TArray<TSharedPtr<FJsonValue>> ConsumerValues;
+		for (const FConsumer& Consumer : *Consumers)
+		{
+			TSharedPtr<FJsonObject> ConsumerObj = MakeShareable(new FJsonObject());
+			ConsumerObj->SetStringField(TEXT("node"), Consumer.Node->GetName());
+			ConsumerObj->SetStringField(TEXT("pin"), Consumer.PinName.ToString());
+			ConsumerValues.Add(MakeShareable(new FJsonValueObject(ConsumerObj)));
+		}
+
+		TSharedPtr<FJsonObject> ClassObj = MakeShareable(new FJsonObject());
+		ClassObj->SetStringField(TEXT("hash"), HashToString(FXxHash64{ ClassHash }));
+		ClassObj->SetNumberField(TEXT("subtree_node_count"), Hasher.SubtreeSizes.FindRef(Members[0]));
+		ClassObj->SetArrayField(TEXT("nodes"), MemberNames);
+		ClassObj->SetArrayField(TEXT("consumers"), ConsumerValues);
+		ClassObj->SetStringField(TEXT("statement"), Group.Statement->GetName());
+		ClassObj->SetStringField(TEXT("suggested_temp"), FString::Printf(TEXT("Temp_%s_%d"), *TempBase, Result.Num()));
+		Result.Add(MakeShareable(new FJsonValueObject(ClassObj)));
 	}
 
-	// ---- Variables ----
-	TArray<TSharedPtr<FJsonValue>> Variables;
+	return Result;
+}
 
-	// Get CDO (Class Default Object) to extract actual default values
-	UObject* CDO = nullptr;
-	if (Blueprint->GeneratedClass)
+/** ExtraRoots are kept live under prune=1 along with the graph's entry nodes, e.g. a macro's tunnels */
+static TSharedPtr<FJsonObject> ExportGraph(const UEdGraph* Graph, const TCHAR* GraphType, FBlueprintExportContext& Context, int32& OutNumPruned, TConstArrayView<const UEdGraphNode*> ExtraRoots = {})
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportGraph);
+
+	TSharedPtr<FJsonObject> GraphObj = MakeShareable(new FJsonObject());
+	GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+	GraphObj->SetStringField(TEXT("type"), GraphType);
+
+	TSet<const UEdGraphNode*> LiveNodes;
+	if (Context.Options.bPrune)
 	{
-		CDO = Blueprint->GeneratedClass->GetDefaultObject();
+		for (const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node && Node->IsNodeEnabled() && IsGraphEntryNode(Node))
+				CollectReachableNodes(Node, LiveNodes);
+		}
+		for (const UEdGraphNode* Root : ExtraRoots)
+			CollectReachableNodes(Root, LiveNodes);
+		Context.LiveNodes = &LiveNodes;
 	}
 
-	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+	int32 NumPruned = 0;
+	TArray<const UEdGraphNode*> ExportedNodes;
+	for (const UEdGraphNode* Node : Graph->Nodes)
 	{
-		TSharedPtr<FJsonObject> VarObj = MakeShareable(new FJsonObject());
-		VarObj->SetStringField(TEXT("name"), Var.VarName.ToString());
-		VarObj->SetStringField(TEXT("type"), GetPinTypeString(Var.VarType));
-		VarObj->SetStringField(TEXT("category"), Var.Category.ToString());
-		VarObj->SetStringField(TEXT("default_value"), Var.DefaultValue);
-		VarObj->SetStringField(TEXT("friendly_name"), Var.FriendlyName);
+		if (!Node) continue;
 
-		// Extract actual default value from CDO
-		if (CDO && Blueprint->GeneratedClass)
+		if (!Context.IsExported(Node))
 		{
-			FProperty* Property = Blueprint->GeneratedClass->FindPropertyByName(Var.VarName);
-			if (Property)
-			{
-				// Add struct source information for struct properties
-				if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-				{
-					FString StructSource = GetStructSource(StructProp);
-					VarObj->SetStringField(TEXT("struct_source"), StructSource);
-				}
+			NumPruned++;
+			continue;
+		}
+		ExportedNodes.Add(Node);
+	}
 
-				// Add enum source information for enum properties
-				UEnum* VarEnum = nullptr;
-				if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
-					VarEnum = EnumProp->GetEnum();
-				else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
-					VarEnum = ByteProp->Enum;
+	// Graph->Nodes is in creation order and shifts when nodes are deleted or pasted; the GUID doesn't.
+	// Everything below (ids, adjacency, common subexpressions, called_functions) follows this order.
+	if (Context.Options.bCanonical)
+	{
+		Algo::StableSort(ExportedNodes, [](const UEdGraphNode* A, const UEdGraphNode* B)
+		{
+			if (A->NodeGuid != B->NodeGuid)
+				return A->NodeGuid < B->NodeGuid;
+			return CanonicalLess(A->GetName(), B->GetName());
+		});
+	}
 
-				if (VarEnum)
-				{
-					VarObj->SetBoolField(TEXT("is_enum"), true);
-					VarObj->SetStringField(TEXT("enum_name"), VarEnum->GetName());
-					// Check if it's a UserDefinedEnum (blueprint enum)
-					if (Cast<UUserDefinedEnum>(VarEnum))
-					{
-						VarObj->SetStringField(TEXT("enum_source"), TEXT("blueprint"));
-						VarObj->SetStringField(TEXT("enum_path"), VarEnum->GetPathName());
-					}
-					else
-					{
-						VarObj->SetStringField(TEXT("enum_source"), TEXT("cpp"));
-					}
-				}
+	// Ids are assigned before any node is written so connections can refer to later nodes
+	if (Context.Options.bAdjacency)
+	{
+		TArray<const UEdGraphPin*> Pins;
+		for (int32 NodeId = 0; NodeId < ExportedNodes.Num(); NodeId++)
+		{
+			Context.NodeIds.Add(ExportedNodes[NodeId], NodeId);
 
-				FString CDOValue;
-				const void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(CDO);
-				Property->ExportTextItem_Direct(CDOValue, PropertyAddr, nullptr, nullptr, PPF_None);
+			GetExportPins(ExportedNodes[NodeId], Pins);
+			for (int32 PinId = 0; PinId < Pins.Num(); PinId++)
+				Context.PinIds.Add(Pins[PinId], PinId);
+		}
+	}
 
-				if (!CDOValue.IsEmpty())
-				{
-					VarObj->SetStringField(TEXT("cdo_default_value"), CDOValue);
+	TArray<TSharedPtr<FJsonValue>> Nodes;
+	for (const UEdGraphNode* Node : ExportedNodes)
+	{
+		Nodes.Add(MakeShareable(new FJsonValueObject(ExportNode(Node, Context))));
+	}
+	GraphObj->SetArrayField(TEXT("nodes"), Nodes);
+	BLUEPRINT_EXPORTER_TRACE_COUNT(BlueprintExporter_NodesExported, Nodes.Num());
 
-					// Check if this is a blueprint reference
-					if (IsBlueprintReference(CDOValue))
-					{
-						FString BPName = ExtractBlueprintPath(CDOValue);
-						if (!BPName.IsEmpty())
-						{
-							VarObj->SetStringField(TEXT("blueprint_reference"), BPName);
-							VarObj->SetBoolField(TEXT("is_blueprint_reference"), true);
-						}
-					}
+	if (Context.Options.bAdjacency)
+		GraphObj->SetObjectField(TEXT("adjacency"), BuildGraphAdjacency(ExportedNodes, Context));
 
-					// Check if this is a user-defined struct reference
-					if (IsUserDefinedStruct(CDOValue))
-					{
-						FString StructName = ExtractBlueprintPath(CDOValue);
-						if (!StructName.IsEmpty())
-						{
-							VarObj->SetStringField(TEXT("struct_reference"), StructName);
-							VarObj->SetBoolField(TEXT("is_struct_reference"), true);
-						}
-					}
-				}
+	if (Context.Options.bCommonSubexpressions)
+	{
+		TArray<TSharedPtr<FJsonValue>> CommonSubexpressions = BuildGraphCommonSubexpressions(ExportedNodes, Context);
+		if (CommonSubexpressions.Num() > 0)
+			GraphObj->SetArrayField(TEXT("common_subexpressions"), CommonSubexpressions);
+	}
+
+	if (Context.Options.bPrune)
+		GraphObj->SetNumberField(TEXT("pruned_node_count"), NumPruned);
+
+	Context.LiveNodes = nullptr;
+	Context.NodeIds.Reset();
+	Context.PinIds.Reset();
+	OutNumPruned += NumPruned;
+	return GraphObj;
+}
+
+static TArray<TSharedPtr<FJsonValue>> ExportTunnelPins(const UEdGraphNode* TunnelNode, EEdGraphPinDirection Direction)
+{
+	TArray<TSharedPtr<FJsonValue>> Pins;
+	if (!TunnelNode)
+		return Pins;
+
+	for (const UEdGraphPin* Pin : TunnelNode->Pins)
+	{
+		if (!Pin || Pin->bHidden || Pin->Direction != Direction)
+			continue;
+
+		TSharedPtr<FJsonObject> PinObj = MakeShareable(new FJsonObject());
+		PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
+		PinObj->SetStringField(TEXT("type"), GetPinTypeString(Pin->PinType));
+		Pins.Add(MakeShareable(new FJsonValueObject(PinObj)));
+	}
+	return Pins;
+}
+
+// A macro graph with its tunnel pins. Instance input pins map by name to the entry node's
+// outputs, instance output pins to the exit node's inputs.
+static TSharedPtr<FJsonObject> ExportMacroGraph(const UEdGraph* MacroGraph, FBlueprintExportContext& Context, int32& OutNumPruned)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportMacroGraph);
+
+	TWeakObjectPtr<UK2Node_EditablePinBase> EntryNode;
+	TWeakObjectPtr<UK2Node_EditablePinBase> ResultNode;
+	FBlueprintEditorUtils::GetEntryAndResultNodes(MacroGraph, EntryNode, ResultNode);
+
+	// A pure macro's entry tunnel has no exec output, so its body is only reachable back from the exit
+	const UEdGraphNode* TunnelRoots[] = { EntryNode.Get(), ResultNode.Get() };
+	TSharedPtr<FJsonObject> MacroObj = ExportGraph(MacroGraph, TEXT("MacroGraph"), Context, OutNumPruned, TunnelRoots);
+	MacroObj->SetStringField(TEXT("macro_id"), MacroGraph->GetPathName());
+
+	if (const UBlueprint* OwningBlueprint = FBlueprintEditorUtils::FindBlueprintForGraph(MacroGraph))
+		MacroObj->SetStringField(TEXT("library"), OwningBlueprint->GetOutermost()->GetName());
+
+	if (EntryNode.IsValid())
+		MacroObj->SetStringField(TEXT("entry_node"), EntryNode->GetName());
+	if (ResultNode.IsValid())
+		MacroObj->SetStringField(TEXT("exit_node"), ResultNode->GetName());
+
+	MacroObj->SetArrayField(TEXT("inputs"), ExportTunnelPins(EntryNode.Get(), EGPD_Output));
+	MacroObj->SetArrayField(TEXT("outputs"), ExportTunnelPins(ResultNode.Get(), EGPD_Input));
+
+	return MacroObj;
+}
+
+// Graph summary for the manifest. The hash covers everything the full export writes for the
+// graph except node titles, so it changes whenever the exported graph would.
+static TSharedPtr<FJsonObject> BuildGraphManifest(const UEdGraph* Graph, const TCHAR* GraphType)
+{
+	int32 NumNodes = 0;
+	int32 NumPins = 0;
+	int32 NumLinks = 0;
+	FXxHash64Builder Builder;
+
+	for (const UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (!Node) continue;
+
+		NumNodes++;
+		HashString(Builder, Node->GetClass()->GetName());
+		HashString(Builder, Node->GetName());
+		HashString(Builder, Node->NodeGuid.ToString());
+		HashString(Builder, Node->NodeComment);
+
+		const bool bEnabled = Node->IsNodeEnabled();
+		Builder.Update(&bEnabled, sizeof(bEnabled));
+
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin || Pin->bHidden)
+				continue;
+
+			NumPins++;
+			HashString(Builder, Pin->PinName.ToString());
+			HashString(Builder, GetPinTypeString(Pin->PinType));
+			HashString(Builder, Pin->DefaultValue);
+			HashString(Builder, Pin->DefaultTextValue.ToString());
+			HashString(Builder, Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : FString());
+
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				if (!LinkedPin || !LinkedPin->GetOwningNode())
+					continue;
+
+				NumLinks++;
+				HashString(Builder, LinkedPin->GetOwningNode()->GetName());
+				HashString(Builder, LinkedPin->PinName.ToString());
 			}
 		}
+	}
 
-		// Property flags
-		TArray<FString> Flags;
-		if (Var.PropertyFlags & CPF_Edit) Flags.Add(TEXT("EditAnywhere"));
-		if (Var.PropertyFlags & CPF_BlueprintVisible) Flags.Add(TEXT("BlueprintVisible"));
-		if (Var.PropertyFlags & CPF_BlueprintReadOnly) Flags.Add(TEXT("BlueprintReadOnly"));
-		if (Var.PropertyFlags & CPF_ExposeOnSpawn) Flags.Add(TEXT("ExposeOnSpawn"));
-		if (Var.PropertyFlags & CPF_Interp) Flags.Add(TEXT("Interp"));
+	TSharedPtr<FJsonObject> GraphObj = MakeShareable(new FJsonObject());
+	GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+	GraphObj->SetStringField(TEXT("type"), GraphType);
+	GraphObj->SetNumberField(TEXT("node_count"), NumNodes);
+	GraphObj->SetNumberField(TEXT("pin_count"), NumPins);
+	GraphObj->SetNumberField(TEXT("link_count"), NumLinks);
+	GraphObj->SetStringField(TEXT("hash"), HashToString(Builder.Finalize()));
+	return GraphObj;
+}
+
+// Lists graphs, variables and components with sizes and hashes, without exporting any nodes
+static TSharedPtr<FJsonObject> BuildBlueprintManifest(const UBlueprint* Blueprint)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::BuildBlueprintManifest);
+
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
 
-		VarObj->SetStringField(TEXT("flags"), FString::Join(Flags, TEXT(", ")));
+	TArray<TSharedPtr<FJsonValue>> Graphs;
+	for (const UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		if (Graph)
+			Graphs.Add(MakeShareable(new FJsonValueObject(BuildGraphManifest(Graph, TEXT("EventGraph")))));
+	}
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (Graph)
+			Graphs.Add(MakeShareable(new FJsonValueObject(BuildGraphManifest(Graph, TEXT("FunctionGraph")))));
+	}
+	for (const UEdGraph* Graph : Blueprint->MacroGraphs)
+	{
+		if (Graph)
+			Graphs.Add(MakeShareable(new FJsonValueObject(BuildGraphManifest(Graph, TEXT("MacroGraph")))));
+	}
+	Root->SetArrayField(TEXT("graphs"), Graphs);
 
+	const UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+
+	TArray<TSharedPtr<FJsonValue>> Variables;
+	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+	{
+		FXxHash64Builder Builder;
+		HashString(Builder, Var.VarName.ToString());
+		HashString(Builder, GetPinTypeString(Var.VarType));
+		HashString(Builder, Var.Category.ToString());
+		HashString(Builder, Var.DefaultValue);
+		Builder.Update(&Var.PropertyFlags, sizeof(Var.PropertyFlags));
+
+		// The compiled default is what the full export reports as cdo_default_value
+		if (const FProperty* Property = CDO ? Blueprint->GeneratedClass->FindPropertyByName(Var.VarName) : nullptr)
+		{
+			FString CDOValue;
+			ExportPropertyText(Property, CDOValue, Property->ContainerPtrToValuePtr<void>(CDO));
+			HashString(Builder, CDOValue);
+		}
+
+		TSharedPtr<FJsonObject> VarObj = MakeShareable(new FJsonObject());
+		VarObj->SetStringField(TEXT("name"), Var.VarName.ToString());
+		VarObj->SetStringField(TEXT("type"), GetPinTypeString(Var.VarType));
+		VarObj->SetStringField(TEXT("hash"), HashToString(Builder.Finalize()));
 		Variables.Add(MakeShareable(new FJsonValueObject(VarObj)));
-		UE_LOG(LogTemp, Log, TEXT("  Variable: %s (%s)"), *Var.VarName.ToString(), *GetPinTypeString(Var.VarType));
 	}
 	Root->SetArrayField(TEXT("variables"), Variables);
 
-	// ---- Components ----
 	TArray<TSharedPtr<FJsonValue>> Components;
 	if (Blueprint->SimpleConstructionScript)
 	{
-		for (USCS_Node* SCSNode : Blueprint->SimpleConstructionScript->GetAllNodes())
+		for (const USCS_Node* SCSNode : Blueprint->SimpleConstructionScript->GetAllNodes())
 		{
 			if (!SCSNode || !SCSNode->ComponentTemplate)
 				continue;
 
-			TSharedPtr<FJsonObject> CompObj = MakeShareable(new FJsonObject());
-			CompObj->SetStringField(TEXT("name"), SCSNode->GetVariableName().ToString());
-			CompObj->SetStringField(TEXT("type"), SCSNode->ComponentTemplate->GetClass()->GetName());
-
-			if (SCSNode->ParentComponentOrVariableName != NAME_None)
-				CompObj->SetStringField(TEXT("attach_parent"), SCSNode->ParentComponentOrVariableName.ToString());
-
-			// Export component properties
-			TArray<TSharedPtr<FJsonValue>> Properties;
-			UObject* ComponentTemplate = SCSNode->ComponentTemplate;
-			UClass* ComponentClass = ComponentTemplate->GetClass();
+			const UObject* ComponentTemplate = SCSNode->ComponentTemplate;
+			const UObject* ComponentCDO = ComponentTemplate->GetClass()->GetDefaultObject();
 
-			// Get the CDO to compare against defaults
-			UObject* ComponentCDO = ComponentClass->GetDefaultObject();
+			FXxHash64Builder Builder;
+			HashString(Builder, SCSNode->GetVariableName().ToString());
+			HashString(Builder, ComponentTemplate->GetClass()->GetPathName());
+			HashString(Builder, SCSNode->ParentComponentOrVariableName.ToString());
 
-			for (TFieldIterator<FProperty> PropIt(ComponentClass); PropIt; ++PropIt)
+			// Same modified-property test the full export uses
+			int32 NumModified = 0;
+			for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
 			{
-				FProperty* Property = *PropIt;
-
-				// Skip properties that shouldn't be exported
+				const FProperty* Property = *PropIt;
 				if (!Property || Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
 					continue;
 
-				// Only export properties that differ from CDO defaults
-				const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(ComponentTemplate);
-				const void* DefaultPtr = Property->ContainerPtrToValuePtr<void>(ComponentCDO);
-
-				if (!Property->Identical(ValuePtr, DefaultPtr))
-				{
-					TSharedPtr<FJsonObject> PropObj = MakeShareable(new FJsonObject());
-					PropObj->SetStringField(TEXT("name"), Property->GetName());
+				if (Property->Identical_InContainer(ComponentTemplate, ComponentCDO))
+					continue;
 
-					FString ValueStr;
-					Property->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, nullptr, PPF_None);
-					PropObj->SetStringField(TEXT("value"), ValueStr);
+				FString ValueStr;
+				ExportPropertyText(Property, ValueStr, Property->ContainerPtrToValuePtr<void>(ComponentTemplate));
+				HashString(Builder, Property->GetName());
+				HashString(Builder, ValueStr);
+				NumModified++;
+			}
+
+			TSharedPtr<FJsonObject> CompObj = MakeShareable(new FJsonObject());
+			CompObj->SetStringField(TEXT("name"), SCSNode->GetVariableName().ToString());
+			CompObj->SetStringField(TEXT("type"), ComponentTemplate->GetClass()->GetName());
+			CompObj->SetNumberField(TEXT("modified_property_count"), NumModified);
+			CompObj->SetStringField(TEXT("hash"), HashToString(Builder.Finalize()));
+			Components.Add(MakeShareable(new FJsonValueObject(CompObj)));
+		}
+	}
+	Root->SetArrayField(TEXT("components"), Components);
+
+	return Root;
+}
+
+static TArray<TSharedPtr<FJsonValue>> ExportFunctionParams(const UFunction* Function)
+{
+	TArray<TSharedPtr<FJsonValue>> Params;
+	for (TFieldIterator<FProperty> PropIt(Function); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+	{
+		const FProperty* Param = *PropIt;
+
+		TSharedPtr<FJsonObject> ParamObj = MakeShareable(new FJsonObject());
+		ParamObj->SetStringField(TEXT("name"), Param->GetName());
+		ParamObj->SetStringField(TEXT("type"), GetPropertyTypeString(Param));
+
+		if (Param->HasAnyPropertyFlags(CPF_ReturnParm))
+			ParamObj->SetBoolField(TEXT("is_return"), true);
+		else if (Param->HasAnyPropertyFlags(CPF_OutParm) && !Param->HasAnyPropertyFlags(CPF_ReferenceParm))
+			ParamObj->SetBoolField(TEXT("is_out"), true);
+		else if (Param->HasAnyPropertyFlags(CPF_ReferenceParm))
+			ParamObj->SetBoolField(TEXT("is_ref"), true);
+
+		if (Param->HasAnyPropertyFlags(CPF_ConstParm))
+			ParamObj->SetBoolField(TEXT("is_const"), true);
+
+		Params.Add(MakeShareable(new FJsonValueObject(ParamObj)));
+	}
+	return Params;
+}
+
+static FString GetFunctionFlagsString(const UFunction* Function)
+{
+	TArray<FString> Flags;
+	if (Function->HasAnyFunctionFlags(FUNC_BlueprintPure)) Flags.Add(TEXT("BlueprintPure"));
+	if (Function->HasAnyFunctionFlags(FUNC_BlueprintCallable)) Flags.Add(TEXT("BlueprintCallable"));
+	if (Function->HasAnyFunctionFlags(FUNC_BlueprintEvent)) Flags.Add(TEXT("BlueprintEvent"));
+	if (Function->HasAnyFunctionFlags(FUNC_Const)) Flags.Add(TEXT("Const"));
+	if (Function->HasAnyFunctionFlags(FUNC_Static)) Flags.Add(TEXT("Static"));
+	if (Function->HasAnyFunctionFlags(FUNC_Protected)) Flags.Add(TEXT("Protected"));
+	if (Function->HasAnyFunctionFlags(FUNC_Private)) Flags.Add(TEXT("Private"));
+	if (Function->HasAnyFunctionFlags(FUNC_NetServer)) Flags.Add(TEXT("Server"));
+	if (Function->HasAnyFunctionFlags(FUNC_NetClient)) Flags.Add(TEXT("Client"));
+	if (Function->HasAnyFunctionFlags(FUNC_NetMulticast)) Flags.Add(TEXT("NetMulticast"));
+	if (Function->HasAnyFunctionFlags(FUNC_NetReliable)) Flags.Add(TEXT("Reliable"));
+
+	return FString::Join(Flags, TEXT(", "));
+}
+
+/** One entry per distinct function called from the exported graphs, in the order call nodes first reference them */
+static TArray<TSharedPtr<FJsonValue>> BuildCalledFunctionTable(const TArray<const UFunction*>& Functions)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::BuildCalledFunctionTable);
+
+	TArray<TSharedPtr<FJsonValue>> Table;
+	Table.Reserve(Functions.Num());
+	for (const UFunction* Function : Functions)
+	{
+		TSharedPtr<FJsonObject> FuncObj = MakeShareable(new FJsonObject());
+		FuncObj->SetStringField(TEXT("name"), Function->GetName());
+		if (const UClass* OwnerClass = Function->GetOwnerClass())
+			FuncObj->SetStringField(TEXT("owner_class"), OwnerClass->GetName());
+		FuncObj->SetStringField(TEXT("path"), Function->GetPathName());
+		FuncObj->SetStringField(TEXT("flags"), GetFunctionFlagsString(Function));
+		if (Function->HasAnyFunctionFlags(FUNC_Native))
+			FuncObj->SetBoolField(TEXT("is_native"), true);
+
+		// Latent actions and world context parameters are metadata, not function flags
+		if (Function->HasMetaData(FBlueprintMetadata::MD_Latent))
+			FuncObj->SetBoolField(TEXT("is_latent"), true);
+		const FString& WorldContext = Function->GetMetaData(FBlueprintMetadata::MD_WorldContext);
+		if (!WorldContext.IsEmpty())
+			FuncObj->SetStringField(TEXT("world_context_param"), WorldContext);
+
+		FuncObj->SetArrayField(TEXT("params"), ExportFunctionParams(Function));
+		Table.Add(MakeShareable(new FJsonValueObject(FuncObj)));
+	}
+	return Table;
+}
+
+/**
+ * The blueprint's shape without any graph nodes: variables, components, interfaces, dispatchers
+ * and function/event signatures. Signatures come from the skeleton class, which the editor keeps
+ * current even when the blueprint hasn't been compiled since its last edit.
+ */
+static void BuildBlueprintSignature(const UBlueprint* Blueprint, const TSharedPtr<FJsonObject>& Root)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::BuildBlueprintSignature);
+
+	const UClass* SignatureClass = Blueprint->SkeletonGeneratedClass ? Blueprint->SkeletonGeneratedClass : Blueprint->GeneratedClass;
+
+	TArray<TSharedPtr<FJsonValue>> Interfaces;
+	for (const FBPInterfaceDescription& InterfaceDesc : Blueprint->ImplementedInterfaces)
+	{
+		if (InterfaceDesc.Interface)
+			Interfaces.Add(MakeShareable(new FJsonValueString(InterfaceDesc.Interface->GetName())));
+	}
+	Root->SetArrayField(TEXT("interfaces"), Interfaces);
+
+	TArray<TSharedPtr<FJsonValue>> Variables;
+	TArray<TSharedPtr<FJsonValue>> Dispatchers;
+	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+	{
+		if (Var.VarType.PinCategory == UEdGraphSchema_K2::PC_MCDelegate)
+		{
+			TSharedPtr<FJsonObject> DispatcherObj = MakeShareable(new FJsonObject());
+			DispatcherObj->SetStringField(TEXT("name"), Var.VarName.ToString());
+
+			const FMulticastDelegateProperty* DelegateProp = SignatureClass ? FindFProperty<FMulticastDelegateProperty>(SignatureClass, Var.VarName) : nullptr;
+			if (DelegateProp && DelegateProp->SignatureFunction)
+				DispatcherObj->SetArrayField(TEXT("params"), ExportFunctionParams(DelegateProp->SignatureFunction));
+
+			Dispatchers.Add(MakeShareable(new FJsonValueObject(DispatcherObj)));
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> VarObj = MakeShareable(new FJsonObject());
+		VarObj->SetStringField(TEXT("name"), Var.VarName.ToString());
+		VarObj->SetStringField(TEXT("type"), GetPinTypeString(Var.VarType));
+		VarObj->SetStringField(TEXT("category"), Var.Category.ToString());
+		VarObj->SetStringField(TEXT("flags"), GetVariableFlagsString(Var));
+		if (Var.PropertyFlags & CPF_Net)
+			VarObj->SetBoolField(TEXT("replicated"), true);
+		if (!Var.RepNotifyFunc.IsNone())
+			VarObj->SetStringField(TEXT("rep_notify"), Var.RepNotifyFunc.ToString());
+
+		Variables.Add(MakeShareable(new FJsonValueObject(VarObj)));
+	}
+	Root->SetArrayField(TEXT("variables"), Variables);
+	Root->SetArrayField(TEXT("event_dispatchers"), Dispatchers);
+
+	TArray<TSharedPtr<FJsonValue>> Components;
+	if (Blueprint->SimpleConstructionScript)
+	{
+		for (const USCS_Node* SCSNode : Blueprint->SimpleConstructionScript->GetAllNodes())
+		{
+			if (!SCSNode || !SCSNode->ComponentClass)
+				continue;
+
+			TSharedPtr<FJsonObject> CompObj = MakeShareable(new FJsonObject());
+			CompObj->SetStringField(TEXT("name"), SCSNode->GetVariableName().ToString());
+			CompObj->SetStringField(TEXT("type"), SCSNode->ComponentClass->GetName());
+			if (SCSNode->ParentComponentOrVariableName != NAME_None)
+				CompObj->SetStringField(TEXT("attach_parent"), SCSNode->ParentComponentOrVariableName.ToString());
+
+			Components.Add(MakeShareable(new FJsonValueObject(CompObj)));
+		}
+	}
+	Root->SetArrayField(TEXT("components"), Components);
+
+	TSet<FName> FunctionGraphNames;
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (Graph)
+			FunctionGraphNames.Add(Graph->GetFName());
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Functions;
+	if (SignatureClass)
+	{
+		for (TFieldIterator<UFunction> FuncIt(SignatureClass, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
+		{
+			const UFunction* Function = *FuncIt;
+
+			// Compiler-generated: the ubergraph entry point and dispatcher signatures
+			if (Function->GetName().StartsWith(UEdGraphSchema_K2::FN_ExecuteUbergraphBase.ToString()) || Function->HasAnyFunctionFlags(FUNC_Delegate))
+				continue;
+
+			TSharedPtr<FJsonObject> FuncObj = MakeShareable(new FJsonObject());
+			FuncObj->SetStringField(TEXT("name"), Function->GetName());
+			FuncObj->SetStringField(TEXT("kind"), FunctionGraphNames.Contains(Function->GetFName()) ? TEXT("function") : TEXT("event"));
+			if (Function->GetSuperFunction())
+				FuncObj->SetBoolField(TEXT("is_override"), true);
+			FuncObj->SetStringField(TEXT("flags"), GetFunctionFlagsString(Function));
+			FuncObj->SetArrayField(TEXT("params"), ExportFunctionParams(Function));
+
+			Functions.Add(MakeShareable(new FJsonValueObject(FuncObj)));
+		}
+	}
+	Root->SetArrayField(TEXT("functions"), Functions);
+}
+
+static UEdGraph* FindBlueprintGraph(const UBlueprint* Blueprint, const FString& GraphName, const TCHAR*& OutGraphType)
+{
+	const TPair<const TArray<TObjectPtr<UEdGraph>>*, const TCHAR*> GraphLists[] =
+	{
+		{ &Blueprint->UbergraphPages, TEXT("EventGraph") },
+		{ &Blueprint->FunctionGraphs, TEXT("FunctionGraph") },
+		{ &Blueprint->MacroGraphs, TEXT("MacroGraph") },
+	};
+
+	for (const auto& GraphList : GraphLists)
+	{
+		for (UEdGraph* Graph : *GraphList.Key)
+		{
+			if (Graph && Graph->GetName() == GraphName)
+			{
+				OutGraphType = GraphList.Value;
+				return Graph;
+			}
+		}
+	}
+	return nullptr;
+}
+
+/** Graphs in export order: as stored, or by name in canonical mode */
+static TArray<UEdGraph*> GetGraphsInExportOrder(const TArray<TObjectPtr<UEdGraph>>& Graphs, bool bCanonical)
+{
+	TArray<UEdGraph*> Result;
+	for (UEdGraph* Graph : Graphs)
+	{
+		if (Graph)
+			Result.Add(Graph);
+	}
+
+	if (bCanonical)
+	{
+		Algo::StableSort(Result, [](const UEdGraph* A, const UEdGraph* B)
+		{
+			return CanonicalLess(A->GetName(), B->GetName());
+		});
+	}
+	return Result;
+}
+
+static void AppendSCSNodeCanonical(USCS_Node* Node, TArray<USCS_Node*>& OutNodes)
+{
+	OutNodes.Add(Node);
+
+	TArray<USCS_Node*> Children;
+	for (USCS_Node* Child : Node->GetChildNodes())
+	{
+		if (Child)
+			Children.Add(Child);
+	}
+	Algo::StableSort(Children, [](const USCS_Node* A, const USCS_Node* B)
+	{
+		return CanonicalLess(A->GetVariableName().ToString(), B->GetVariableName().ToString());
+	});
+
+	for (USCS_Node* Child : Children)
+		AppendSCSNodeCanonical(Child, OutNodes);
+}
+
+/**
+ * Construction script nodes, parents before children. Canonical mode visits siblings by variable name,
+ * except that the first root keeps its place when it is unattached: that is the actor's root component.
+ */
+static TArray<USCS_Node*> GetSCSNodesInExportOrder(const USimpleConstructionScript* SCS, bool bCanonical)
+{
+	if (!bCanonical)
+		return SCS->GetAllNodes();
+
+	TArray<USCS_Node*> Roots;
+	for (USCS_Node* Root : SCS->GetRootNodes())
+	{
+		if (Root)
+			Roots.Add(Root);
+	}
+
+	const int32 FirstSorted = (Roots.Num() > 0 && Roots[0]->ParentComponentOrVariableName == NAME_None) ? 1 : 0;
+	Algo::StableSort(MakeArrayView(Roots).RightChop(FirstSorted), [](const USCS_Node* A, const USCS_Node* B)
+	{
+		return CanonicalLess(A->GetVariableName().ToString(), B->GetVariableName().ToString());
+	});
+
+	TArray<USCS_Node*> Result;
+	for (USCS_Node* Root : Roots)
+		AppendSCSNodeCanonical(Root, Result);
+	return Result;
+}
+
+static thread_local FScopedJsonExportCapture* ActiveJsonExportCapture = nullptr;
+
+FScopedJsonExportCapture::FScopedJsonExportCapture()
+	: Previous(ActiveJsonExportCapture)
+{
+	ActiveJsonExportCapture = this;
+}
+
+FScopedJsonExportCapture::~FScopedJsonExportCapture()
+{
+	ActiveJsonExportCapture = Previous;
+}
+
+static bool SaveJsonToFile(const TSharedPtr<FJsonObject>& Root, const FString& OutputPath)
+{
+	FString OutputString;
+	{
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::SerializeJson);
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+		FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+	}
+
+	if (FScopedJsonExportCapture* Capture = ActiveJsonExportCapture)
+	{
+		FTCHARToUTF8 Utf8(*OutputString);
+		Capture->Json.Reset(Utf8.Length());
+		Capture->Json.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		Capture->bCaptured = true;
+		return true;
+	}
+
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::WriteFile);
+	if (!FFileHelper::SaveStringToFile(OutputString, *OutputPath))
+		return false;
+
+	// The encoding is picked per file (ANSI or UTF-16), so ask the file system for the size
+	BLUEPRINT_EXPORTER_TRACE_COUNT(BlueprintExporter_BytesWritten, IFileManager::Get().FileSize(*OutputPath));
+	return true;
+}
+
+bool UBlueprintExporterBPLibrary::ExportBlueprintToJson(const FString& BlueprintPath, const FString& OutputPath)
+{
+	return ExportBlueprintToJsonWithOptions(BlueprintPath, FBlueprintExportOptions(), OutputPath);
+}
+
+bool UBlueprintExporterBPLibrary::ExportBlueprintToJsonWithOptions(const FString& BlueprintPath, const FBlueprintExportOptions& Options, const FString& OutputPath)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportBlueprintToJson);
+
+	// Load the blueprint
+	UBlueprint* Blueprint = nullptr;
+	{
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::LoadObject);
+		Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	}
+	if (!Blueprint)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load blueprint at %s"), *BlueprintPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded %s"), *Blueprint->GetName());
+
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+
+	Root->SetStringField(TEXT("name"), Blueprint->GetName());
+	Root->SetStringField(TEXT("blueprint_path"), BlueprintPath);
+
+	// Parent class
+	if (Blueprint->ParentClass)
+		Root->SetStringField(TEXT("parent_class"), Blueprint->ParentClass->GetName());
+
+	FString FinalOutputPath = OutputPath;
+	if (FinalOutputPath.IsEmpty())
+	{
+		FString BPName = FPaths::GetBaseFilename(BlueprintPath);
+		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), BPName + TEXT(".json"));
+	}
+
+	// ---- Manifest only ----
+	if (Options.bManifest)
+	{
+		TSharedPtr<FJsonObject> Manifest = BuildBlueprintManifest(Blueprint);
+		Root->SetBoolField(TEXT("manifest"), true);
+		Root->SetArrayField(TEXT("graphs"), Manifest->GetArrayField(TEXT("graphs")));
+		Root->SetArrayField(TEXT("variables"), Manifest->GetArrayField(TEXT("variables")));
+		Root->SetArrayField(TEXT("components"), Manifest->GetArrayField(TEXT("components")));
+		if (Options.bCanonical)
+			SortJsonArrayFields(Root, { TEXT("graphs"), TEXT("variables"), TEXT("components") });
+
+		if (SaveJsonToFile(Root, FinalOutputPath))
+		{
+			UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported manifest to %s"), *FinalOutputPath);
+			return true;
+		}
+
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write file %s"), *FinalOutputPath);
+		return false;
+	}
+
+	// ---- Signature only ----
+	if (Options.Level == EBlueprintExportLevel::Signature)
+	{
+		Root->SetStringField(TEXT("level"), TEXT("signature"));
+		BuildBlueprintSignature(Blueprint, Root);
+		if (Options.bCanonical)
+			SortJsonArrayFields(Root, { TEXT("interfaces"), TEXT("variables"), TEXT("event_dispatchers"), TEXT("components"), TEXT("functions") });
+
+		if (SaveJsonToFile(Root, FinalOutputPath))
+		{
+			UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported signature to %s"), *FinalOutputPath);
+			return true;
+		}
+
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write file %s"), *FinalOutputPath);
+		return false;
+	}
+
+	// ---- Single graph ----
+	if (!Options.GraphName.IsEmpty())
+	{
+		const TCHAR* GraphType = nullptr;
+		UEdGraph* Graph = FindBlueprintGraph(Blueprint, Options.GraphName, GraphType);
+		if (!Graph)
+		{
+			UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: No graph named %s in %s"), *Options.GraphName, *BlueprintPath);
+			return false;
+		}
+
+		FBlueprintExportContext Context(Options);
+		int32 NumPruned = 0;
+
+		TArray<TSharedPtr<FJsonValue>> Graphs;
+		TArray<TSharedPtr<FJsonValue>> Macros;
+		if (Blueprint->MacroGraphs.Contains(Graph))
+			Macros.Add(MakeShareable(new FJsonValueObject(ExportMacroGraph(Graph, Context, NumPruned))));
+		else
+			Graphs.Add(MakeShareable(new FJsonValueObject(ExportGraph(Graph, GraphType, Context, NumPruned))));
+
+		Root->SetArrayField(TEXT("graphs"), Graphs);
+		if (Macros.Num() > 0)
+			Root->SetArrayField(TEXT("macros"), Macros);
+
+		if (Options.bPrune)
+			Root->SetNumberField(TEXT("pruned_node_count"), NumPruned);
+
+		if (Options.bFunctionTable)
+			Root->SetArrayField(TEXT("called_functions"), BuildCalledFunctionTable(Context.CalledFunctions));
+
+		if (SaveJsonToFile(Root, FinalOutputPath))
+		{
+			UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported %s %s to %s"), GraphType, *Graph->GetName(), *FinalOutputPath);
+			return true;
+		}
+
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write file %s"), *FinalOutputPath);
+		return false;
+	}
+
+	// ---- Class Default Values ----
+	// Export CDO properties that differ from parent class defaults
+	TArray<TSharedPtr<FJsonValue>> ClassDefaults;
+
+	if (Blueprint->GeneratedClass && Blueprint->ParentClass)
+	{
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ClassDefaults);
+
+		UObject* ClassCDO = Blueprint->GeneratedClass->GetDefaultObject();
+		UObject* ParentCDO = Blueprint->ParentClass->GetDefaultObject();
+
+		if (ClassCDO && ParentCDO)
+		{
+			// Get list of blueprint variable names to skip (handled separately)
+			TSet<FName> BlueprintVariableNames;
+			for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+			{
+				BlueprintVariableNames.Add(Var.VarName);
+			}
+
+			for (TFieldIterator<FProperty> PropIt(Blueprint->GeneratedClass); PropIt; ++PropIt)
+			{
+				FProperty* Property = *PropIt;
+
+				// Skip transient properties
+				if (!Property || Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+					continue;
+
+				// Skip blueprint variables (handled in variables section)
+				if (BlueprintVariableNames.Contains(Property->GetFName()))
+					continue;
+
+				// Skip component properties (handled in components section)
+				if (CastField<FObjectProperty>(Property) && Property->GetName().StartsWith(TEXT("K2Node_")))
+					continue;
+
+				// Only export if property exists in parent class and differs
+				FProperty* ParentProperty = Blueprint->ParentClass->FindPropertyByName(Property->GetFName());
+				if (!ParentProperty)
+					continue;
+
+				const void* ChildValue = Property->ContainerPtrToValuePtr<void>(ClassCDO);
+				const void* ParentValue = ParentProperty->ContainerPtrToValuePtr<void>(ParentCDO);
+
+				// Compare values - only export if different
+				if (!Property->Identical(ChildValue, ParentValue))
+				{
+					TSharedPtr<FJsonObject> DefaultObj = MakeShareable(new FJsonObject());
+					DefaultObj->SetStringField(TEXT("name"), Property->GetName());
+
+					const FBoundedPropertyValue Value = ExportBoundedPropertyValue(Property, ClassCDO, Options.MaxContainerElements, Options.bTypedValues);
+					const FString& ValueStr = Value.Text;
+					DefaultObj->SetStringField(TEXT("value"), ValueStr);
+					if (Options.bTypedValues)
+						DefaultObj->SetField(TEXT("typed_value"), Value.Typed);
+					AddContainerContinuation(DefaultObj, Value, BlueprintPath, Property->GetName(), Options);
 
 					// Get property type
 					FString TypeStr;
@@ -609,7 +1844,225 @@ bool UBlueprintExporterBPLibrary::ExportBlueprintToJson(const FString& Blueprint
 
 						// Add struct source information
 						FString StructSource = GetStructSource(StructProp);
-						PropObj->SetStringField(TEXT("struct_source"), StructSource);
+						DefaultObj->SetStringField(TEXT("struct_source"), StructSource);
+
+						if (StructSource == TEXT("blueprint") && IsUserDefinedStruct(ValueStr))
+						{
+							FString StructName = ExtractBlueprintPath(ValueStr);
+							if (!StructName.IsEmpty())
+							{
+								DefaultObj->SetStringField(TEXT("struct_reference"), StructName);
+								DefaultObj->SetBoolField(TEXT("is_struct_reference"), true);
+							}
+						}
+					}
+					else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
+						TypeStr = ObjProp->PropertyClass->GetName();
+					else if (FClassProperty* ClassProp = CastField<FClassProperty>(Property))
+						TypeStr = FString::Printf(TEXT("TSubclassOf<%s>"), *ClassProp->MetaClass->GetName());
+					else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+					{
+						if (UEnum* Enum = EnumProp->GetEnum())
+							TypeStr = Enum->GetName();
+						else
+							TypeStr = TEXT("uint8");
+					}
+					else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+					{
+						if (ByteProp->Enum)
+							TypeStr = ByteProp->Enum->GetName();
+						else
+							TypeStr = TEXT("uint8");
+					}
+					else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+						TypeStr = TEXT("bool");
+					else
+						TypeStr = Property->GetCPPType();
+
+					DefaultObj->SetStringField(TEXT("type"), TypeStr);
+
+					// Check if this is a blueprint reference
+					if (IsBlueprintReference(ValueStr))
+					{
+						FString BPName = ExtractBlueprintPath(ValueStr);
+						if (!BPName.IsEmpty())
+						{
+							DefaultObj->SetStringField(TEXT("blueprint_reference"), BPName);
+							DefaultObj->SetBoolField(TEXT("is_blueprint_reference"), true);
+						}
+					}
+
+					ClassDefaults.Add(MakeShareable(new FJsonValueObject(DefaultObj)));
+					UE_LOG(LogTemp, Log, TEXT("  Class Default: %s = %s"), *Property->GetName(), *ValueStr);
+				}
+			}
+		}
+	}
+
+	if (ClassDefaults.Num() > 0)
+	{
+		Root->SetArrayField(TEXT("class_defaults"), ClassDefaults);
+		UE_LOG(LogTemp, Log, TEXT("  Exported %d class default values"), ClassDefaults.Num());
+	}
+
+	// ---- Variables ----
+	TArray<TSharedPtr<FJsonValue>> Variables;
+
+	// Get CDO (Class Default Object) to extract actual default values
+	UObject* CDO = nullptr;
+	if (Blueprint->GeneratedClass)
+	{
+		CDO = Blueprint->GeneratedClass->GetDefaultObject();
+	}
+
+	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+	{
+		TSharedPtr<FJsonObject> VarObj = MakeShareable(new FJsonObject());
+		VarObj->SetStringField(TEXT("name"), Var.VarName.ToString());
+		VarObj->SetStringField(TEXT("type"), GetPinTypeString(Var.VarType));
+		VarObj->SetStringField(TEXT("category"), Var.Category.ToString());
+		VarObj->SetStringField(TEXT("default_value"), Var.DefaultValue);
+		VarObj->SetStringField(TEXT("friendly_name"), Var.FriendlyName);
+
+		// Extract actual default value from CDO
+		if (CDO && Blueprint->GeneratedClass)
+		{
+			FProperty* Property = Blueprint->GeneratedClass->FindPropertyByName(Var.VarName);
+			if (Property)
+			{
+				// Add struct source information for struct properties
+				if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+				{
+					FString StructSource = GetStructSource(StructProp);
+					VarObj->SetStringField(TEXT("struct_source"), StructSource);
+				}
+
+				// Add enum source information for enum properties
+				UEnum* VarEnum = nullptr;
+				if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+					VarEnum = EnumProp->GetEnum();
+				else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+					VarEnum = ByteProp->Enum;
+
+				if (VarEnum)
+				{
+					VarObj->SetBoolField(TEXT("is_enum"), true);
+					VarObj->SetStringField(TEXT("enum_name"), VarEnum->GetName());
+					// Check if it's a UserDefinedEnum (blueprint enum)
+					if (Cast<UUserDefinedEnum>(VarEnum))
+					{
+						VarObj->SetStringField(TEXT("enum_source"), TEXT("blueprint"));
+						VarObj->SetStringField(TEXT("enum_path"), VarEnum->GetPathName());
+					}
+					else
+					{
+						VarObj->SetStringField(TEXT("enum_source"), TEXT("cpp"));
+					}
+				}
+
+				const FBoundedPropertyValue CDODefault = ExportBoundedPropertyValue(Property, CDO, Options.MaxContainerElements, Options.bTypedValues);
+				const FString& CDOValue = CDODefault.Text;
+
+				if (Options.bTypedValues)
+					VarObj->SetField(TEXT("typed_cdo_default_value"), CDODefault.Typed);
+				AddContainerContinuation(VarObj, CDODefault, BlueprintPath, Property->GetName(), Options);
+
+				if (!CDOValue.IsEmpty())
+				{
+					VarObj->SetStringField(TEXT("cdo_default_value"), CDOValue);
+
+					// Check if this is a blueprint reference
+					if (IsBlueprintReference(CDOValue))
+					{
+						FString BPName = ExtractBlueprintPath(CDOValue);
+						if (!BPName.IsEmpty())
+						{
+							VarObj->SetStringField(TEXT("blueprint_reference"), BPName);
+							VarObj->SetBoolField(TEXT("is_blueprint_reference"), true);
+						}
+					}
+
+					// Check if this is a user-defined struct reference
+					if (IsUserDefinedStruct(CDOValue))
+					{
+						FString StructName = ExtractBlueprintPath(CDOValue);
+						if (!StructName.IsEmpty())
+						{
+							VarObj->SetStringField(TEXT("struct_reference"), StructName);
+							VarObj->SetBoolField(TEXT("is_struct_reference"), true);
+						}
+					}
+				}
+			}
+		}
+
+		// Property flags
+		VarObj->SetStringField(TEXT("flags"), GetVariableFlagsString(Var));
+
+		Variables.Add(MakeShareable(new FJsonValueObject(VarObj)));
+		UE_LOG(LogTemp, Log, TEXT("  Variable: %s (%s)"), *Var.VarName.ToString(), *GetPinTypeString(Var.VarType));
+	}
+	Root->SetArrayField(TEXT("variables"), Variables);
+
+	// ---- Components ----
+	TArray<TSharedPtr<FJsonValue>> Components;
+	if (Blueprint->SimpleConstructionScript)
+	{
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::Components);
+
+		for (USCS_Node* SCSNode : GetSCSNodesInExportOrder(Blueprint->SimpleConstructionScript, Options.bCanonical))
+		{
+			if (!SCSNode || !SCSNode->ComponentTemplate)
+				continue;
+
+			TSharedPtr<FJsonObject> CompObj = MakeShareable(new FJsonObject());
+			CompObj->SetStringField(TEXT("name"), SCSNode->GetVariableName().ToString());
+			CompObj->SetStringField(TEXT("type"), SCSNode->ComponentTemplate->GetClass()->GetName());
+
+			if (SCSNode->ParentComponentOrVariableName != NAME_None)
+				CompObj->SetStringField(TEXT("attach_parent"), SCSNode->ParentComponentOrVariableName.ToString());
+
+			// Export component properties
+			TArray<TSharedPtr<FJsonValue>> Properties;
+			UObject* ComponentTemplate = SCSNode->ComponentTemplate;
+			UClass* ComponentClass = ComponentTemplate->GetClass();
+
+			// Get the CDO to compare against defaults
+			UObject* ComponentCDO = ComponentClass->GetDefaultObject();
+
+			for (TFieldIterator<FProperty> PropIt(ComponentClass); PropIt; ++PropIt)
+			{
+				FProperty* Property = *PropIt;
+
+				// Skip properties that shouldn't be exported
+				if (!Property || Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+					continue;
+
+				// Only export properties that differ from CDO defaults
+				const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(ComponentTemplate);
+				const void* DefaultPtr = Property->ContainerPtrToValuePtr<void>(ComponentCDO);
+
+				if (!Property->Identical(ValuePtr, DefaultPtr))
+				{
+					TSharedPtr<FJsonObject> PropObj = MakeShareable(new FJsonObject());
+					PropObj->SetStringField(TEXT("name"), Property->GetName());
+
+					const FBoundedPropertyValue Value = ExportBoundedPropertyValue(Property, ComponentTemplate, Options.MaxContainerElements, Options.bTypedValues);
+					const FString& ValueStr = Value.Text;
+					PropObj->SetStringField(TEXT("value"), ValueStr);
+					if (Options.bTypedValues)
+						PropObj->SetField(TEXT("typed_value"), Value.Typed);
+					AddContainerContinuation(PropObj, Value, BlueprintPath, SCSNode->GetVariableName().ToString() + TEXT(".") + Property->GetName(), Options);
+
+					// Get property type
+					FString TypeStr;
+					if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+					{
+						TypeStr = StructProp->Struct->GetName();
+
+						// Add struct source information
+						FString StructSource = GetStructSource(StructProp);
+						PropObj->SetStringField(TEXT("struct_source"), StructSource);
 
 						// If it's a blueprint struct, check if value contains the path
 						if (StructSource == TEXT("blueprint") && IsUserDefinedStruct(ValueStr))
@@ -643,291 +2096,891 @@ bool UBlueprintExporterBPLibrary::ExportBlueprintToJson(const FString& Blueprint
 					else
 						TypeStr = Property->GetCPPType();
 
-					PropObj->SetStringField(TEXT("type"), TypeStr);
+					PropObj->SetStringField(TEXT("type"), TypeStr);
+
+					// Check if this is a blueprint reference
+					if (IsBlueprintReference(ValueStr))
+					{
+						FString BPName = ExtractBlueprintPath(ValueStr);
+						if (!BPName.IsEmpty())
+						{
+							PropObj->SetStringField(TEXT("blueprint_reference"), BPName);
+							PropObj->SetBoolField(TEXT("is_blueprint_reference"), true);
+						}
+					}
+
+					Properties.Add(MakeShareable(new FJsonValueObject(PropObj)));
+				}
+			}
+
+			if (Options.bCanonical)
+				SortJsonValues(Properties);
+			if (Properties.Num() > 0)
+				CompObj->SetArrayField(TEXT("properties"), Properties);
+
+			Components.Add(MakeShareable(new FJsonValueObject(CompObj)));
+			UE_LOG(LogTemp, Log, TEXT("  Component: %s (%s) - %d modified properties"),
+				*SCSNode->GetVariableName().ToString(),
+				*SCSNode->ComponentTemplate->GetClass()->GetName(),
+				Properties.Num());
+		}
+	}
+	Root->SetArrayField(TEXT("components"), Components);
+
+	// ---- Event Dispatchers ----
+	TArray<TSharedPtr<FJsonValue>> Dispatchers;
+	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+	{
+		if (Var.VarType.PinCategory == UEdGraphSchema_K2::PC_MCDelegate)
+		{
+			Dispatchers.Add(MakeShareable(new FJsonValueString(Var.VarName.ToString())));
+		}
+	}
+	Root->SetArrayField(TEXT("event_dispatchers"), Dispatchers);
+
+	// ---- Graphs ----
+	TArray<TSharedPtr<FJsonValue>> Graphs;
+
+	FBlueprintExportContext Context(Options);
+	int32 NumPruned = 0;
+
+	// Event Graphs (UberGraphPages)
+	for (UEdGraph* Graph : GetGraphsInExportOrder(Blueprint->UbergraphPages, Options.bCanonical))
+	{
+		Graphs.Add(MakeShareable(new FJsonValueObject(ExportGraph(Graph, TEXT("EventGraph"), Context, NumPruned))));
+		UE_LOG(LogTemp, Log, TEXT("  EventGraph: %s (%d nodes)"), *Graph->GetName(), Graph->Nodes.Num());
+	}
+
+	// Function Graphs
+	for (UEdGraph* Graph : GetGraphsInExportOrder(Blueprint->FunctionGraphs, Options.bCanonical))
+	{
+		Graphs.Add(MakeShareable(new FJsonValueObject(ExportGraph(Graph, TEXT("FunctionGraph"), Context, NumPruned))));
+		UE_LOG(LogTemp, Log, TEXT("  FunctionGraph: %s (%d nodes)"), *Graph->GetName(), Graph->Nodes.Num());
+	}
+
+	Root->SetArrayField(TEXT("graphs"), Graphs);
+
+	// Macros local to this blueprint; library macros are in the macro library export
+	TArray<TSharedPtr<FJsonValue>> Macros;
+	for (UEdGraph* Graph : GetGraphsInExportOrder(Blueprint->MacroGraphs, Options.bCanonical))
+	{
+		Macros.Add(MakeShareable(new FJsonValueObject(ExportMacroGraph(Graph, Context, NumPruned))));
+	}
+	if (Macros.Num() > 0)
+		Root->SetArrayField(TEXT("macros"), Macros);
+
+	if (Options.bPrune)
+		Root->SetNumberField(TEXT("pruned_node_count"), NumPruned);
+
+	if (Options.bFunctionTable)
+		Root->SetArrayField(TEXT("called_functions"), BuildCalledFunctionTable(Context.CalledFunctions));
+
+	if (Options.bCanonical)
+		SortJsonArrayFields(Root, { TEXT("class_defaults"), TEXT("variables"), TEXT("event_dispatchers") });
+
+	// ---- Write JSON ----
+	if (SaveJsonToFile(Root, FinalOutputPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported to %s"), *FinalOutputPath);
+		UE_LOG(LogTemp, Log, TEXT("  Variables: %d"), Variables.Num());
+		UE_LOG(LogTemp, Log, TEXT("  Components: %d"), Components.Num());
+		UE_LOG(LogTemp, Log, TEXT("  Graphs: %d"), Graphs.Num());
+		if (Options.bPrune)
+			UE_LOG(LogTemp, Log, TEXT("  Pruned nodes: %d"), NumPruned);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write file %s"), *FinalOutputPath);
+	return false;
+}
+
+TSharedPtr<FJsonObject> ExportContainerPropertyPage(const FString& BlueprintPath, const FString& PropertyName, int32 Offset, int32 Limit, bool bTypedValues, FString& OutError)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportContainerPropertyPage);
+
+	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	if (!Blueprint || !Blueprint->GeneratedClass)
+	{
+		OutError = FString::Printf(TEXT("Could not load blueprint at %s"), *BlueprintPath);
+		return nullptr;
+	}
+
+	// "Component.Property" is a construction script component's property, anything else a class default
+	const UObject* Container = Blueprint->GeneratedClass->GetDefaultObject();
+	FString ComponentName;
+	FString MemberName = PropertyName;
+	if (PropertyName.Split(TEXT("."), &ComponentName, &MemberName))
+	{
+		Container = nullptr;
+		if (Blueprint->SimpleConstructionScript)
+		{
+			for (const USCS_Node* SCSNode : Blueprint->SimpleConstructionScript->GetAllNodes())
+			{
+				if (SCSNode && SCSNode->ComponentTemplate && SCSNode->GetVariableName().ToString() == ComponentName)
+				{
+					Container = SCSNode->ComponentTemplate;
+					break;
+				}
+			}
+		}
+
+		if (!Container)
+		{
+			OutError = FString::Printf(TEXT("No component '%s' in %s"), *ComponentName, *BlueprintPath);
+			return nullptr;
+		}
+	}
+
+	const FProperty* Property = FindFProperty<FProperty>(Container->GetClass(), *MemberName);
+	if (!Property)
+	{
+		OutError = FString::Printf(TEXT("No property '%s' in %s"), *PropertyName, *BlueprintPath);
+		return nullptr;
+	}
+
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Container);
+	const int32 NumElements = GetContainerNum(Property, ValuePtr);
+	if (NumElements == INDEX_NONE)
+	{
+		OutError = FString::Printf(TEXT("'%s' is not an array, set or map property"), *PropertyName);
+		return nullptr;
+	}
+
+	const int32 FirstElement = FMath::Min(Offset, NumElements);
+	const int32 NumRemaining = NumElements - FirstElement;
+	const int32 NumInPage = Limit > 0 ? FMath::Min(Limit, NumRemaining) : NumRemaining;
+
+	TArray<FString> ElementText;
+	TArray<TSharedPtr<FJsonValue>> TypedElements;
+	ContainerElementsToJson(Property, ValuePtr, FirstElement, NumInPage, ElementText, bTypedValues ? &TypedElements : nullptr);
+
+	TArray<TSharedPtr<FJsonValue>> Values;
+	for (const FString& Text : ElementText)
+		Values.Add(MakeShareable(new FJsonValueString(Text)));
+
+	TSharedPtr<FJsonObject> PageObj = MakeShareable(new FJsonObject());
+	PageObj->SetStringField(TEXT("path"), BlueprintPath);
+	PageObj->SetStringField(TEXT("name"), PropertyName);
+	PageObj->SetStringField(TEXT("type"), GetPropertyTypeString(Property));
+	PageObj->SetNumberField(TEXT("element_count"), NumElements);
+	PageObj->SetNumberField(TEXT("offset"), FirstElement);
+	PageObj->SetNumberField(TEXT("count"), ElementText.Num());
+	PageObj->SetArrayField(TEXT("values"), Values);
+	if (bTypedValues)
+		PageObj->SetArrayField(TEXT("typed_values"), TypedElements);
+
+	const int32 NextElement = FirstElement + ElementText.Num();
+	if (NextElement < NumElements)
+	{
+		PageObj->SetNumberField(TEXT("next_offset"), NextElement);
+		PageObj->SetStringField(TEXT("continuation"), MakePropertyPageRequest(BlueprintPath, PropertyName, NextElement, Limit, bTypedValues));
+	}
+
+	return PageObj;
+}
+
+/** Field names, types and defaults; DefaultInstance may be null when the struct has none to read */
+static TArray<TSharedPtr<FJsonValue>> BuildStructFieldsJson(const TArray<FProperty*>& Properties, const void* DefaultInstance, bool bTypedValues)
+{
+	TArray<TSharedPtr<FJsonValue>> Fields;
+	for (FProperty* Property : Properties)
+	{
+		TSharedPtr<FJsonObject> FieldObj = MakeShareable(new FJsonObject());
+		FieldObj->SetStringField(TEXT("name"), Property->GetName());
+
+		// Get property type
+		FString TypeStr;
+		if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		{
+			TypeStr = StructProp->Struct->GetName();
+			FString StructSource = GetStructSource(StructProp);
+			FieldObj->SetStringField(TEXT("struct_source"), StructSource);
+		}
+		else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
+			TypeStr = ObjProp->PropertyClass->GetName();
+		else if (FClassProperty* ClassProp = CastField<FClassProperty>(Property))
+			TypeStr = FString::Printf(TEXT("TSubclassOf<%s>"), *ClassProp->MetaClass->GetName());
+		else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+		{
+			if (UEnum* Enum = EnumProp->GetEnum())
+				TypeStr = Enum->GetName();
+			else
+				TypeStr = TEXT("uint8");
+		}
+		else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+		{
+			if (ByteProp->Enum)
+				TypeStr = ByteProp->Enum->GetName();
+			else
+				TypeStr = TEXT("uint8");
+		}
+		else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		{
+			FProperty* InnerProp = ArrayProp->Inner;
+			if (FStructProperty* InnerStructProp = CastField<FStructProperty>(InnerProp))
+				TypeStr = FString::Printf(TEXT("TArray<%s>"), *InnerStructProp->Struct->GetName());
+			else
+				TypeStr = FString::Printf(TEXT("TArray<%s>"), *InnerProp->GetCPPType());
+		}
+		else
+			TypeStr = Property->GetCPPType();
+
+		FieldObj->SetStringField(TEXT("type"), TypeStr);
+
+		// Get default value from struct's default instance
+		if (DefaultInstance)
+		{
+			const void* DefaultValuePtr = Property->ContainerPtrToValuePtr<void>(DefaultInstance);
+			FString DefaultValueStr;
+			ExportPropertyText(Property, DefaultValueStr, DefaultValuePtr);
+			if (!DefaultValueStr.IsEmpty())
+			{
+				FieldObj->SetStringField(TEXT("default_value"), DefaultValueStr);
+			}
+			if (bTypedValues)
+			{
+				FieldObj->SetField(TEXT("typed_default_value"), PropertyToJson_InContainer(Property, DefaultInstance));
+			}
+		}
+
+		Fields.Add(MakeShareable(new FJsonValueObject(FieldObj)));
+	}
+
+	return Fields;
+}
+
+static TSharedPtr<FJsonObject> BuildStructJson(const UUserDefinedStruct* Struct, const FString& StructPath, bool bTypedValues = false)
+{
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+
+	Root->SetStringField(TEXT("name"), Struct->GetName());
+	Root->SetStringField(TEXT("struct_path"), StructPath);
+	Root->SetStringField(TEXT("struct_type"), TEXT("UserDefinedStruct"));
+
+	// Export struct fields
+	TArray<FProperty*> Properties;
+	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+		Properties.Add(*PropIt);
+
+	Root->SetArrayField(TEXT("fields"), BuildStructFieldsJson(Properties, Struct->GetDefaultInstance(), bTypedValues));
+	return Root;
+}
+
+static TSharedPtr<FJsonObject> BuildEnumJson(const UEnum* Enum, const FString& EnumPath)
+{
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+
+	Root->SetStringField(TEXT("name"), Enum->GetName());
+	Root->SetStringField(TEXT("enum_path"), EnumPath);
+	Root->SetStringField(TEXT("enum_type"), TEXT("UserDefinedEnum"));
+
+	// Export enum values
+	TArray<TSharedPtr<FJsonValue>> Values;
+	int32 MaxIndex = Enum->NumEnums();
+
+	for (int32 i = 0; i < MaxIndex; i++)
+	{
+		// Skip the _MAX entry that UE auto-generates
+		FString Name = Enum->GetNameStringByIndex(i);
+		if (Name.EndsWith(TEXT("_MAX")))
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> EntryObj = MakeShareable(new FJsonObject());
+		EntryObj->SetStringField(TEXT("name"), Name);
+		EntryObj->SetNumberField(TEXT("value"), static_cast<double>(Enum->GetValueByIndex(i)));
+
+		// Get the display name (user-friendly name set in editor)
+		FText DisplayName = Enum->GetDisplayNameTextByIndex(i);
+		EntryObj->SetStringField(TEXT("display_name"), DisplayName.ToString());
+
+		Values.Add(MakeShareable(new FJsonValueObject(EntryObj)));
+	}
+
+	Root->SetArrayField(TEXT("values"), Values);
+	return Root;
+}
+
+bool UBlueprintExporterBPLibrary::ExportStructToJson(const FString& StructPath, const FString& OutputPath, bool bTypedValues)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportStructToJson);
+
+	// Load the struct
+	UUserDefinedStruct* Struct = LoadObject<UUserDefinedStruct>(nullptr, *StructPath);
+	if (!Struct)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load struct at %s"), *StructPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded struct %s"), *Struct->GetName());
+
+	TSharedPtr<FJsonObject> Root = BuildStructJson(Struct, StructPath, bTypedValues);
+
+	const TArray<TSharedPtr<FJsonValue>>& Fields = Root->GetArrayField(TEXT("fields"));
+	for (const TSharedPtr<FJsonValue>& Field : Fields)
+	{
+		const TSharedPtr<FJsonObject>& FieldObj = Field->AsObject();
+		UE_LOG(LogTemp, Log, TEXT("  Field: %s (%s)"), *FieldObj->GetStringField(TEXT("name")), *FieldObj->GetStringField(TEXT("type")));
+	}
+
+	// Write JSON
+	FString FinalOutputPath = OutputPath;
+	if (FinalOutputPath.IsEmpty())
+	{
+		FString StructName = FPaths::GetBaseFilename(StructPath);
+		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), StructName + TEXT("_struct.json"));
+	}
+
+	if (SaveJsonToFile(Root, FinalOutputPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported struct to %s"), *FinalOutputPath);
+		UE_LOG(LogTemp, Log, TEXT("  Fields: %d"), Fields.Num());
+		return true;
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write struct file %s"), *FinalOutputPath);
+	return false;
+}
+
+bool UBlueprintExporterBPLibrary::ExportEnumToJson(const FString& EnumPath, const FString& OutputPath)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportEnumToJson);
+
+	// Load the enum
+	UUserDefinedEnum* Enum = LoadObject<UUserDefinedEnum>(nullptr, *EnumPath);
+	if (!Enum)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load enum at %s"), *EnumPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded enum %s"), *Enum->GetName());
+
+	TSharedPtr<FJsonObject> Root = BuildEnumJson(Enum, EnumPath);
+
+	const TArray<TSharedPtr<FJsonValue>>& Values = Root->GetArrayField(TEXT("values"));
+	for (const TSharedPtr<FJsonValue>& Value : Values)
+	{
+		const TSharedPtr<FJsonObject>& EntryObj = Value->AsObject();
+		UE_LOG(LogTemp, Log, TEXT("  Entry: %s = %lld (Display: %s)"), *EntryObj->GetStringField(TEXT("name")), static_cast<int64>(EntryObj->GetNumberField(TEXT("value"))), *EntryObj->GetStringField(TEXT("display_name")));
+	}
+
+	// Write JSON
+	FString FinalOutputPath = OutputPath;
+	if (FinalOutputPath.IsEmpty())
+	{
+		FString EnumName = FPaths::GetBaseFilename(EnumPath);
+		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), EnumName + TEXT("_enum.json"));
+	}
+
+	if (SaveJsonToFile(Root, FinalOutputPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported enum to %s"), *FinalOutputPath);
+		UE_LOG(LogTemp, Log, TEXT("  Values: %d"), Values.Num());
+		return true;
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write enum file %s"), *FinalOutputPath);
+	return false;
+}
+
+static const TCHAR* GetBlueprintStatusString(const EBlueprintStatus Status)
+{
+	switch (Status)
+	{
+	case BS_UpToDate:             return TEXT("up_to_date");
+	case BS_UpToDateWithWarnings: return TEXT("up_to_date_with_warnings");
+	case BS_Dirty:                return TEXT("dirty");
+	case BS_Error:                return TEXT("error");
+	case BS_BeingCreated:         return TEXT("being_created");
+	default:                      return TEXT("unknown");
+	}
+}
+
+bool UBlueprintExporterBPLibrary::ExportBlueprintBytecodeToJson(const FString& BlueprintPath, const FString& OutputPath)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportBlueprintBytecodeToJson);
+
+	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	if (!Blueprint)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load blueprint at %s"), *BlueprintPath);
+		return false;
+	}
 
-					// Check if this is a blueprint reference
-					if (IsBlueprintReference(ValueStr))
-					{
-						FString BPName = ExtractBlueprintPath(ValueStr);
-						if (!BPName.IsEmpty())
-						{
-							PropObj->SetStringField(TEXT("blueprint_reference"), BPName);
-							PropObj->SetBoolField(TEXT("is_blueprint_reference"), true);
-						}
-					}
+	UClass* GeneratedClass = Blueprint->GeneratedClass;
+	if (!GeneratedClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Blueprint %s has no generated class"), *Blueprint->GetName());
+		return false;
+	}
 
-					Properties.Add(MakeShareable(new FJsonValueObject(PropObj)));
-				}
-			}
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded blueprint %s"), *Blueprint->GetName());
 
-			if (Properties.Num() > 0)
-				CompObj->SetArrayField(TEXT("properties"), Properties);
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	Root->SetStringField(TEXT("name"), Blueprint->GetName());
+	Root->SetStringField(TEXT("path"), BlueprintPath);
+	Root->SetStringField(TEXT("generated_class"), GeneratedClass->GetPathName());
+	Root->SetStringField(TEXT("status"), GetBlueprintStatusString(Blueprint->Status));
 
-			Components.Add(MakeShareable(new FJsonValueObject(CompObj)));
-			UE_LOG(LogTemp, Log, TEXT("  Component: %s (%s) - %d modified properties"),
-				*SCSNode->GetVariableName().ToString(),
-				*SCSNode->ComponentTemplate->GetClass()->GetName(),
-				Properties.Num());
+	TArray<TSharedPtr<FJsonValue>> FunctionsArray;
+	int32 NumErrors = 0;
+	for (TFieldIterator<UFunction> FuncIt(GeneratedClass, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
+	{
+		TSharedPtr<FJsonObject> FunctionObj = DisassembleFunctionBytecode(*FuncIt);
+		if (FunctionObj->HasField(TEXT("error")))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: %s: %s"), *FuncIt->GetName(), *FunctionObj->GetStringField(TEXT("error")));
+			NumErrors++;
 		}
+		FunctionsArray.Add(MakeShareable(new FJsonValueObject(FunctionObj)));
 	}
-	Root->SetArrayField(TEXT("components"), Components);
+	Root->SetArrayField(TEXT("functions"), FunctionsArray);
 
-	// ---- Event Dispatchers ----
-	TArray<TSharedPtr<FJsonValue>> Dispatchers;
-	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+	// Write JSON
+	FString FinalOutputPath = OutputPath;
+	if (FinalOutputPath.IsEmpty())
 	{
-		if (Var.VarType.PinCategory == UEdGraphSchema_K2::PC_MCDelegate)
-		{
-			Dispatchers.Add(MakeShareable(new FJsonValueString(Var.VarName.ToString())));
-		}
+		FString BlueprintName = FPaths::GetBaseFilename(BlueprintPath);
+		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), BlueprintName + TEXT("_bytecode.json"));
 	}
-	Root->SetArrayField(TEXT("event_dispatchers"), Dispatchers);
 
-	// ---- Graphs ----
-	TArray<TSharedPtr<FJsonValue>> Graphs;
+	if (SaveJsonToFile(Root, FinalOutputPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported bytecode to %s"), *FinalOutputPath);
+		UE_LOG(LogTemp, Log, TEXT("  Functions: %d (%d not fully decoded)"), FunctionsArray.Num(), NumErrors);
+		return true;
+	}
 
-	// Event Graphs (UberGraphPages)
-	for (UEdGraph* Graph : Blueprint->UbergraphPages)
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write bytecode file %s"), *FinalOutputPath);
+	return false;
+}
+
+/** Appends text to a UTF-8 file, writing it out in STREAMED_EXPORT_CHUNK_CHARS chunks */
+class FChunkedFileWriter
+{
+public:
+	explicit FChunkedFileWriter(const FString& Path)
+		: Archive(IFileManager::Get().CreateFileWriter(*Path))
 	{
-		if (!Graph) continue;
+		Buffer.Reserve(STREAMED_EXPORT_CHUNK_CHARS + 1024);
+	}
 
-		TSharedPtr<FJsonObject> GraphObj = MakeShareable(new FJsonObject());
-		GraphObj->SetStringField(TEXT("name"), Graph->GetName());
-		GraphObj->SetStringField(TEXT("type"), TEXT("EventGraph"));
+	bool IsOpen() const { return Archive.IsValid(); }
 
-		TArray<TSharedPtr<FJsonValue>> Nodes;
-		for (UEdGraphNode* Node : Graph->Nodes)
-		{
-			if (!Node) continue;
-			Nodes.Add(MakeShareable(new FJsonValueObject(ExportNode(Node))));
-		}
-		GraphObj->SetArrayField(TEXT("nodes"), Nodes);
+	void AppendLine(const FString& Line)
+	{
+		Buffer += Line;
+		Buffer += TEXT("\n");
+		if (Buffer.Len() >= STREAMED_EXPORT_CHUNK_CHARS)
+			Flush();
+	}
 
-		Graphs.Add(MakeShareable(new FJsonValueObject(GraphObj)));
-		UE_LOG(LogTemp, Log, TEXT("  EventGraph: %s (%d nodes)"), *Graph->GetName(), Graph->Nodes.Num());
+	/** Flushes what's left and closes the file; false if any write failed */
+	bool Close()
+	{
+		if (!Archive.IsValid())
+			return false;
+
+		Flush();
+		const bool bSuccess = Archive->Close();
+		Archive.Reset();
+		return bSuccess;
 	}
 
-	// Function Graphs
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+private:
+	void Flush()
+	{
+		if (Buffer.IsEmpty())
+			return;
+
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::WriteFile);
+		FTCHARToUTF8 Utf8(*Buffer, Buffer.Len());
+		Archive->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+		BLUEPRINT_EXPORTER_TRACE_COUNT(BlueprintExporter_BytesWritten, Utf8.Length());
+		Buffer.Reset();
+	}
+
+	TUniquePtr<FArchive> Archive;
+	FString Buffer;
+};
+
+static FString EscapeCsvCell(const FString& Value)
+{
+	return TEXT("\"") + Value.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+}
+
+static FString SerializeJsonLine(const TSharedPtr<FJsonObject>& Obj)
+{
+	FString Line;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+	FJsonSerializer::Serialize(Obj.ToSharedRef(), Writer);
+	return Line;
+}
+
+bool UBlueprintExporterBPLibrary::ExportDataTableRows(const FString& AssetPath, const FString& OutputPath, EDataTableExportFormat Format, int32 FirstRow, int32 MaxRows, int32& OutNumRows, int32& OutTotalRows)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportDataTableRows);
+
+	OutNumRows = 0;
+	OutTotalRows = 0;
+
+	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
+	const UDataTable* DataTable = Cast<UDataTable>(Asset);
+	const UDataAsset* DataAsset = Cast<UDataAsset>(Asset);
+	if (!DataTable && !DataAsset)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load DataTable or DataAsset at %s"), *AssetPath);
+		return false;
+	}
+
+	// A DataAsset is written as a one-row table of its editable properties
+	const UStruct* RowStruct = nullptr;
+	const void* DefaultInstance = nullptr;
+	TArray<FProperty*> Columns;
+	TArray<TPair<FName, const uint8*>> Rows;
+
+	if (DataTable)
 	{
-		if (!Graph) continue;
+		RowStruct = DataTable->GetRowStruct();
+		if (!RowStruct)
+		{
+			UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: DataTable %s has no row struct"), *AssetPath);
+			return false;
+		}
+
+		if (const UUserDefinedStruct* UserStruct = Cast<UUserDefinedStruct>(RowStruct))
+			DefaultInstance = UserStruct->GetDefaultInstance();
+
+		for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
+			Columns.Add(*PropIt);
 
-		TSharedPtr<FJsonObject> GraphObj = MakeShareable(new FJsonObject());
-		GraphObj->SetStringField(TEXT("name"), Graph->GetName());
-		GraphObj->SetStringField(TEXT("type"), TEXT("FunctionGraph"));
+		Rows.Reserve(DataTable->GetRowMap().Num());
+		for (const TPair<FName, uint8*>& Row : DataTable->GetRowMap())
+			Rows.Add(TPair<FName, const uint8*>(Row.Key, Row.Value));
+	}
+	else
+	{
+		RowStruct = DataAsset->GetClass();
+		DefaultInstance = DataAsset->GetClass()->GetDefaultObject();
 
-		TArray<TSharedPtr<FJsonValue>> Nodes;
-		for (UEdGraphNode* Node : Graph->Nodes)
+		for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
 		{
-			if (!Node) continue;
-			Nodes.Add(MakeShareable(new FJsonValueObject(ExportNode(Node))));
+			if (PropIt->HasAnyPropertyFlags(CPF_Edit) && !PropIt->HasAnyPropertyFlags(CPF_Transient))
+				Columns.Add(*PropIt);
 		}
-		GraphObj->SetArrayField(TEXT("nodes"), Nodes);
 
-		Graphs.Add(MakeShareable(new FJsonValueObject(GraphObj)));
-		UE_LOG(LogTemp, Log, TEXT("  FunctionGraph: %s (%d nodes)"), *Graph->GetName(), Graph->Nodes.Num());
+		Rows.Add(TPair<FName, const uint8*>(DataAsset->GetFName(), reinterpret_cast<const uint8*>(DataAsset)));
 	}
 
-	Root->SetArrayField(TEXT("graphs"), Graphs);
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded %s %s (%d rows of %s)"), DataTable ? TEXT("DataTable") : TEXT("DataAsset"), *Asset->GetName(), Rows.Num(), *RowStruct->GetName());
+
+	OutTotalRows = Rows.Num();
+	const int32 StartRow = FMath::Clamp(FirstRow, 0, Rows.Num());
+	const int32 EndRow = MaxRows > 0 ? FMath::Min(Rows.Num(), StartRow + MaxRows) : Rows.Num();
 
-	// ---- Write JSON ----
 	FString FinalOutputPath = OutputPath;
 	if (FinalOutputPath.IsEmpty())
 	{
-		FString BPName = FPaths::GetBaseFilename(BlueprintPath);
-		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), BPName + TEXT(".json"));
+		FString AssetName = FPaths::GetBaseFilename(AssetPath);
+		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), AssetName + (Format == EDataTableExportFormat::Csv ? TEXT("_rows.csv") : TEXT("_rows.ndjson")));
 	}
 
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+	FChunkedFileWriter Writer(FinalOutputPath);
+	if (!Writer.IsOpen())
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to open %s"), *FinalOutputPath);
+		return false;
+	}
 
-	if (FFileHelper::SaveStringToFile(OutputString, *FinalOutputPath))
+	if (Format == EDataTableExportFormat::Csv)
 	{
-		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported to %s"), *FinalOutputPath);
-		UE_LOG(LogTemp, Log, TEXT("  Variables: %d"), Variables.Num());
-		UE_LOG(LogTemp, Log, TEXT("  Components: %d"), Components.Num());
-		UE_LOG(LogTemp, Log, TEXT("  Graphs: %d"), Graphs.Num());
-		return true;
+		// "---" heads the row name column, matching what DataTable CSV import expects
+		TArray<FString> Header;
+		Header.Add(TEXT("---"));
+		for (const FProperty* Column : Columns)
+			Header.Add(EscapeCsvCell(DataTableUtils::GetPropertyExportName(Column)));
+		Writer.AppendLine(FString::Join(Header, TEXT(",")));
+
+		for (int32 RowIndex = StartRow; RowIndex < EndRow; RowIndex++)
+		{
+			TArray<FString> Cells;
+			Cells.Add(EscapeCsvCell(Rows[RowIndex].Key.ToString()));
+			for (const FProperty* Column : Columns)
+				Cells.Add(EscapeCsvCell(DataTableUtils::GetPropertyValueAsString(Column, Rows[RowIndex].Value, EDataTableExportFlags::None)));
+			Writer.AppendLine(FString::Join(Cells, TEXT(",")));
+		}
+	}
+	else
+	{
+		TArray<TSharedPtr<FJsonValue>> ColumnNames;
+		for (const FProperty* Column : Columns)
+			ColumnNames.Add(MakeShareable(new FJsonValueString(Column->GetAuthoredName())));
+
+		TSharedPtr<FJsonObject> HeaderObj = MakeShareable(new FJsonObject());
+		HeaderObj->SetStringField(TEXT("name"), Asset->GetName());
+		HeaderObj->SetStringField(TEXT("asset_path"), AssetPath);
+		HeaderObj->SetStringField(TEXT("asset_type"), DataTable ? TEXT("DataTable") : TEXT("DataAsset"));
+		HeaderObj->SetStringField(TEXT("row_struct"), RowStruct->GetName());
+		HeaderObj->SetStringField(TEXT("row_struct_path"), RowStruct->GetPathName());
+		HeaderObj->SetArrayField(TEXT("fields"), BuildStructFieldsJson(Columns, DefaultInstance, true));
+		HeaderObj->SetArrayField(TEXT("columns"), ColumnNames);
+		HeaderObj->SetNumberField(TEXT("total_rows"), Rows.Num());
+		HeaderObj->SetNumberField(TEXT("first_row"), StartRow);
+		HeaderObj->SetNumberField(TEXT("row_count"), EndRow - StartRow);
+		Writer.AppendLine(SerializeJsonLine(HeaderObj));
+
+		// Each row's DOM is built, written and dropped before the next, so only one row is ever held
+		for (int32 RowIndex = StartRow; RowIndex < EndRow; RowIndex++)
+		{
+			TSharedPtr<FJsonObject> ValuesObj = MakeShareable(new FJsonObject());
+			for (const FProperty* Column : Columns)
+				ValuesObj->SetField(Column->GetAuthoredName(), PropertyToJson_InContainer(Column, Rows[RowIndex].Value));
+
+			TSharedPtr<FJsonObject> RowObj = MakeShareable(new FJsonObject());
+			RowObj->SetNumberField(TEXT("index"), RowIndex);
+			RowObj->SetStringField(TEXT("row_name"), Rows[RowIndex].Key.ToString());
+			RowObj->SetObjectField(TEXT("values"), ValuesObj);
+			Writer.AppendLine(SerializeJsonLine(RowObj));
+		}
 	}
 
-	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write file %s"), *FinalOutputPath);
-	return false;
+	if (!Writer.Close())
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write rows file %s"), *FinalOutputPath);
+		return false;
+	}
+
+	OutNumRows = EndRow - StartRow;
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported rows %d-%d of %d to %s"), StartRow, EndRow, Rows.Num(), *FinalOutputPath);
+	return true;
 }
 
-bool UBlueprintExporterBPLibrary::ExportStructToJson(const FString& StructPath, const FString& OutputPath)
+// Identifies the on-disk revision of a package. Empty when the package has no file or has
+// unsaved edits in memory, which means the catalogue entry can't be reused.
+static FString GetPackageStamp(const FName PackageName)
 {
-	// Load the struct
-	UUserDefinedStruct* Struct = LoadObject<UUserDefinedStruct>(nullptr, *StructPath);
-	if (!Struct)
+	const FString PackageNameStr = PackageName.ToString();
+
+	if (const UPackage* LoadedPackage = FindPackage(nullptr, *PackageNameStr))
 	{
-		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load struct at %s"), *StructPath);
-		return false;
+		if (LoadedPackage->IsDirty())
+			return FString();
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded struct %s"), *Struct->GetName());
+	FString Filename;
+	if (!FPackageName::DoesPackageExist(PackageNameStr, &Filename))
+		return FString();
 
-	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*Filename);
+	const int64 FileSize = IFileManager::Get().FileSize(*Filename);
+	return FString::Printf(TEXT("%lld:%lld"), TimeStamp.GetTicks(), FileSize);
+}
 
-	Root->SetStringField(TEXT("name"), Struct->GetName());
-	Root->SetStringField(TEXT("struct_path"), StructPath);
-	Root->SetStringField(TEXT("struct_type"), TEXT("UserDefinedStruct"));
+// Adds one catalogue entry per asset, reusing the previous entry when its package is unchanged
+static void CollectCatalogueEntries(
+	TArray<FAssetData>& Assets,
+	const TMap<FString, TSharedPtr<FJsonObject>>& PreviousEntries,
+	bool bForceRebuild,
+	TFunctionRef<TSharedPtr<FJsonObject>(const FAssetData&)> BuildEntry,
+	TArray<TSharedPtr<FJsonValue>>& OutEntries,
+	int32& OutNumRebuilt)
+{
+	Assets.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
 
-	// Export struct fields
-	TArray<TSharedPtr<FJsonValue>> Fields;
-	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+	for (const FAssetData& Asset : Assets)
 	{
-		FProperty* Property = *PropIt;
-		if (!Property)
+		const FString PackagePath = Asset.PackageName.ToString();
+		if (!PackagePath.StartsWith(TEXT("/Game/")))
 			continue;
 
-		TSharedPtr<FJsonObject> FieldObj = MakeShareable(new FJsonObject());
-		FieldObj->SetStringField(TEXT("name"), Property->GetName());
+		const FString Stamp = GetPackageStamp(Asset.PackageName);
 
-		// Get property type
-		FString TypeStr;
-		if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-		{
-			TypeStr = StructProp->Struct->GetName();
-			FString StructSource = GetStructSource(StructProp);
-			FieldObj->SetStringField(TEXT("struct_source"), StructSource);
-		}
-		else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
-			TypeStr = ObjProp->PropertyClass->GetName();
-		else if (FClassProperty* ClassProp = CastField<FClassProperty>(Property))
-			TypeStr = FString::Printf(TEXT("TSubclassOf<%s>"), *ClassProp->MetaClass->GetName());
-		else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
-		{
-			if (UEnum* Enum = EnumProp->GetEnum())
-				TypeStr = Enum->GetName();
-			else
-				TypeStr = TEXT("uint8");
-		}
-		else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+		if (!bForceRebuild && !Stamp.IsEmpty())
 		{
-			if (ByteProp->Enum)
-				TypeStr = ByteProp->Enum->GetName();
-			else
-				TypeStr = TEXT("uint8");
+			const TSharedPtr<FJsonObject>* Previous = PreviousEntries.Find(PackagePath);
+			FString PreviousStamp;
+			if (Previous && (*Previous)->TryGetStringField(TEXT("package_stamp"), PreviousStamp) && PreviousStamp == Stamp)
+			{
+				OutEntries.Add(MakeShareable(new FJsonValueObject(*Previous)));
+				continue;
+			}
 		}
-		else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+
+		TSharedPtr<FJsonObject> Entry = BuildEntry(Asset);
+		if (!Entry)
 		{
-			FProperty* InnerProp = ArrayProp->Inner;
-			if (FStructProperty* InnerStructProp = CastField<FStructProperty>(InnerProp))
-				TypeStr = FString::Printf(TEXT("TArray<%s>"), *InnerStructProp->Struct->GetName());
-			else
-				TypeStr = FString::Printf(TEXT("TArray<%s>"), *InnerProp->GetCPPType());
+			UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Could not load type at %s"), *PackagePath);
+			continue;
 		}
-		else
-			TypeStr = Property->GetCPPType();
 
-		FieldObj->SetStringField(TEXT("type"), TypeStr);
+		Entry->SetStringField(TEXT("object_path"), Asset.GetObjectPathString());
+		Entry->SetStringField(TEXT("package_stamp"), Stamp);
+		OutEntries.Add(MakeShareable(new FJsonValueObject(Entry)));
+		OutNumRebuilt++;
+	}
+}
 
-		// Get default value from struct's default instance
-		const void* DefaultValuePtr = Property->ContainerPtrToValuePtr<void>(Struct->GetDefaultInstance());
-		if (DefaultValuePtr)
+bool UBlueprintExporterBPLibrary::ExportTypeCatalogueToJson(const FString& OutputPath, bool bForceRebuild, int32& OutNumTypes, int32& OutNumRebuilt)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportTypeCatalogueToJson);
+
+	OutNumTypes = 0;
+	OutNumRebuilt = 0;
+
+	FString FinalOutputPath = OutputPath;
+	if (FinalOutputPath.IsEmpty())
+	{
+		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), TEXT("type_catalogue.json"));
+	}
+
+	// The previous catalogue is the cache: entries whose package stamp still matches are kept as-is
+	TMap<FString, TSharedPtr<FJsonObject>> PreviousStructs;
+	TMap<FString, TSharedPtr<FJsonObject>> PreviousEnums;
+	bool bHavePrevious = false;
+
+	FString PreviousString;
+	if (!bForceRebuild && FFileHelper::LoadFileToString(PreviousString, *FinalOutputPath))
+	{
+		TSharedPtr<FJsonObject> PreviousRoot;
+		int32 PreviousVersion = 0;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(PreviousString);
+		if (FJsonSerializer::Deserialize(Reader, PreviousRoot) && PreviousRoot.IsValid()
+			&& PreviousRoot->TryGetNumberField(TEXT("catalogue_version"), PreviousVersion) && PreviousVersion == TYPE_CATALOGUE_VERSION)
 		{
-			FString DefaultValueStr;
-			Property->ExportTextItem_Direct(DefaultValueStr, DefaultValuePtr, nullptr, nullptr, PPF_None);
-			if (!DefaultValueStr.IsEmpty())
+			bHavePrevious = true;
+
+			const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+			if (PreviousRoot->TryGetArrayField(TEXT("structs"), Entries))
 			{
-				FieldObj->SetStringField(TEXT("default_value"), DefaultValueStr);
+				for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+					PreviousStructs.Add(Entry->AsObject()->GetStringField(TEXT("struct_path")), Entry->AsObject());
+			}
+			if (PreviousRoot->TryGetArrayField(TEXT("enums"), Entries))
+			{
+				for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+					PreviousEnums.Add(Entry->AsObject()->GetStringField(TEXT("enum_path")), Entry->AsObject());
 			}
 		}
-
-		Fields.Add(MakeShareable(new FJsonValueObject(FieldObj)));
-		UE_LOG(LogTemp, Log, TEXT("  Field: %s (%s)"), *Property->GetName(), *TypeStr);
 	}
 
-	Root->SetArrayField(TEXT("fields"), Fields);
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	// Write JSON
-	FString FinalOutputPath = OutputPath;
-	if (FinalOutputPath.IsEmpty())
+	TArray<FAssetData> StructAssets;
+	AssetRegistry.GetAssetsByClass(UUserDefinedStruct::StaticClass()->GetClassPathName(), StructAssets);
+
+	TArray<FAssetData> EnumAssets;
+	AssetRegistry.GetAssetsByClass(UUserDefinedEnum::StaticClass()->GetClassPathName(), EnumAssets);
+
+	TArray<TSharedPtr<FJsonValue>> Structs;
+	CollectCatalogueEntries(StructAssets, PreviousStructs, bForceRebuild, [](const FAssetData& Asset) -> TSharedPtr<FJsonObject>
 	{
-		FString StructName = FPaths::GetBaseFilename(StructPath);
-		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), StructName + TEXT("_struct.json"));
+		const UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Asset.GetAsset());
+		return Struct ? BuildStructJson(Struct, Asset.PackageName.ToString()) : nullptr;
+	}, Structs, OutNumRebuilt);
+
+	TArray<TSharedPtr<FJsonValue>> Enums;
+	CollectCatalogueEntries(EnumAssets, PreviousEnums, bForceRebuild, [](const FAssetData& Asset) -> TSharedPtr<FJsonObject>
+	{
+		const UUserDefinedEnum* Enum = Cast<UUserDefinedEnum>(Asset.GetAsset());
+		return Enum ? BuildEnumJson(Enum, Asset.PackageName.ToString()) : nullptr;
+	}, Enums, OutNumRebuilt);
+
+	OutNumTypes = Structs.Num() + Enums.Num();
+
+	// Nothing rebuilt and nothing removed: the file on disk is already current
+	const bool bUpToDate = OutNumRebuilt == 0 && bHavePrevious && OutNumTypes == PreviousStructs.Num() + PreviousEnums.Num();
+	if (bUpToDate)
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Type catalogue %s is up to date (%d types)"), *FinalOutputPath, OutNumTypes);
+		return true;
 	}
 
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	Root->SetNumberField(TEXT("catalogue_version"), TYPE_CATALOGUE_VERSION);
+	Root->SetArrayField(TEXT("structs"), Structs);
+	Root->SetArrayField(TEXT("enums"), Enums);
 
-	if (FFileHelper::SaveStringToFile(OutputString, *FinalOutputPath))
+	if (SaveJsonToFile(Root, FinalOutputPath))
 	{
-		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported struct to %s"), *FinalOutputPath);
-		UE_LOG(LogTemp, Log, TEXT("  Fields: %d"), Fields.Num());
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported type catalogue to %s"), *FinalOutputPath);
+		UE_LOG(LogTemp, Log, TEXT("  Structs: %d, Enums: %d, Rebuilt: %d"), Structs.Num(), Enums.Num(), OutNumRebuilt);
 		return true;
 	}
 
-	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write struct file %s"), *FinalOutputPath);
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write type catalogue %s"), *FinalOutputPath);
 	return false;
 }
 
-bool UBlueprintExporterBPLibrary::ExportEnumToJson(const FString& EnumPath, const FString& OutputPath)
+bool UBlueprintExporterBPLibrary::ExportMacroLibraryToJson(const FString& OutputPath, int32& OutNumMacros)
 {
-	// Load the enum
-	UUserDefinedEnum* Enum = LoadObject<UUserDefinedEnum>(nullptr, *EnumPath);
-	if (!Enum)
-	{
-		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Could not load enum at %s"), *EnumPath);
-		return false;
-	}
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::ExportMacroLibraryToJson);
 
-	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Loaded enum %s"), *Enum->GetName());
+	OutNumMacros = 0;
 
-	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	Root->SetStringField(TEXT("name"), Enum->GetName());
-	Root->SetStringField(TEXT("enum_path"), EnumPath);
-	Root->SetStringField(TEXT("enum_type"), TEXT("UserDefinedEnum"));
+	TArray<FAssetData> BlueprintAssets;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets);
 
-	// Export enum values
-	TArray<TSharedPtr<FJsonValue>> Values;
-	int32 MaxIndex = Enum->NumEnums();
+	// Macro libraries are identified from the registry tag so other blueprints aren't loaded
+	TArray<FSoftObjectPath> LibraryPaths;
+	LibraryPaths.Add(FSoftObjectPath(STANDARD_MACROS_PATH));
+	for (const FAssetData& Asset : BlueprintAssets)
+	{
+		FString BlueprintType;
+		if (Asset.GetTagValue(FBlueprintTags::BlueprintType, BlueprintType) && BlueprintType == TEXT("BPTYPE_MacroLibrary"))
+			LibraryPaths.AddUnique(Asset.GetSoftObjectPath());
+	}
 
-	for (int32 i = 0; i < MaxIndex; i++)
+	const FBlueprintExportOptions Options;
+	FBlueprintExportContext Context(Options);
+
+	TArray<TSharedPtr<FJsonValue>> Libraries;
+	TArray<TSharedPtr<FJsonValue>> Macros;
+	for (const FSoftObjectPath& LibraryPath : LibraryPaths)
 	{
-		// Skip the _MAX entry that UE auto-generates
-		FString Name = Enum->GetNameStringByIndex(i);
-		if (Name.EndsWith(TEXT("_MAX")))
+		UBlueprint* Library = Cast<UBlueprint>(LibraryPath.TryLoad());
+		if (!Library)
 		{
+			UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Could not load macro library %s"), *LibraryPath.ToString());
 			continue;
 		}
 
-		TSharedPtr<FJsonObject> EntryObj = MakeShareable(new FJsonObject());
-		EntryObj->SetStringField(TEXT("name"), Name);
-		EntryObj->SetNumberField(TEXT("value"), static_cast<double>(Enum->GetValueByIndex(i)));
+		Libraries.Add(MakeShareable(new FJsonValueString(Library->GetOutermost()->GetName())));
 
-		// Get the display name (user-friendly name set in editor)
-		FText DisplayName = Enum->GetDisplayNameTextByIndex(i);
-		EntryObj->SetStringField(TEXT("display_name"), DisplayName.ToString());
+		for (UEdGraph* Graph : Library->MacroGraphs)
+		{
+			if (!Graph) continue;
 
-		Values.Add(MakeShareable(new FJsonValueObject(EntryObj)));
-		UE_LOG(LogTemp, Log, TEXT("  Entry: %s = %lld (Display: %s)"), *Name, Enum->GetValueByIndex(i), *DisplayName.ToString());
+			int32 NumPruned = 0;
+			Macros.Add(MakeShareable(new FJsonValueObject(ExportMacroGraph(Graph, Context, NumPruned))));
+		}
+		UE_LOG(LogTemp, Log, TEXT("  MacroLibrary: %s (%d macros)"), *Library->GetName(), Library->MacroGraphs.Num());
 	}
 
-	Root->SetArrayField(TEXT("values"), Values);
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	Root->SetArrayField(TEXT("libraries"), Libraries);
+	Root->SetArrayField(TEXT("macros"), Macros);
+	OutNumMacros = Macros.Num();
 
-	// Write JSON
 	FString FinalOutputPath = OutputPath;
 	if (FinalOutputPath.IsEmpty())
 	{
-		FString EnumName = FPaths::GetBaseFilename(EnumPath);
-		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), EnumName + TEXT("_enum.json"));
+		FinalOutputPath = FPaths::Combine(FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")), TEXT("macro_library.json"));
 	}
 
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
-
-	if (FFileHelper::SaveStringToFile(OutputString, *FinalOutputPath))
+	if (SaveJsonToFile(Root, FinalOutputPath))
 	{
-		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported enum to %s"), *FinalOutputPath);
-		UE_LOG(LogTemp, Log, TEXT("  Values: %d"), Values.Num());
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Exported macro library to %s"), *FinalOutputPath);
+		UE_LOG(LogTemp, Log, TEXT("  Libraries: %d, Macros: %d"), Libraries.Num(), Macros.Num());
 		return true;
 	}
 
-	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write enum file %s"), *FinalOutputPath);
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write macro library %s"), *FinalOutputPath);
 	return false;
 }
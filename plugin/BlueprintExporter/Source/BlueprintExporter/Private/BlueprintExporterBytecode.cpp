@@ -0,0 +1,595 @@
+#include "BlueprintExporterBytecode.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "UObject/Script.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+#include "Misc/EngineVersionComparison.h"
+
+// Nested expressions deeper than this mean the stream is misframed rather than a real script
+static const int32 MAX_BYTECODE_EXPR_DEPTH = 256;
+
+/**
+ * Reads one function's script. Every read is bounds-checked; the first failure latches Error
+ * and every later read returns zero, so decoding unwinds without touching memory past the end.
+ */
+class FBytecodeReader
+{
+public:
+	explicit FBytecodeReader(const TArray<uint8>& InScript)
+		: Script(InScript)
+	{
+	}
+
+	int32 GetOffset() const { return Offset; }
+	bool AtEnd() const { return Offset >= Script.Num(); }
+	bool HasError() const { return !Error.IsEmpty(); }
+	const FString& GetError() const { return Error; }
+
+	TSet<int32> JumpTargets;
+
+	/** Reads one expression and writes it to Out; returns its token */
+	uint8 ReadExpr(const TSharedPtr<FJsonObject>& Out);
+
+private:
+	template <typename T>
+	T Read()
+	{
+		T Value{};
+		if (HasError())
+			return Value;
+
+		if (Offset + static_cast<int32>(sizeof(T)) > Script.Num())
+		{
+			Fail(FString::Printf(TEXT("Script ends inside an operand at offset %d"), Offset));
+			return Value;
+		}
+
+		FMemory::Memcpy(&Value, Script.GetData() + Offset, sizeof(T));
+		Offset += sizeof(T);
+		return Value;
+	}
+
+	template <typename T>
+	T* ReadPointer()
+	{
+		return reinterpret_cast<T*>(static_cast<UPTRINT>(Read<ScriptPointerType>()));
+	}
+
+	FName ReadName()
+	{
+		return ScriptNameToName(Read<FScriptName>());
+	}
+
+	void Fail(const FString& Message)
+	{
+		if (Error.IsEmpty())
+			Error = Message;
+	}
+
+	FString ReadAnsiString();
+	FString ReadUnicodeString();
+
+	TSharedPtr<FJsonObject> ReadChild(const TSharedPtr<FJsonObject>& Parent, const TCHAR* Field);
+	void ReadUntil(const TSharedPtr<FJsonObject>& Parent, const TCHAR* Field, uint8 EndToken);
+	void ReadJumpTarget(const TSharedPtr<FJsonObject>& Out);
+
+	void SetProperty(const TSharedPtr<FJsonObject>& Out, const TCHAR* Field, const FField* Property);
+	void SetObject(const TSharedPtr<FJsonObject>& Out, const TCHAR* Field, const UObject* Object);
+	void SetFunction(const TSharedPtr<FJsonObject>& Out, const UFunction* Function);
+
+	const TArray<uint8>& Script;
+	int32 Offset = 0;
+	int32 Depth = 0;
+	FString Error;
+};
+
+FString FBytecodeReader::ReadAnsiString()
+{
+	FString Result;
+	for (uint8 Char = Read<uint8>(); Char != 0 && !HasError(); Char = Read<uint8>())
+		Result.AppendChar(static_cast<TCHAR>(Char));
+	return Result;
+}
+
+FString FBytecodeReader::ReadUnicodeString()
+{
+	TArray<UTF16CHAR> Chars;
+	for (uint16 Char = Read<uint16>(); Char != 0 && !HasError(); Char = Read<uint16>())
+		Chars.Add(Char);
+
+	const auto Converted = StringCast<TCHAR>(Chars.GetData(), Chars.Num());
+	return FString(Converted.Length(), Converted.Get());
+}
+
+TSharedPtr<FJsonObject> FBytecodeReader::ReadChild(const TSharedPtr<FJsonObject>& Parent, const TCHAR* Field)
+{
+	TSharedPtr<FJsonObject> Child = MakeShareable(new FJsonObject());
+	ReadExpr(Child);
+	Parent->SetObjectField(Field, Child);
+	return Child;
+}
+
+void FBytecodeReader::ReadUntil(const TSharedPtr<FJsonObject>& Parent, const TCHAR* Field, uint8 EndToken)
+{
+	TArray<TSharedPtr<FJsonValue>> Children;
+	while (!HasError())
+	{
+		TSharedPtr<FJsonObject> Child = MakeShareable(new FJsonObject());
+		if (ReadExpr(Child) == EndToken)
+			break;
+		Children.Add(MakeShareable(new FJsonValueObject(Child)));
+	}
+	Parent->SetArrayField(Field, Children);
+}
+
+void FBytecodeReader::ReadJumpTarget(const TSharedPtr<FJsonObject>& Out)
+{
+	const CodeSkipSizeType Target = Read<CodeSkipSizeType>();
+	Out->SetNumberField(TEXT("target"), Target);
+	JumpTargets.Add(static_cast<int32>(Target));
+}
+
+void FBytecodeReader::SetProperty(const TSharedPtr<FJsonObject>& Out, const TCHAR* Field, const FField* Property)
+{
+	if (!Property)
+	{
+		Out->SetField(Field, MakeShareable(new FJsonValueNull()));
+		return;
+	}
+
+	Out->SetStringField(Field, Property->GetName());
+	if (const FProperty* TypedProperty = CastField<FProperty>(Property))
+		Out->SetStringField(FString(Field) + TEXT("_type"), TypedProperty->GetCPPType());
+}
+
+void FBytecodeReader::SetObject(const TSharedPtr<FJsonObject>& Out, const TCHAR* Field, const UObject* Object)
+{
+	if (Object)
+		Out->SetStringField(Field, Object->GetPathName());
+	else
+		Out->SetField(Field, MakeShareable(new FJsonValueNull()));
+}
+
+void FBytecodeReader::SetFunction(const TSharedPtr<FJsonObject>& Out, const UFunction* Function)
+{
+	if (!Function)
+	{
+		Out->SetField(TEXT("function"), MakeShareable(new FJsonValueNull()));
+		return;
+	}
+
+	Out->SetStringField(TEXT("function"), Function->GetName());
+	if (const UClass* OwnerClass = Function->GetOwnerClass())
+		Out->SetStringField(TEXT("function_owner"), OwnerClass->GetName());
+}
+
+uint8 FBytecodeReader::ReadExpr(const TSharedPtr<FJsonObject>& Out)
+{
+	if (HasError())
+		return EX_EndOfScript;
+
+	if (++Depth > MAX_BYTECODE_EXPR_DEPTH)
+	{
+		Fail(FString::Printf(TEXT("Expressions nested deeper than %d at offset %d"), MAX_BYTECODE_EXPR_DEPTH, Offset));
+		--Depth;
+		return EX_EndOfScript;
+	}
+
+	const int32 ExprOffset = Offset;
+	const uint8 Token = Read<uint8>();
+	Out->SetNumberField(TEXT("offset"), ExprOffset);
+
+	auto SetOp = [&Out](const TCHAR* Name) { Out->SetStringField(TEXT("op"), Name); };
+
+	switch (Token)
+	{
+	// ---- Variables ----
+	case EX_LocalVariable:          SetOp(TEXT("EX_LocalVariable")); SetProperty(Out, TEXT("property"), ReadPointer<FField>()); break;
+	case EX_InstanceVariable:       SetOp(TEXT("EX_InstanceVariable")); SetProperty(Out, TEXT("property"), ReadPointer<FField>()); break;
+	case EX_DefaultVariable:        SetOp(TEXT("EX_DefaultVariable")); SetProperty(Out, TEXT("property"), ReadPointer<FField>()); break;
+	case EX_LocalOutVariable:       SetOp(TEXT("EX_LocalOutVariable")); SetProperty(Out, TEXT("property"), ReadPointer<FField>()); break;
+	case EX_ClassSparseDataVariable: SetOp(TEXT("EX_ClassSparseDataVariable")); SetProperty(Out, TEXT("property"), ReadPointer<FField>()); break;
+
+	// ---- Assignment ----
+	case EX_Let:
+		SetOp(TEXT("EX_Let"));
+		SetProperty(Out, TEXT("property"), ReadPointer<FField>());
+		ReadChild(Out, TEXT("variable"));
+		ReadChild(Out, TEXT("value"));
+		break;
+	case EX_LetObj:               SetOp(TEXT("EX_LetObj")); ReadChild(Out, TEXT("variable")); ReadChild(Out, TEXT("value")); break;
+	case EX_LetWeakObjPtr:        SetOp(TEXT("EX_LetWeakObjPtr")); ReadChild(Out, TEXT("variable")); ReadChild(Out, TEXT("value")); break;
+	case EX_LetBool:              SetOp(TEXT("EX_LetBool")); ReadChild(Out, TEXT("variable")); ReadChild(Out, TEXT("value")); break;
+	case EX_LetDelegate:          SetOp(TEXT("EX_LetDelegate")); ReadChild(Out, TEXT("variable")); ReadChild(Out, TEXT("value")); break;
+	case EX_LetMulticastDelegate: SetOp(TEXT("EX_LetMulticastDelegate")); ReadChild(Out, TEXT("variable")); ReadChild(Out, TEXT("value")); break;
+	case EX_LetValueOnPersistentFrame:
+		SetOp(TEXT("EX_LetValueOnPersistentFrame"));
+		SetProperty(Out, TEXT("property"), ReadPointer<FField>());
+		ReadChild(Out, TEXT("value"));
+		break;
+
+	// ---- Calls ----
+	case EX_FinalFunction:
+	case EX_LocalFinalFunction:
+	case EX_CallMath:
+		SetOp(Token == EX_FinalFunction ? TEXT("EX_FinalFunction") : Token == EX_LocalFinalFunction ? TEXT("EX_LocalFinalFunction") : TEXT("EX_CallMath"));
+		SetFunction(Out, ReadPointer<UFunction>());
+		ReadUntil(Out, TEXT("params"), EX_EndFunctionParms);
+		break;
+	case EX_VirtualFunction:
+	case EX_LocalVirtualFunction:
+		SetOp(Token == EX_VirtualFunction ? TEXT("EX_VirtualFunction") : TEXT("EX_LocalVirtualFunction"));
+		Out->SetStringField(TEXT("function"), ReadName().ToString());
+		ReadUntil(Out, TEXT("params"), EX_EndFunctionParms);
+		break;
+	case EX_CallMulticastDelegate:
+		SetOp(TEXT("EX_CallMulticastDelegate"));
+		SetFunction(Out, ReadPointer<UFunction>());
+		ReadChild(Out, TEXT("delegate"));
+		ReadUntil(Out, TEXT("params"), EX_EndFunctionParms);
+		break;
+
+	// ---- Context ----
+	case EX_Context:
+	case EX_Context_FailSilent:
+	case EX_ClassContext:
+		SetOp(Token == EX_Context ? TEXT("EX_Context") : Token == EX_Context_FailSilent ? TEXT("EX_Context_FailSilent") : TEXT("EX_ClassContext"));
+		ReadChild(Out, TEXT("object"));
+		Out->SetNumberField(TEXT("skip"), Read<CodeSkipSizeType>());
+		SetProperty(Out, TEXT("rvalue_property"), ReadPointer<FField>());
+		ReadChild(Out, TEXT("context"));
+		break;
+	case EX_InterfaceContext:
+		SetOp(TEXT("EX_InterfaceContext"));
+		ReadChild(Out, TEXT("expr"));
+		break;
+	case EX_StructMemberContext:
+		SetOp(TEXT("EX_StructMemberContext"));
+		SetProperty(Out, TEXT("property"), ReadPointer<FField>());
+		ReadChild(Out, TEXT("struct"));
+		break;
+	case EX_ArrayGetByRef:
+		SetOp(TEXT("EX_ArrayGetByRef"));
+		ReadChild(Out, TEXT("array"));
+		ReadChild(Out, TEXT("index"));
+		break;
+
+	// ---- Flow control ----
+	case EX_Jump:
+		SetOp(TEXT("EX_Jump"));
+		ReadJumpTarget(Out);
+		break;
+	case EX_JumpIfNot:
+		SetOp(TEXT("EX_JumpIfNot"));
+		ReadJumpTarget(Out);
+		ReadChild(Out, TEXT("condition"));
+		break;
+	case EX_ComputedJump:
+		SetOp(TEXT("EX_ComputedJump"));
+		ReadChild(Out, TEXT("offset_expr"));
+		break;
+	case EX_PushExecutionFlow:
+		SetOp(TEXT("EX_PushExecutionFlow"));
+		ReadJumpTarget(Out);
+		break;
+	case EX_PopExecutionFlow:
+		SetOp(TEXT("EX_PopExecutionFlow"));
+		break;
+	case EX_PopExecutionFlowIfNot:
+		SetOp(TEXT("EX_PopExecutionFlowIfNot"));
+		ReadChild(Out, TEXT("condition"));
+		break;
+	case EX_Skip:
+		SetOp(TEXT("EX_Skip"));
+		{
+			const CodeSkipSizeType Skip = Read<CodeSkipSizeType>();
+			Out->SetNumberField(TEXT("skip"), Skip);
+		}
+		ReadChild(Out, TEXT("expr"));
+		break;
+	case EX_Return:
+		SetOp(TEXT("EX_Return"));
+		ReadChild(Out, TEXT("expr"));
+		break;
+#if !UE_VERSION_OLDER_THAN(5, 4, 0)
+	// AutoRTFM transactions around calls to closed (transactional) native code
+	case EX_AutoRtfmTransact:
+		SetOp(TEXT("EX_AutoRtfmTransact"));
+		Out->SetNumberField(TEXT("transaction_id"), Read<int32>());
+		ReadJumpTarget(Out);
+		break;
+	case EX_AutoRtfmStopTransact:
+		SetOp(TEXT("EX_AutoRtfmStopTransact"));
+		Out->SetNumberField(TEXT("transaction_id"), Read<int32>());
+		Out->SetNumberField(TEXT("mode"), Read<int8>());
+		break;
+	case EX_AutoRtfmAbortIfNot:
+		SetOp(TEXT("EX_AutoRtfmAbortIfNot"));
+		ReadChild(Out, TEXT("condition"));
+		break;
+#endif
+	case EX_Assert:
+		SetOp(TEXT("EX_Assert"));
+		Out->SetNumberField(TEXT("line"), Read<uint16>());
+		Out->SetBoolField(TEXT("in_debug"), Read<uint8>() != 0);
+		ReadChild(Out, TEXT("condition"));
+		break;
+	case EX_SwitchValue:
+	{
+		SetOp(TEXT("EX_SwitchValue"));
+		const uint16 NumCases = Read<uint16>();
+		Out->SetNumberField(TEXT("end_offset"), Read<CodeSkipSizeType>());
+		ReadChild(Out, TEXT("index"));
+
+		TArray<TSharedPtr<FJsonValue>> Cases;
+		for (uint16 CaseIndex = 0; CaseIndex < NumCases && !HasError(); CaseIndex++)
+		{
+			TSharedPtr<FJsonObject> CaseObj = MakeShareable(new FJsonObject());
+			ReadChild(CaseObj, TEXT("value"));
+			CaseObj->SetNumberField(TEXT("next_offset"), Read<CodeSkipSizeType>());
+			ReadChild(CaseObj, TEXT("result"));
+			Cases.Add(MakeShareable(new FJsonValueObject(CaseObj)));
+		}
+		Out->SetArrayField(TEXT("cases"), Cases);
+		ReadChild(Out, TEXT("default"));
+		break;
+	}
+
+	// ---- Constants ----
+	case EX_IntConst:        SetOp(TEXT("EX_IntConst")); Out->SetNumberField(TEXT("value"), Read<int32>()); break;
+	case EX_Int64Const:      SetOp(TEXT("EX_Int64Const")); Out->SetStringField(TEXT("value"), LexToString(Read<int64>())); break;
+	case EX_UInt64Const:     SetOp(TEXT("EX_UInt64Const")); Out->SetStringField(TEXT("value"), LexToString(Read<uint64>())); break;
+	case EX_SkipOffsetConst: SetOp(TEXT("EX_SkipOffsetConst")); Out->SetNumberField(TEXT("value"), Read<CodeSkipSizeType>()); break;
+	case EX_FloatConst:      SetOp(TEXT("EX_FloatConst")); Out->SetNumberField(TEXT("value"), Read<float>()); break;
+	case EX_DoubleConst:     SetOp(TEXT("EX_DoubleConst")); Out->SetNumberField(TEXT("value"), Read<double>()); break;
+	case EX_ByteConst:       SetOp(TEXT("EX_ByteConst")); Out->SetNumberField(TEXT("value"), Read<uint8>()); break;
+	case EX_IntConstByte:    SetOp(TEXT("EX_IntConstByte")); Out->SetNumberField(TEXT("value"), Read<uint8>()); break;
+	case EX_IntZero:         SetOp(TEXT("EX_IntZero")); break;
+	case EX_IntOne:          SetOp(TEXT("EX_IntOne")); break;
+	case EX_True:            SetOp(TEXT("EX_True")); break;
+	case EX_False:           SetOp(TEXT("EX_False")); break;
+	case EX_NoObject:        SetOp(TEXT("EX_NoObject")); break;
+	case EX_NoInterface:     SetOp(TEXT("EX_NoInterface")); break;
+	case EX_Self:            SetOp(TEXT("EX_Self")); break;
+	case EX_NameConst:       SetOp(TEXT("EX_NameConst")); Out->SetStringField(TEXT("value"), ReadName().ToString()); break;
+	case EX_StringConst:     SetOp(TEXT("EX_StringConst")); Out->SetStringField(TEXT("value"), ReadAnsiString()); break;
+	case EX_UnicodeStringConst: SetOp(TEXT("EX_UnicodeStringConst")); Out->SetStringField(TEXT("value"), ReadUnicodeString()); break;
+	case EX_ObjectConst:     SetOp(TEXT("EX_ObjectConst")); SetObject(Out, TEXT("object"), ReadPointer<UObject>()); break;
+	case EX_PropertyConst:   SetOp(TEXT("EX_PropertyConst")); SetProperty(Out, TEXT("property"), ReadPointer<FField>()); break;
+	case EX_SoftObjectConst: SetOp(TEXT("EX_SoftObjectConst")); ReadChild(Out, TEXT("path")); break;
+	case EX_FieldPathConst:  SetOp(TEXT("EX_FieldPathConst")); ReadChild(Out, TEXT("path")); break;
+	case EX_InstanceDelegate: SetOp(TEXT("EX_InstanceDelegate")); Out->SetStringField(TEXT("function"), ReadName().ToString()); break;
+
+	// Large world coordinates: vector, rotator and transform components are doubles
+	case EX_VectorConst:
+	case EX_RotationConst:
+	{
+		SetOp(Token == EX_VectorConst ? TEXT("EX_VectorConst") : TEXT("EX_RotationConst"));
+		TArray<TSharedPtr<FJsonValue>> Components;
+		for (int32 Component = 0; Component < 3; Component++)
+			Components.Add(MakeShareable(new FJsonValueNumber(Read<double>())));
+		Out->SetArrayField(TEXT("value"), Components);
+		break;
+	}
+#if !UE_VERSION_OLDER_THAN(5, 4, 0)
+	case EX_Vector3fConst:
+	{
+		SetOp(TEXT("EX_Vector3fConst"));
+		TArray<TSharedPtr<FJsonValue>> Components;
+		for (int32 Component = 0; Component < 3; Component++)
+			Components.Add(MakeShareable(new FJsonValueNumber(Read<float>())));
+		Out->SetArrayField(TEXT("value"), Components);
+		break;
+	}
+#endif
+	case EX_TransformConst:
+	{
+		SetOp(TEXT("EX_TransformConst"));
+		auto ReadDoubles = [this](int32 Num)
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			for (int32 Index = 0; Index < Num; Index++)
+				Values.Add(MakeShareable(new FJsonValueNumber(Read<double>())));
+			return Values;
+		};
+		Out->SetArrayField(TEXT("rotation"), ReadDoubles(4));
+		Out->SetArrayField(TEXT("translation"), ReadDoubles(3));
+		Out->SetArrayField(TEXT("scale"), ReadDoubles(3));
+		break;
+	}
+	case EX_TextConst:
+	{
+		SetOp(TEXT("EX_TextConst"));
+		const EBlueprintTextLiteralType TextType = static_cast<EBlueprintTextLiteralType>(Read<uint8>());
+		switch (TextType)
+		{
+		case EBlueprintTextLiteralType::Empty:
+			Out->SetStringField(TEXT("text_type"), TEXT("Empty"));
+			break;
+		case EBlueprintTextLiteralType::LocalizedText:
+			Out->SetStringField(TEXT("text_type"), TEXT("LocalizedText"));
+			ReadChild(Out, TEXT("source"));
+			ReadChild(Out, TEXT("key"));
+			ReadChild(Out, TEXT("namespace"));
+			break;
+		case EBlueprintTextLiteralType::InvariantText:
+			Out->SetStringField(TEXT("text_type"), TEXT("InvariantText"));
+			ReadChild(Out, TEXT("source"));
+			break;
+		case EBlueprintTextLiteralType::LiteralString:
+			Out->SetStringField(TEXT("text_type"), TEXT("LiteralString"));
+			ReadChild(Out, TEXT("source"));
+			break;
+		case EBlueprintTextLiteralType::StringTableEntry:
+			Out->SetStringField(TEXT("text_type"), TEXT("StringTableEntry"));
+			SetObject(Out, TEXT("string_table"), ReadPointer<UObject>());
+			ReadChild(Out, TEXT("table_id"));
+			ReadChild(Out, TEXT("key"));
+			break;
+		default:
+			Fail(FString::Printf(TEXT("Unknown text literal type %d at offset %d"), static_cast<int32>(TextType), ExprOffset));
+			break;
+		}
+		break;
+	}
+
+	// ---- Aggregates ----
+	case EX_StructConst:
+		SetOp(TEXT("EX_StructConst"));
+		SetObject(Out, TEXT("struct"), ReadPointer<UScriptStruct>());
+		Out->SetNumberField(TEXT("serialized_size"), Read<int32>());
+		ReadUntil(Out, TEXT("members"), EX_EndStructConst);
+		break;
+	case EX_SetArray:
+		SetOp(TEXT("EX_SetArray"));
+		ReadChild(Out, TEXT("array"));
+		ReadUntil(Out, TEXT("elements"), EX_EndArray);
+		break;
+	case EX_ArrayConst:
+		SetOp(TEXT("EX_ArrayConst"));
+		SetProperty(Out, TEXT("inner_property"), ReadPointer<FField>());
+		Out->SetNumberField(TEXT("num"), Read<int32>());
+		ReadUntil(Out, TEXT("elements"), EX_EndArrayConst);
+		break;
+	case EX_SetSet:
+		SetOp(TEXT("EX_SetSet"));
+		ReadChild(Out, TEXT("set"));
+		Out->SetNumberField(TEXT("num"), Read<int32>());
+		ReadUntil(Out, TEXT("elements"), EX_EndSet);
+		break;
+	case EX_SetConst:
+		SetOp(TEXT("EX_SetConst"));
+		SetProperty(Out, TEXT("inner_property"), ReadPointer<FField>());
+		Out->SetNumberField(TEXT("num"), Read<int32>());
+		ReadUntil(Out, TEXT("elements"), EX_EndSetConst);
+		break;
+	case EX_SetMap:
+		SetOp(TEXT("EX_SetMap"));
+		ReadChild(Out, TEXT("map"));
+		Out->SetNumberField(TEXT("num"), Read<int32>());
+		ReadUntil(Out, TEXT("elements"), EX_EndMap);
+		break;
+	case EX_MapConst:
+		SetOp(TEXT("EX_MapConst"));
+		SetProperty(Out, TEXT("key_property"), ReadPointer<FField>());
+		SetProperty(Out, TEXT("value_property"), ReadPointer<FField>());
+		Out->SetNumberField(TEXT("num"), Read<int32>());
+		ReadUntil(Out, TEXT("elements"), EX_EndMapConst);
+		break;
+
+	// ---- Casts ----
+	case EX_PrimitiveCast:
+		SetOp(TEXT("EX_PrimitiveCast"));
+		Out->SetNumberField(TEXT("conversion"), Read<uint8>());
+		ReadChild(Out, TEXT("expr"));
+		break;
+	case EX_DynamicCast:
+	case EX_MetaCast:
+	case EX_ObjToInterfaceCast:
+	case EX_CrossInterfaceCast:
+	case EX_InterfaceToObjCast:
+		SetOp(Token == EX_DynamicCast ? TEXT("EX_DynamicCast") : Token == EX_MetaCast ? TEXT("EX_MetaCast") :
+		      Token == EX_ObjToInterfaceCast ? TEXT("EX_ObjToInterfaceCast") : Token == EX_CrossInterfaceCast ? TEXT("EX_CrossInterfaceCast") : TEXT("EX_InterfaceToObjCast"));
+		SetObject(Out, TEXT("class"), ReadPointer<UClass>());
+		ReadChild(Out, TEXT("expr"));
+		break;
+
+	// ---- Delegates ----
+	case EX_BindDelegate:
+		SetOp(TEXT("EX_BindDelegate"));
+		Out->SetStringField(TEXT("function"), ReadName().ToString());
+		ReadChild(Out, TEXT("delegate"));
+		ReadChild(Out, TEXT("object"));
+		break;
+	case EX_AddMulticastDelegate:
+	case EX_RemoveMulticastDelegate:
+		SetOp(Token == EX_AddMulticastDelegate ? TEXT("EX_AddMulticastDelegate") : TEXT("EX_RemoveMulticastDelegate"));
+		ReadChild(Out, TEXT("delegate"));
+		ReadChild(Out, TEXT("value"));
+		break;
+	case EX_ClearMulticastDelegate:
+		SetOp(TEXT("EX_ClearMulticastDelegate"));
+		ReadChild(Out, TEXT("delegate"));
+		break;
+
+	// ---- Debugging and instrumentation ----
+	case EX_Nothing:          SetOp(TEXT("EX_Nothing")); break;
+	case EX_DeprecatedOp4A:   SetOp(TEXT("EX_DeprecatedOp4A")); break;
+	case EX_Breakpoint:       SetOp(TEXT("EX_Breakpoint")); break;
+	case EX_Tracepoint:       SetOp(TEXT("EX_Tracepoint")); break;
+	case EX_WireTracepoint:   SetOp(TEXT("EX_WireTracepoint")); break;
+	case EX_InstrumentationEvent:
+	{
+		SetOp(TEXT("EX_InstrumentationEvent"));
+		const uint8 EventType = Read<uint8>();
+		Out->SetNumberField(TEXT("event_type"), EventType);
+		if (EventType == EScriptInstrumentation::InlineEvent)
+			Out->SetStringField(TEXT("name"), ReadName().ToString());
+		break;
+	}
+
+	// ---- Terminators ----
+	case EX_EndOfScript:        SetOp(TEXT("EX_EndOfScript")); break;
+	case EX_EndFunctionParms:   SetOp(TEXT("EX_EndFunctionParms")); break;
+	case EX_EndStructConst:     SetOp(TEXT("EX_EndStructConst")); break;
+	case EX_EndArray:           SetOp(TEXT("EX_EndArray")); break;
+	case EX_EndArrayConst:      SetOp(TEXT("EX_EndArrayConst")); break;
+	case EX_EndSet:             SetOp(TEXT("EX_EndSet")); break;
+	case EX_EndSetConst:        SetOp(TEXT("EX_EndSetConst")); break;
+	case EX_EndMap:             SetOp(TEXT("EX_EndMap")); break;
+	case EX_EndMapConst:        SetOp(TEXT("EX_EndMapConst")); break;
+
+	default:
+		SetOp(TEXT("Unknown"));
+		Out->SetNumberField(TEXT("token"), Token);
+		Fail(FString::Printf(TEXT("Unknown opcode 0x%02X at offset %d"), Token, ExprOffset));
+		break;
+	}
+
+	--Depth;
+	return Token;
+}
+
+TSharedPtr<FJsonObject> DisassembleFunctionBytecode(const UFunction* Function)
+{
+	TSharedPtr<FJsonObject> FunctionObj = MakeShareable(new FJsonObject());
+	FunctionObj->SetStringField(TEXT("name"), Function->GetName());
+	FunctionObj->SetNumberField(TEXT("script_size"), Function->Script.Num());
+
+	FBytecodeReader Reader(Function->Script);
+
+	TArray<TSharedPtr<FJsonObject>> Statements;
+	while (!Reader.AtEnd() && !Reader.HasError())
+	{
+		TSharedPtr<FJsonObject> Statement = MakeShareable(new FJsonObject());
+		const uint8 Token = Reader.ReadExpr(Statement);
+		Statements.Add(Statement);
+
+		if (Token == EX_EndOfScript)
+			break;
+	}
+
+	TArray<int32> JumpTargets = Reader.JumpTargets.Array();
+	JumpTargets.Sort();
+
+	TArray<TSharedPtr<FJsonValue>> StatementValues;
+	for (const TSharedPtr<FJsonObject>& Statement : Statements)
+	{
+		if (Reader.JumpTargets.Contains(static_cast<int32>(Statement->GetNumberField(TEXT("offset")))))
+			Statement->SetBoolField(TEXT("is_jump_target"), true);
+		StatementValues.Add(MakeShareable(new FJsonValueObject(Statement)));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> TargetValues;
+	for (const int32 Target : JumpTargets)
+		TargetValues.Add(MakeShareable(new FJsonValueNumber(Target)));
+
+	FunctionObj->SetArrayField(TEXT("statements"), StatementValues);
+	FunctionObj->SetArrayField(TEXT("jump_targets"), TargetValues);
+
+	if (Reader.HasError())
+		FunctionObj->SetStringField(TEXT("error"), Reader.GetError());
+
+	return FunctionObj;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class UFunction;
+
+/**
+ * Decodes a compiled function's Kismet bytecode (UFunction::Script) into JSON, following the
+ * same token layout FKismetBytecodeDisassembler reads. Each top-level statement becomes an
+ * object with its byte offset, its EX_ opcode and its operands; nested expressions are written
+ * inline. Function, property, class and object operands are resolved to names and paths.
+ *
+ * The result has "statements" and "jump_targets", the sorted absolute offsets that EX_Jump,
+ * EX_JumpIfNot and EX_PushExecutionFlow can transfer control to; statements at those offsets
+ * are marked is_jump_target. On an opcode this walker doesn't know, decoding stops: the
+ * statements read so far are kept and "error" names the opcode and offset, since the remaining
+ * bytes can't be framed without knowing its operands.
+ */
+TSharedPtr<FJsonObject> DisassembleFunctionBytecode(const UFunction* Function);
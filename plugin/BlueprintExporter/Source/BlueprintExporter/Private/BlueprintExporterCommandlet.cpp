@@ -0,0 +1,98 @@
+#include "BlueprintExporterCommandlet.h"
+#include "BlueprintExporterAnalyzer.h"
+#include "BlueprintExporterPlanner.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+UBlueprintExporterCommandlet::UBlueprintExporterCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UBlueprintExporterCommandlet::Main(const FString& Params)
+{
+	FString Mode;
+	FString Filter;
+	FString OutputPath;
+	FParse::Value(*Params, TEXT("mode="), Mode);
+	FParse::Value(*Params, TEXT("filter="), Filter);
+	FParse::Value(*Params, TEXT("output="), OutputPath);
+
+	// Commandlets start before the registry has scanned the project
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	if (Mode == TEXT("analyze"))
+	{
+		if (OutputPath.IsEmpty())
+			OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintExporter"), TEXT("blueprint_analysis.json"));
+		return RunAnalyze(Filter, OutputPath);
+	}
+
+	if (Mode == TEXT("plan"))
+	{
+		if (OutputPath.IsEmpty())
+			OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintExporter"), TEXT("conversion_plan.json"));
+		return RunPlan(Filter, OutputPath, FParse::Param(*Params, TEXT("deep")));
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Unknown mode '%s'. Usage: -run=BlueprintExporter -mode=analyze|plan [-filter=/Game/Path] [-output=File.json] [-deep]"), *Mode);
+	return 1;
+}
+
+int32 UBlueprintExporterCommandlet::RunAnalyze(const FString& Filter, const FString& OutputPath)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FBlueprintAnalysisSnapshot> Snapshots;
+	FBlueprintExporterAnalyzer::SnapshotBlueprints(Filter, Snapshots);
+
+	TArray<FBlueprintAnalysisResult> Results;
+	FBlueprintExporterAnalyzer::Analyze(Snapshots, Results);
+
+	if (!FBlueprintExporterAnalyzer::WriteReport(Results, OutputPath))
+		return 1;
+
+	const int32 NumShown = FMath::Min(Results.Num(), 20);
+	for (int32 Rank = 0; Rank < NumShown; Rank++)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  %2d. %-60s score %.0f (%d nodes)"), Rank + 1, *Results[Rank].BlueprintPath, Results[Rank].Score, Results[Rank].NodeCount);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("BlueprintExporter: Analyzed %d blueprints in %.1fs"), Results.Num(), FPlatformTime::Seconds() - StartTime);
+	return 0;
+}
+
+int32 UBlueprintExporterCommandlet::RunPlan(const FString& Filter, const FString& OutputPath, bool bDeep)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FConversionPlanAsset> Assets;
+	FBlueprintExporterPlanner::GatherAssets(Filter, Assets);
+	if (bDeep)
+		FBlueprintExporterPlanner::AddLoadedReferences(Assets);
+
+	FConversionPlan Plan;
+	FBlueprintExporterPlanner::BuildPlan(MoveTemp(Assets), Plan);
+
+	if (!FBlueprintExporterPlanner::WritePlan(Plan, OutputPath))
+		return 1;
+
+	for (int32 WaveIndex = 0; WaveIndex < Plan.Waves.Num(); WaveIndex++)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  Wave %2d: %d assets"), WaveIndex, Plan.Waves[WaveIndex].Num());
+	}
+
+	for (const TArray<int32>& Cycle : Plan.Cycles)
+	{
+		TArray<FString> Members;
+		for (const int32 Member : Cycle)
+			Members.Add(Plan.Assets[Member].PackageName.ToString());
+		UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Dependency cycle: %s"), *FString::Join(Members, TEXT(" <-> ")));
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("BlueprintExporter: Planned %d assets in %d waves (%d cycles) in %.1fs"), Plan.Assets.Num(), Plan.Waves.Num(), Plan.Cycles.Num(), FPlatformTime::Seconds() - StartTime);
+	return 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BlueprintExporterCommandlet.generated.h"
+
+/**
+ * Batch entry point for project-wide Blueprint reports.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=BlueprintExporter -mode=analyze [-filter=/Game/Path] [-output=File.json]
+ * UnrealEditor-Cmd <Project>.uproject -run=BlueprintExporter -mode=plan [-filter=/Game/Path] [-output=File.json] [-deep]
+ */
+UCLASS()
+class UBlueprintExporterCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBlueprintExporterCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 RunAnalyze(const FString& Filter, const FString& OutputPath);
+	int32 RunPlan(const FString& Filter, const FString& OutputPath, bool bDeep);
+};
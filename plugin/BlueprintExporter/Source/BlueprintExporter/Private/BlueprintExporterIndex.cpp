@@ -0,0 +1,456 @@
+#include "BlueprintExporterIndex.h"
+#include "BlueprintExporterUtils.h"
+#include "BlueprintExporterTrace.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Framework/Application/SlateApplication.h"
+#include "K2Node_Event.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+// Time after which no further Blueprint is indexed in the same editor frame; checked between Blueprints
+static const double INDEX_BUILD_BUDGET_SECONDS = 0.005;
+
+// Asynchronous Blueprint loads the build keeps going at once
+static const int32 INDEX_MAX_LOADS_IN_FLIGHT = 4;
+
+// Seconds without keyboard or mouse input before the build starts loading Blueprints
+static const double INDEX_LOAD_IDLE_SECONDS = 2.0;
+
+bool FBlueprintIndexQuery::HasKeyTerms() const
+{
+	return !NodeType.IsNone() || !FunctionName.IsNone() || !TargetClass.IsNone() || !EventName.IsNone() ||
+	       !VariableName.IsNone() || !TargetType.IsNone() || !MacroName.IsNone() || !Entry.IsNone();
+}
+
+void FBlueprintExporterIndex::Start()
+{
+	LoadCallbacksValid = MakeShared<bool>(true);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FBlueprintExporterIndex::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FBlueprintExporterIndex::OnAssetRenamed);
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FBlueprintExporterIndex::OnPackageSaved);
+
+	// The registry scan must finish before the Blueprint list is complete
+	if (AssetRegistry.IsLoadingAssets())
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FBlueprintExporterIndex::OnFilesLoaded);
+	else
+		EnqueueAllBlueprints();
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FBlueprintExporterIndex::Tick));
+}
+
+void FBlueprintExporterIndex::Stop()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	if (LoadCallbacksValid)
+	{
+		*LoadCallbacksValid = false;
+		LoadCallbacksValid.Reset();
+	}
+	NumLoadsInFlight = 0;
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	Records.Empty();
+	RecordsByBlueprint.Empty();
+	Postings.Empty();
+}
+
+int32 FBlueprintExporterIndex::GetNumIndexedBlueprints() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return RecordsByBlueprint.Num();
+}
+
+void FBlueprintExporterIndex::OnFilesLoaded()
+{
+	EnqueueAllBlueprints();
+}
+
+void FBlueprintExporterIndex::EnqueueAllBlueprints()
+{
+	if (bInitialBuildQueued)
+		return;
+	bInitialBuildQueued = true;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FAssetData> AssetList;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetList, true);
+
+	for (const FAssetData& Asset : AssetList)
+	{
+		// Project content only; engine and plugin Blueprints would dominate the build time
+		if (!Asset.PackageName.ToString().StartsWith(TEXT("/Game/")))
+			continue;
+
+		EnqueueBlueprint(Asset.PackageName);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Indexing %d blueprints in the background"), PendingBlueprints.Num());
+
+	// A project without Blueprints has nothing for Tick to finish
+	CompleteInitialBuildIfDone();
+}
+
+void FBlueprintExporterIndex::EnqueueBlueprint(const FName PackageName)
+{
+	bool bAlreadyPending = false;
+	PendingSet.Add(PackageName, &bAlreadyPending);
+	if (!bAlreadyPending)
+		PendingBlueprints.Add(PackageName);
+	NumPending = PendingBlueprints.Num() + NumLoadsInFlight;
+}
+
+static FString GetBlueprintObjectPath(const FName PackageName)
+{
+	const FString PackageString = PackageName.ToString();
+	return PackageString + TEXT(".") + FPackageName::GetShortName(PackageString);
+}
+
+bool FBlueprintExporterIndex::Tick(float DeltaTime)
+{
+	// Loading assets mid-PIE or during GC causes hitches and is not safe
+	if (PendingBlueprints.Num() == 0 || IsGarbageCollecting() || (GEditor && GEditor->PlayWorld))
+		return true;
+
+	// Loads only start while nobody is using the editor; Blueprints in memory are indexed regardless
+	const bool bMayLoad = FSlateApplication::IsInitialized() && FPlatformTime::Seconds() - FSlateApplication::Get().GetLastUserInteractionTime() >= INDEX_LOAD_IDLE_SECONDS;
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (PendingBlueprints.Num() > 0 && FPlatformTime::Seconds() - StartTime < INDEX_BUILD_BUDGET_SECONDS)
+	{
+		const FName PackageName = PendingBlueprints.Last();
+
+		const UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+		if (Package && Package->IsFullyLoaded())
+		{
+			PendingBlueprints.Pop(false);
+			PendingSet.Remove(PackageName);
+			IndexBlueprint(PackageName, FindObject<UBlueprint>(nullptr, *GetBlueprintObjectPath(PackageName)));
+			continue;
+		}
+
+		if (!bMayLoad || NumLoadsInFlight >= INDEX_MAX_LOADS_IN_FLIGHT)
+			break;
+
+		PendingBlueprints.Pop(false);
+		PendingSet.Remove(PackageName);
+		StartLoad(PackageName);
+	}
+	NumPending = PendingBlueprints.Num() + NumLoadsInFlight;
+
+	CompleteInitialBuildIfDone();
+	return true;
+}
+
+void FBlueprintExporterIndex::StartLoad(const FName PackageName)
+{
+	NumLoadsInFlight++;
+
+	TSharedPtr<bool> bCallbackValid = LoadCallbacksValid;
+	LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+		[this, PackageName, bCallbackValid](const FName& LoadedPackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+		{
+			if (!*bCallbackValid)
+				return;
+
+			NumLoadsInFlight--;
+
+			// A failed load leaves nothing to index; IndexBlueprint drops any records it had
+			const UBlueprint* Blueprint = nullptr;
+			if (Result == EAsyncLoadingResult::Succeeded)
+				Blueprint = FindObject<UBlueprint>(nullptr, *GetBlueprintObjectPath(PackageName));
+			IndexBlueprint(PackageName, Blueprint);
+
+			NumPending = PendingBlueprints.Num() + NumLoadsInFlight;
+			CompleteInitialBuildIfDone();
+		}));
+}
+
+void FBlueprintExporterIndex::CompleteInitialBuildIfDone()
+{
+	if (bInitialBuildDone || !bInitialBuildQueued || PendingBlueprints.Num() > 0 || NumLoadsInFlight > 0)
+		return;
+
+	bInitialBuildDone = true;
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Graph index built (%d blueprints)"), GetNumIndexedBlueprints());
+}
+
+void FBlueprintExporterIndex::IndexBlueprint(const FName PackageName, const UBlueprint* Blueprint)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::IndexBlueprint);
+
+	// Build the new records without holding the lock, then swap them in
+	TArray<FBlueprintIndexResult> NewRecords;
+
+	if (Blueprint)
+	{
+		TArray<UEdGraph*> Graphs;
+		Graphs.Append(Blueprint->UbergraphPages);
+		Graphs.Append(Blueprint->FunctionGraphs);
+		Graphs.Append(Blueprint->MacroGraphs);
+
+		for (const UEdGraph* Graph : Graphs)
+		{
+			if (!Graph)
+				continue;
+
+			// Which entry points reach each node: events in event graphs, the function itself otherwise
+			TMap<const UEdGraphNode*, TArray<FName>> NodeEntries;
+			const bool bEventGraph = Blueprint->UbergraphPages.Contains(Graph);
+
+			if (bEventGraph)
+			{
+				for (const UEdGraphNode* Node : Graph->Nodes)
+				{
+					if (!Node || !Node->IsA<UK2Node_Event>())
+						continue;
+
+					const FName EventName(*DescribeBlueprintNode(Node).EventName);
+					TSet<const UEdGraphNode*> Reachable;
+					CollectReachableNodes(Node, Reachable);
+
+					for (const UEdGraphNode* Reached : Reachable)
+						NodeEntries.FindOrAdd(Reached).AddUnique(EventName);
+				}
+			}
+
+			for (const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node)
+					continue;
+
+				const FBlueprintNodeInfo Info = DescribeBlueprintNode(Node);
+
+				FBlueprintIndexResult& Record = NewRecords.AddDefaulted_GetRef();
+				Record.BlueprintPath = PackageName;
+				Record.GraphName = Graph->GetFName();
+				Record.NodeName = Node->GetFName();
+				Record.NodeType = FName(*Info.NodeType);
+				Record.FunctionName = Info.FunctionName.IsEmpty() ? NAME_None : FName(*Info.FunctionName);
+				Record.TargetClass = Info.TargetClass.IsEmpty() ? NAME_None : FName(*Info.TargetClass);
+				Record.EventName = Info.EventName.IsEmpty() ? NAME_None : FName(*Info.EventName);
+				Record.VariableName = Info.VariableName.IsEmpty() ? NAME_None : FName(*Info.VariableName);
+				Record.TargetType = Info.TargetType.IsEmpty() ? NAME_None : FName(*Info.TargetType);
+				Record.MacroName = Info.MacroName.IsEmpty() ? NAME_None : FName(*Info.MacroName);
+
+				if (bEventGraph)
+				{
+					if (const TArray<FName>* Entries = NodeEntries.Find(Node))
+						Record.Entries = *Entries;
+				}
+				else
+				{
+					Record.Entries.Add(Graph->GetFName());
+				}
+			}
+		}
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	RemoveBlueprint_Locked(PackageName);
+
+	if (!Blueprint)
+		return;
+
+	TArray<int32>& BlueprintRecords = RecordsByBlueprint.Add(PackageName);
+	BlueprintRecords.Reserve(NewRecords.Num());
+
+	for (FBlueprintIndexResult& Record : NewRecords)
+	{
+		const int32 RecordId = Records.Add(MoveTemp(Record));
+		const FBlueprintIndexResult& Added = Records[RecordId];
+		BlueprintRecords.Add(RecordId);
+
+		auto AddPosting = [this, RecordId](EField Field, FName Value)
+		{
+			if (!Value.IsNone())
+				Postings.FindOrAdd(FTermKey(Field, Value)).Add(RecordId);
+		};
+
+		AddPosting(EField::NodeType, Added.NodeType);
+		AddPosting(EField::Function, Added.FunctionName);
+		AddPosting(EField::TargetClass, Added.TargetClass);
+		AddPosting(EField::Event, Added.EventName);
+		AddPosting(EField::Variable, Added.VariableName);
+		AddPosting(EField::TargetType, Added.TargetType);
+		AddPosting(EField::Macro, Added.MacroName);
+		for (const FName Entry : Added.Entries)
+			AddPosting(EField::Entry, Entry);
+	}
+}
+
+void FBlueprintExporterIndex::RemoveBlueprint_Locked(const FName PackageName)
+{
+	TArray<int32> OldRecords;
+	if (!RecordsByBlueprint.RemoveAndCopyValue(PackageName, OldRecords))
+		return;
+
+	for (const int32 RecordId : OldRecords)
+	{
+		const FBlueprintIndexResult& Record = Records[RecordId];
+
+		auto RemovePosting = [this, RecordId](EField Field, FName Value)
+		{
+			if (Value.IsNone())
+				return;
+
+			const FTermKey Key(Field, Value);
+			if (TSet<int32>* Posting = Postings.Find(Key))
+			{
+				Posting->Remove(RecordId);
+				if (Posting->Num() == 0)
+					Postings.Remove(Key);
+			}
+		};
+
+		RemovePosting(EField::NodeType, Record.NodeType);
+		RemovePosting(EField::Function, Record.FunctionName);
+		RemovePosting(EField::TargetClass, Record.TargetClass);
+		RemovePosting(EField::Event, Record.EventName);
+		RemovePosting(EField::Variable, Record.VariableName);
+		RemovePosting(EField::TargetType, Record.TargetType);
+		RemovePosting(EField::Macro, Record.MacroName);
+		for (const FName Entry : Record.Entries)
+			RemovePosting(EField::Entry, Entry);
+
+		Records.RemoveAt(RecordId);
+	}
+}
+
+bool FBlueprintExporterIndex::Query(const FBlueprintIndexQuery& InQuery, TArray<FBlueprintIndexResult>& OutResults, bool& bOutTruncated) const
+{
+	bOutTruncated = false;
+
+	if (!InQuery.HasKeyTerms())
+		return false;
+
+	TArray<FTermKey, TInlineAllocator<8>> Terms;
+	auto AddTerm = [&Terms](EField Field, FName Value)
+	{
+		if (!Value.IsNone())
+			Terms.Emplace(Field, Value);
+	};
+
+	AddTerm(EField::NodeType, InQuery.NodeType);
+	AddTerm(EField::Function, InQuery.FunctionName);
+	AddTerm(EField::TargetClass, InQuery.TargetClass);
+	AddTerm(EField::Event, InQuery.EventName);
+	AddTerm(EField::Variable, InQuery.VariableName);
+	AddTerm(EField::TargetType, InQuery.TargetType);
+	AddTerm(EField::Macro, InQuery.MacroName);
+	AddTerm(EField::Entry, InQuery.Entry);
+
+	FReadScopeLock ReadLock(Lock);
+
+	// Walk the smallest posting list and probe the others
+	TArray<const TSet<int32>*, TInlineAllocator<8>> TermPostings;
+	const TSet<int32>* Smallest = nullptr;
+	for (const FTermKey& Term : Terms)
+	{
+		const TSet<int32>* Posting = Postings.Find(Term);
+		if (!Posting)
+			return true;
+
+		TermPostings.Add(Posting);
+		if (!Smallest || Posting->Num() < Smallest->Num())
+			Smallest = Posting;
+	}
+
+	TArray<int32> Matches;
+	for (const int32 RecordId : *Smallest)
+	{
+		bool bMatches = true;
+		for (const TSet<int32>* Posting : TermPostings)
+		{
+			if (Posting != Smallest && !Posting->Contains(RecordId))
+			{
+				bMatches = false;
+				break;
+			}
+		}
+
+		const FBlueprintIndexResult& Record = Records[RecordId];
+		if (!bMatches || (!InQuery.BlueprintFilter.IsEmpty() && !Record.BlueprintPath.ToString().Contains(InQuery.BlueprintFilter)))
+			continue;
+
+		Matches.Add(RecordId);
+	}
+
+	// Sort every match before cutting, so the page is the first MaxResults in order rather than whichever the set yielded
+	Matches.Sort([this](int32 IdA, int32 IdB)
+	{
+		const FBlueprintIndexResult& A = Records[IdA];
+		const FBlueprintIndexResult& B = Records[IdB];
+		if (A.BlueprintPath != B.BlueprintPath)
+			return A.BlueprintPath.LexicalLess(B.BlueprintPath);
+		if (A.GraphName != B.GraphName)
+			return A.GraphName.LexicalLess(B.GraphName);
+		return A.NodeName.LexicalLess(B.NodeName);
+	});
+
+	bOutTruncated = Matches.Num() > InQuery.MaxResults;
+	const int32 NumResults = FMath::Min(Matches.Num(), InQuery.MaxResults);
+	OutResults.Reserve(NumResults);
+	for (int32 i = 0; i < NumResults; i++)
+		OutResults.Add(Records[Matches[i]]);
+
+	return true;
+}
+
+void FBlueprintExporterIndex::OnPackageSaved(const FString& Filename, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (!Package)
+		return;
+
+	bool bHasBlueprint = false;
+	ForEachObjectWithPackage(Package, [&bHasBlueprint](UObject* Object)
+	{
+		bHasBlueprint = Object->IsA<UBlueprint>();
+		return !bHasBlueprint;
+	}, false);
+
+	if (!bHasBlueprint)
+		return;
+
+	// Re-index on the next tick; the Blueprint is already loaded so this is cheap
+	EnqueueBlueprint(Package->GetFName());
+}
+
+void FBlueprintExporterIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	FWriteScopeLock WriteLock(Lock);
+	RemoveBlueprint_Locked(AssetData.PackageName);
+}
+
+void FBlueprintExporterIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	const FName OldPackageName(*FPackageName::ObjectPathToPackageName(OldObjectPath));
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (!RecordsByBlueprint.Contains(OldPackageName))
+			return;
+		RemoveBlueprint_Locked(OldPackageName);
+	}
+
+	EnqueueBlueprint(AssetData.PackageName);
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+class UBlueprint;
+class UPackage;
+class FObjectPostSaveContext;
+struct FAssetData;
+
+/** Query for FBlueprintExporterIndex; empty fields match anything. */
+struct FBlueprintIndexQuery
+{
+	FName NodeType;
+	FName FunctionName;
+	FName TargetClass;
+	FName EventName;
+	FName VariableName;
+	FName TargetType;
+	FName MacroName;
+
+	/** Event (or function graph) whose execution reaches the node, e.g. ReceiveTick */
+	FName Entry;
+
+	/** Substring filter on the Blueprint package path */
+	FString BlueprintFilter;
+
+	int32 MaxResults = 1000;
+
+	bool HasKeyTerms() const;
+};
+
+struct FBlueprintIndexResult
+{
+	FName BlueprintPath;
+	FName GraphName;
+	FName NodeName;
+	FName NodeType;
+	FName FunctionName;
+	FName TargetClass;
+	FName EventName;
+	FName VariableName;
+	FName TargetType;
+	FName MacroName;
+	TArray<FName> Entries;
+};
+
+/**
+ * Inverted index over every Blueprint's graph nodes, keyed on the fields ExportNode extracts.
+ *
+ * The initial build walks the asset registry and indexes Blueprints on the game thread under a
+ * per-frame budget. Blueprints already in memory are indexed straight away; the rest are loaded
+ * asynchronously, a few at a time and only once the editor has been idle for a moment, and
+ * indexed when their load completes. The budget is checked between Blueprints, so one large
+ * graph can still overrun it. After that, saved packages are re-indexed and removed or renamed
+ * assets are dropped. Queries take a read lock only and can run on any thread.
+ */
+class FBlueprintExporterIndex
+{
+public:
+	void Start();
+	void Stop();
+
+	/** Returns false if the query would match too much to be useful (no key terms at all). */
+	bool Query(const FBlueprintIndexQuery& InQuery, TArray<FBlueprintIndexResult>& OutResults, bool& bOutTruncated) const;
+
+	bool IsBuilt() const { return bInitialBuildDone; }
+	int32 GetNumIndexedBlueprints() const;
+	int32 GetNumPendingBlueprints() const { return NumPending; }
+
+private:
+	enum class EField : uint8
+	{
+		NodeType,
+		Function,
+		TargetClass,
+		Event,
+		Variable,
+		TargetType,
+		Macro,
+		Entry
+	};
+
+	using FTermKey = TPair<EField, FName>;
+
+	void EnqueueAllBlueprints();
+	void EnqueueBlueprint(const FName PackageName);
+	bool Tick(float DeltaTime);
+	void StartLoad(const FName PackageName);
+	void CompleteInitialBuildIfDone();
+	void IndexBlueprint(const FName PackageName, const UBlueprint* Blueprint);
+	void RemoveBlueprint_Locked(const FName PackageName);
+
+	void OnPackageSaved(const FString& Filename, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnFilesLoaded();
+
+	mutable FRWLock Lock;
+
+	TSparseArray<FBlueprintIndexResult> Records;
+	TMap<FName, TArray<int32>> RecordsByBlueprint;
+	TMap<FTermKey, TSet<int32>> Postings;
+
+	// Game-thread state for the background build and incremental updates
+	TArray<FName> PendingBlueprints;
+	TSet<FName> PendingSet;
+	int32 NumLoadsInFlight = 0;
+	bool bInitialBuildQueued = false;
+
+	/** Cleared by Stop, so a load completing afterwards doesn't touch the index */
+	TSharedPtr<bool> LoadCallbacksValid;
+
+	// Read by queries from other threads
+	std::atomic<bool> bInitialBuildDone{false};
+	std::atomic<int32> NumPending{0};
+
+	FTSTicker::FDelegateHandle TickHandle;
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
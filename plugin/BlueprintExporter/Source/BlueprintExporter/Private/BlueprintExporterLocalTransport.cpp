@@ -0,0 +1,506 @@
+#include "BlueprintExporterLocalTransport.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+
+// Added to every request read from the socket; HTTP requests never carry it
+static const TCHAR* LOCAL_REQUEST_HEADER = TEXT("X-BlueprintExporter-Local");
+
+// Byte offset in a handler's response body where the status JSON ends and the attached payload begins
+static const TCHAR* LOCAL_PAYLOAD_OFFSET_HEADER = TEXT("X-BlueprintExporter-Payload-Offset");
+
+bool FBlueprintExporterLocalTransport::WantsInlinePayload(const FHttpServerRequest& Request)
+{
+	const FString* PayloadParam = Request.QueryParams.Find(TEXT("payload"));
+	return PayloadParam && PayloadParam->ToBool() && Request.Headers.Contains(LOCAL_REQUEST_HEADER);
+}
+
+TUniquePtr<FHttpServerResponse> FBlueprintExporterLocalTransport::MakePayloadResponse(const FString& StatusJson, TArray<uint8>&& Payload)
+{
+	FTCHARToUTF8 StatusUtf8(*StatusJson);
+
+	TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+	Response->Code = EHttpServerResponseCodes::Ok;
+	Response->Headers.Add(TEXT("Content-Type"), { TEXT("application/json") });
+	Response->Headers.Add(LOCAL_PAYLOAD_OFFSET_HEADER, { FString::FromInt(StatusUtf8.Length()) });
+
+	Response->Body.Reserve(StatusUtf8.Length() + Payload.Num());
+	Response->Body.Append(reinterpret_cast<const uint8*>(StatusUtf8.Get()), StatusUtf8.Length());
+	Response->Body.Append(MoveTemp(Payload));
+	return Response;
+}
+
+#if PLATFORM_UNIX || PLATFORM_MAC
+
+#include "HttpResultCallback.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+
+static const uint8 LOCAL_FRAME_RESPONSE = 1;
+static const uint8 LOCAL_FRAME_PAYLOAD = 2;
+static const uint8 LOCAL_FRAME_SHARED_PAYLOAD = 3;
+
+// Requests are a path and query string; anything bigger is a broken or hostile client
+static const uint32 MAX_LOCAL_REQUEST_SIZE = 64 * 1024;
+
+// Payloads at least this large go through shared memory rather than the socket
+static const int64 LOCAL_INLINE_PAYLOAD_LIMIT = 256 * 1024;
+
+static const int32 MAX_LOCAL_CONNECTIONS = 16;
+
+// How often a connection waiting on the game thread checks whether the transport is stopping
+static const uint32 LOCAL_RESPONSE_POLL_MS = 100;
+
+#ifdef MSG_NOSIGNAL
+static const int LOCAL_SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int LOCAL_SEND_FLAGS = 0;
+#endif
+
+static bool ReadExact(int32 Socket, uint8* Data, int64 Size)
+{
+	while (Size > 0)
+	{
+		const ssize_t Received = recv(Socket, Data, Size, 0);
+		if (Received < 0 && errno == EINTR)
+			continue;
+		if (Received <= 0)
+			return false;
+
+		Data += Received;
+		Size -= Received;
+	}
+	return true;
+}
+
+static bool WriteExact(int32 Socket, const uint8* Data, int64 Size)
+{
+	while (Size > 0)
+	{
+		const ssize_t Sent = send(Socket, Data, Size, LOCAL_SEND_FLAGS);
+		if (Sent < 0 && errno == EINTR)
+			continue;
+		if (Sent <= 0)
+			return false;
+
+		Data += Sent;
+		Size -= Sent;
+	}
+	return true;
+}
+
+static void AppendLittleEndian(TArray<uint8>& Out, uint64 Value, int32 NumBytes)
+{
+	for (int32 Byte = 0; Byte < NumBytes; Byte++)
+		Out.Add(static_cast<uint8>(Value >> (8 * Byte)));
+}
+
+static bool ReadFrame(int32 Socket, TArray<uint8>& OutFrame)
+{
+	uint8 Header[4];
+	if (!ReadExact(Socket, Header, sizeof(Header)))
+		return false;
+
+	const uint32 Size = Header[0] | (Header[1] << 8) | (Header[2] << 16) | (static_cast<uint32>(Header[3]) << 24);
+	if (Size > MAX_LOCAL_REQUEST_SIZE)
+		return false;
+
+	OutFrame.SetNumUninitialized(Size);
+	return ReadExact(Socket, OutFrame.GetData(), Size);
+}
+
+/** Writes one frame; Header is the kind byte and any fixed fields, Body is sent without copying */
+static bool WriteFrame(int32 Socket, const TArray<uint8>& Header, const uint8* Body, int64 BodySize)
+{
+	TArray<uint8> Prefix;
+	AppendLittleEndian(Prefix, Header.Num() + BodySize, 4);
+	Prefix.Append(Header);
+
+	return WriteExact(Socket, Prefix.GetData(), Prefix.Num()) && WriteExact(Socket, Body, BodySize);
+}
+
+static FHttpServerRequest MakeLocalRequest(const FString& Line, FString& OutPath)
+{
+	FString Query;
+	if (!Line.Split(TEXT("?"), &OutPath, &Query))
+		OutPath = Line;
+
+	FHttpServerRequest Request;
+	Request.Verb = EHttpServerRequestVerbs::VERB_GET;
+	Request.RelativePath = FHttpPath(OutPath);
+	Request.Headers.Add(LOCAL_REQUEST_HEADER, { TEXT("1") });
+
+	TArray<FString> Params;
+	Query.ParseIntoArray(Params, TEXT("&"));
+	for (const FString& Param : Params)
+	{
+		FString Key;
+		FString Value;
+		if (!Param.Split(TEXT("="), &Key, &Value))
+			Key = Param;
+
+		Request.QueryParams.Add(FGenericPlatformHttp::UrlDecode(Key), FGenericPlatformHttp::UrlDecode(Value));
+	}
+
+	return Request;
+}
+
+static TUniquePtr<FHttpServerResponse> MakeLocalError(const FString& Error, EHttpServerResponseCodes Code)
+{
+	TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+	ResponseObj->SetBoolField(TEXT("success"), false);
+	ResponseObj->SetStringField(TEXT("error"), Error);
+
+	FString ResponseStr;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseStr);
+	FJsonSerializer::Serialize(ResponseObj, Writer);
+
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(ResponseStr, TEXT("application/json"));
+	Response->Code = Code;
+	return Response;
+}
+
+/** Handed to the route handler; the connection thread waits on Done */
+struct FLocalPendingResponse
+{
+	FCriticalSection Lock;
+	TUniquePtr<FHttpServerResponse> Response;
+	FEventRef Done;
+};
+
+bool FBlueprintExporterLocalTransport::IsSupported()
+{
+	return true;
+}
+
+bool FBlueprintExporterLocalTransport::Start(const FString& InSocketPath, const TMap<FString, FHttpRequestHandler>& InRoutes, const TSet<FString>& InAnyThreadRoutes)
+{
+	SocketPath = InSocketPath;
+	Routes = InRoutes;
+	AnyThreadRoutes = InAnyThreadRoutes;
+	bStopping = false;
+	HandlersValid = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(true);
+
+	FTCHARToUTF8 PathUtf8(*SocketPath);
+
+	sockaddr_un Address = {};
+	Address.sun_family = AF_UNIX;
+	if (PathUtf8.Length() >= static_cast<int32>(sizeof(Address.sun_path)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Socket path is too long: %s"), *SocketPath);
+		return false;
+	}
+	FMemory::Memcpy(Address.sun_path, PathUtf8.Get(), PathUtf8.Length());
+
+	const int32 Socket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (Socket < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to create local socket (errno %d)"), errno);
+		return false;
+	}
+
+	// A previous editor that crashed leaves its socket file behind
+	unlink(Address.sun_path);
+
+	if (bind(Socket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0 || listen(Socket, MAX_LOCAL_CONNECTIONS) != 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to listen on %s (errno %d)"), *SocketPath, errno);
+		close(Socket);
+		return false;
+	}
+
+	// accept() only runs once poll() reports a connection, and must not block if it was dropped since
+	if (pipe(WakePipe) != 0 || fcntl(Socket, F_SETFL, fcntl(Socket, F_GETFL) | O_NONBLOCK) != 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to set up the local socket accept loop (errno %d)"), errno);
+		if (WakePipe[0] >= 0)
+		{
+			close(WakePipe[0]);
+			close(WakePipe[1]);
+			WakePipe[0] = WakePipe[1] = -1;
+		}
+		close(Socket);
+		unlink(Address.sun_path);
+		return false;
+	}
+
+	ListenSocket = Socket;
+	AcceptThread = Async(EAsyncExecution::Thread, [this]() { AcceptConnections(); });
+
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Local socket listening on %s"), *SocketPath);
+	return true;
+}
+
+void FBlueprintExporterLocalTransport::Stop()
+{
+	if (ListenSocket < 0)
+		return;
+
+	bStopping = true;
+
+	// Game thread tasks still queued for a connection must not call into handlers after this returns
+	*HandlersValid = false;
+
+	// Wakes the accept loop's poll() and the connections' blocking recv() calls
+	const uint8 WakeByte = 0;
+	if (write(WakePipe[1], &WakeByte, 1) != 1)
+		UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Failed to wake the local socket accept loop (errno %d)"), errno);
+	{
+		FScopeLock ScopeLock(&ConnectionsLock);
+		for (const int32 Socket : OpenSockets)
+			shutdown(Socket, SHUT_RDWR);
+	}
+
+	AcceptThread.Wait();
+	for (TFuture<void>& ConnectionThread : ConnectionThreads)
+		ConnectionThread.Wait();
+	ConnectionThreads.Empty();
+
+	close(ListenSocket);
+	ListenSocket = -1;
+	close(WakePipe[0]);
+	close(WakePipe[1]);
+	WakePipe[0] = WakePipe[1] = -1;
+
+	unlink(TCHAR_TO_UTF8(*SocketPath));
+}
+
+void FBlueprintExporterLocalTransport::AcceptConnections()
+{
+	while (!bStopping)
+	{
+		pollfd PollFds[2] = {};
+		PollFds[0].fd = ListenSocket;
+		PollFds[0].events = POLLIN;
+		PollFds[1].fd = WakePipe[0];
+		PollFds[1].events = POLLIN;
+
+		if (poll(PollFds, 2, -1) < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		if (bStopping || PollFds[1].revents != 0)
+			break;
+
+		const int32 Socket = accept(ListenSocket, nullptr, nullptr);
+		if (Socket < 0)
+		{
+			if (errno == EINTR || errno == ECONNABORTED || errno == EAGAIN || errno == EWOULDBLOCK)
+				continue;
+			break;
+		}
+
+		// BSD sockets inherit O_NONBLOCK from the listen socket; connections use blocking reads
+		fcntl(Socket, F_SETFL, fcntl(Socket, F_GETFL) & ~O_NONBLOCK);
+
+#ifdef SO_NOSIGPIPE
+		const int NoSigPipe = 1;
+		setsockopt(Socket, SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+#endif
+
+		FScopeLock ScopeLock(&ConnectionsLock);
+
+		ConnectionThreads.RemoveAll([](const TFuture<void>& ConnectionThread) { return ConnectionThread.IsReady(); });
+		if (bStopping || ConnectionThreads.Num() >= MAX_LOCAL_CONNECTIONS)
+		{
+			close(Socket);
+			continue;
+		}
+
+		OpenSockets.Add(Socket);
+		ConnectionThreads.Add(Async(EAsyncExecution::Thread, [this, Socket]() { ServeConnection(Socket); }));
+	}
+}
+
+void FBlueprintExporterLocalTransport::ServeConnection(int32 Socket)
+{
+	// The previous response's shared payload; released once the client moves on
+	FSharedMemoryRegion* SharedPayload = nullptr;
+
+	TArray<uint8> Frame;
+	while (!bStopping && ReadFrame(Socket, Frame))
+	{
+		if (SharedPayload)
+		{
+			FPlatformMemory::UnmapNamedSharedMemoryRegion(SharedPayload);
+			SharedPayload = nullptr;
+		}
+
+		const FString Line(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Frame.GetData()), Frame.Num()));
+
+		FString Path;
+		const FHttpServerRequest Request = MakeLocalRequest(Line, Path);
+		const FString* PayloadParam = Request.QueryParams.Find(TEXT("payload"));
+		const bool bWantsPayload = PayloadParam && PayloadParam->ToBool();
+
+		TSharedRef<FLocalPendingResponse, ESPMode::ThreadSafe> Pending = MakeShared<FLocalPendingResponse, ESPMode::ThreadSafe>();
+
+		const FHttpRequestHandler* Handler = Routes.Find(Path);
+		if (!Handler)
+		{
+			Pending->Response = MakeLocalError(FString::Printf(TEXT("Unknown route: %s"), *Path), EHttpServerResponseCodes::NotFound);
+			Pending->Done->Trigger();
+		}
+		else
+		{
+			auto CallHandler = [Handler = *Handler, Request, Pending, HandlersValid = HandlersValid]()
+			{
+				const FHttpResultCallback OnComplete = [Pending](TUniquePtr<FHttpServerResponse> Response)
+				{
+					FScopeLock ScopeLock(&Pending->Lock);
+					Pending->Response = MoveTemp(Response);
+					Pending->Done->Trigger();
+				};
+
+				if (!*HandlersValid)
+				{
+					OnComplete(MakeLocalError(TEXT("Server is shutting down"), EHttpServerResponseCodes::ServiceUnavail));
+					return;
+				}
+
+				if (!Handler(Request, OnComplete))
+					OnComplete(MakeLocalError(TEXT("Request was not handled"), EHttpServerResponseCodes::NotFound));
+			};
+
+			// Snapshot and index queries are answered here, so a busy game thread can't delay them;
+			// everything else is called where the HTTP listener calls it
+			if (AnyThreadRoutes.Contains(Path))
+				CallHandler();
+			else
+				AsyncTask(ENamedThreads::GameThread, MoveTemp(CallHandler));
+		}
+
+		while (!Pending->Done->Wait(LOCAL_RESPONSE_POLL_MS))
+		{
+			if (bStopping)
+				break;
+		}
+		if (bStopping)
+			break;
+
+		TUniquePtr<FHttpServerResponse> Response;
+		{
+			FScopeLock ScopeLock(&Pending->Lock);
+			Response = MoveTemp(Pending->Response);
+		}
+
+		// A handler that serialized in memory put the payload after its status JSON
+		int64 StatusSize = Response->Body.Num();
+		if (const TArray<FString>* PayloadOffset = Response->Headers.Find(LOCAL_PAYLOAD_OFFSET_HEADER))
+		{
+			if (PayloadOffset->Num() > 0)
+				StatusSize = FMath::Clamp<int64>(FCString::Atoi64(*(*PayloadOffset)[0]), 0, Response->Body.Num());
+		}
+
+		TArray<uint8> Header;
+		Header.Add(LOCAL_FRAME_RESPONSE);
+		AppendLittleEndian(Header, static_cast<uint16>(Response->Code), 2);
+		if (!WriteFrame(Socket, Header, Response->Body.GetData(), StatusSize))
+			break;
+
+		if (!bWantsPayload || static_cast<int32>(Response->Code) >= 300)
+			continue;
+
+		const uint8* PayloadData = Response->Body.GetData() + StatusSize;
+		int64 PayloadSize = Response->Body.Num() - StatusSize;
+
+		// Other handlers report a written file through output_path; it's sent as is and left in place,
+		// since the transport didn't create it (cached exports are served again by later requests)
+		TArray<uint8> FilePayload;
+		if (StatusSize == Response->Body.Num())
+		{
+			const FString Body(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Response->Body.GetData()), Response->Body.Num()));
+			TSharedPtr<FJsonObject> BodyObj;
+			FString OutputPath;
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Body), BodyObj) || !BodyObj.IsValid() ||
+			    !BodyObj->TryGetStringField(TEXT("output_path"), OutputPath))
+				continue;
+
+			if (!FFileHelper::LoadFileToArray(FilePayload, *OutputPath))
+				continue;
+
+			PayloadData = FilePayload.GetData();
+			PayloadSize = FilePayload.Num();
+		}
+
+		Header.Reset();
+		if (PayloadSize < LOCAL_INLINE_PAYLOAD_LIMIT)
+		{
+			Header.Add(LOCAL_FRAME_PAYLOAD);
+			if (!WriteFrame(Socket, Header, PayloadData, PayloadSize))
+				break;
+			continue;
+		}
+
+		static std::atomic<uint32> RegionCounter{0};
+		const FString RegionName = FString::Printf(TEXT("/BlueprintExporter-%u-%u"), FPlatformProcess::GetCurrentProcessId(), ++RegionCounter);
+
+		SharedPayload = FPlatformMemory::MapNamedSharedMemoryRegion(*RegionName, true,
+			FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write, PayloadSize);
+		if (!SharedPayload)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Failed to map shared memory for %s, sending inline"), *Line);
+			Header.Add(LOCAL_FRAME_PAYLOAD);
+			if (!WriteFrame(Socket, Header, PayloadData, PayloadSize))
+				break;
+			continue;
+		}
+		FMemory::Memcpy(SharedPayload->GetAddress(), PayloadData, PayloadSize);
+
+		FTCHARToUTF8 RegionNameUtf8(*RegionName);
+		Header.Add(LOCAL_FRAME_SHARED_PAYLOAD);
+		AppendLittleEndian(Header, PayloadSize, 8);
+		if (!WriteFrame(Socket, Header, reinterpret_cast<const uint8*>(RegionNameUtf8.Get()), RegionNameUtf8.Length()))
+			break;
+	}
+
+	if (SharedPayload)
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(SharedPayload);
+
+	{
+		FScopeLock ScopeLock(&ConnectionsLock);
+		OpenSockets.Remove(Socket);
+	}
+	close(Socket);
+}
+
+#else
+
+bool FBlueprintExporterLocalTransport::IsSupported()
+{
+	return false;
+}
+
+bool FBlueprintExporterLocalTransport::Start(const FString& InSocketPath, const TMap<FString, FHttpRequestHandler>& InRoutes, const TSet<FString>& InAnyThreadRoutes)
+{
+	return false;
+}
+
+void FBlueprintExporterLocalTransport::Stop()
+{
+}
+
+void FBlueprintExporterLocalTransport::AcceptConnections()
+{
+}
+
+void FBlueprintExporterLocalTransport::ServeConnection(int32 Socket)
+{
+}
+
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpRouteHandle.h"
+#include "IHttpRouter.h"
+#include "Async/Future.h"
+#include <atomic>
+
+struct FHttpServerRequest;
+struct FHttpServerResponse;
+
+/**
+ * Local alternative to the HTTP listener: a Unix domain socket carrying the same requests with
+ * length-prefixed framing, for tools that send many small requests or run next to several editors.
+ * POSIX only; on other platforms Start() returns false and only HTTP is available.
+ *
+ * Every frame is a little-endian uint32 byte count followed by that many bytes.
+ *
+ *   Request:   UTF-8 path and query, exactly as in the HTTP URL, e.g. "/export?path=/Game/BP_Foo"
+ *   Response:  uint8 kind, then
+ *                LOCAL_FRAME_RESPONSE        uint16 status code, JSON body
+ *                LOCAL_FRAME_PAYLOAD         file contents
+ *                LOCAL_FRAME_SHARED_PAYLOAD  uint64 size, UTF-8 shared memory region name
+ *
+ * A request with payload=1 is followed by a second frame carrying the export. Handlers that can
+ * serialize in memory attach it to their response (MakePayloadResponse) and write no file; for
+ * anything else the file named by output_path is read and sent, and left where it is. Payloads of
+ * LOCAL_INLINE_PAYLOAD_LIMIT bytes or more are placed in a named shared memory region instead,
+ * which stays mapped until the client sends its next request or disconnects.
+ *
+ * Requests are handled one at a time per connection and dispatched to the HTTP route handlers on
+ * the game thread, the same as the HTTP listener does. Routes registered as any-thread (snapshot
+ * and index queries) are called directly on the connection thread instead.
+ */
+class FBlueprintExporterLocalTransport
+{
+public:
+	static bool IsSupported();
+
+	/** True for a payload=1 request that arrived over the socket, so the handler may skip writing a file */
+	static bool WantsInlinePayload(const FHttpServerRequest& Request);
+
+	/** A response carrying StatusJson for the client and Payload for the payload frame that follows it */
+	static TUniquePtr<FHttpServerResponse> MakePayloadResponse(const FString& StatusJson, TArray<uint8>&& Payload);
+
+	/** Routes are copied; handlers must stay valid until Stop(). AnyThreadRoutes need no game thread. */
+	bool Start(const FString& InSocketPath, const TMap<FString, FHttpRequestHandler>& InRoutes, const TSet<FString>& InAnyThreadRoutes);
+	void Stop();
+
+	bool IsRunning() const { return ListenSocket >= 0; }
+	const FString& GetSocketPath() const { return SocketPath; }
+
+private:
+	void AcceptConnections();
+	void ServeConnection(int32 Socket);
+
+	FString SocketPath;
+	TMap<FString, FHttpRequestHandler> Routes;
+	TSet<FString> AnyThreadRoutes;
+
+	int32 ListenSocket = -1;
+	std::atomic<bool> bStopping{false};
+
+	// Self-pipe the accept loop polls next to the listen socket; Stop() writes to it, since
+	// shutdown() on a listening socket doesn't wake accept() everywhere (macOS returns ENOTCONN)
+	int32 WakePipe[2] = { -1, -1 };
+
+	// Cleared by Stop(); game thread tasks queued for a connection check it before calling a handler,
+	// since the handlers' owner may be gone by the time they run
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> HandlersValid;
+
+	TFuture<void> AcceptThread;
+
+	FCriticalSection ConnectionsLock;
+	TSet<int32> OpenSockets;
+	TArray<TFuture<void>> ConnectionThreads;
+};
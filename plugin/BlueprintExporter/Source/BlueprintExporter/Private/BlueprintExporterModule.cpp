@@ -7,17 +7,43 @@
 #include "HttpResultCallback.h"
 #include "HttpRouteHandle.h"
 #include "BlueprintExporterBPLibrary.h"
+#include "BlueprintExporterIndex.h"
+#include "BlueprintExporterRegistry.h"
+#include "BlueprintExporterLocalTransport.h"
+#include "BlueprintExporterAnalyzer.h"
+#include "BlueprintExporterPlanner.h"
+#include "BlueprintExporterPrefetcher.h"
+#include "BlueprintExporterTrace.h"
+#include "BlueprintExporterUtils.h"
 #include "Async/Async.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Compression.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/PackageName.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/Blueprint.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
 
+UE_TRACE_CHANNEL_DEFINE(BlueprintExporterChannel);
+
+TRACE_DECLARE_INT_COUNTER(BlueprintExporter_NodesExported, TEXT("BlueprintExporter/Nodes Exported"));
+TRACE_DECLARE_INT_COUNTER(BlueprintExporter_PinsExported, TEXT("BlueprintExporter/Pins Exported"));
+TRACE_DECLARE_INT_COUNTER(BlueprintExporter_BytesWritten, TEXT("BlueprintExporter/Bytes Written"));
+
+// Default HTTP port; -BlueprintExporterPort= overrides it when several editors share a machine
 static const uint32 BLUEPRINT_EXPORTER_PORT = 7233;
 
+// Responses smaller than this aren't worth compressing
+static const int32 MIN_COMPRESSED_RESPONSE_SIZE = 4096;
+
 class FBlueprintExporterModule : public IModuleInterface
 {
 	FHttpRouteHandle ExportRouteHandle;
@@ -25,61 +51,184 @@ class FBlueprintExporterModule : public IModuleInterface
 	FHttpRouteHandle ListRouteHandle;
 	FHttpRouteHandle ExportStructRouteHandle;
 	FHttpRouteHandle ExportEnumRouteHandle;
+	FHttpRouteHandle ExportTypesRouteHandle;
+	FHttpRouteHandle ExportMacrosRouteHandle;
+	FHttpRouteHandle QueryRouteHandle;
+	FHttpRouteHandle AnalyzeRouteHandle;
+	FHttpRouteHandle DependenciesRouteHandle;
+	FHttpRouteHandle ExportBytecodeRouteHandle;
+	FHttpRouteHandle PlanRouteHandle;
+	FHttpRouteHandle ExportDataTableRouteHandle;
+	FHttpRouteHandle MetadataRouteHandle;
+	FHttpRouteHandle ExportPropertyRouteHandle;
+
+	FBlueprintExporterIndex GraphIndex;
+	FBlueprintExporterRegistry Registry;
+	FBlueprintExporterPrefetcher Prefetcher;
+
+	uint32 HttpPort = BLUEPRINT_EXPORTER_PORT;
+
+	// Every bound route by path, so the local socket transport can dispatch to the same handlers
+	TMap<FString, FHttpRequestHandler> Routes;
+
+	// Routes that only read the registry snapshot or the graph index; the socket transport calls them
+	// on its own connection threads so a stalled game thread doesn't hold them up
+	TSet<FString> AnyThreadRoutes;
+	FBlueprintExporterLocalTransport LocalTransport;
+
+	// The macro library is exported once per session and kept until a macro library is saved
+	bool bMacroLibraryCurrent = false;
+	int32 MacroLibraryCount = 0;
+	FDelegateHandle PackageSavedHandle;
 
 public:
 	virtual void StartupModule() override
 	{
+		// -run=BlueprintExporter and other commandlets must not take the port, the socket or the tickers
+		// from an editor running alongside
+		if (IsRunningCommandlet())
+			return;
+
+		FParse::Value(FCommandLine::Get(), TEXT("BlueprintExporterPort="), HttpPort);
+
 		FHttpServerModule& HttpServerModule = FHttpServerModule::Get();
-		TSharedPtr<IHttpRouter> Router = HttpServerModule.GetHttpRouter(BLUEPRINT_EXPORTER_PORT);
+		TSharedPtr<IHttpRouter> Router = HttpServerModule.GetHttpRouter(HttpPort);
 
 		if (!Router)
 		{
-			UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to get HTTP router on port %d"), BLUEPRINT_EXPORTER_PORT);
+			UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to get HTTP router on port %d"), HttpPort);
 			return;
 		}
 
-		PingRouteHandle = Router->BindRoute(
-			FHttpPath(TEXT("/ping")),
-			EHttpServerRequestVerbs::VERB_GET,
+		PingRouteHandle = BindExporterRoute(Router,
+			TEXT("/ping"),
 			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandlePing(Request, OnComplete); })
 		);
 
-		ExportRouteHandle = Router->BindRoute(
-			FHttpPath(TEXT("/export")),
-			EHttpServerRequestVerbs::VERB_GET,
+		ExportRouteHandle = BindExporterRoute(Router,
+			TEXT("/export"),
 			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExport(Request, OnComplete); })
 		);
 
-		ListRouteHandle = Router->BindRoute(
-			FHttpPath(TEXT("/list")),
-			EHttpServerRequestVerbs::VERB_GET,
-			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleList(Request, OnComplete); })
+		ListRouteHandle = BindExporterRoute(Router,
+			TEXT("/list"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleList(Request, OnComplete); }),
+			EExporterRouteThread::Any
 		);
 
-		ExportStructRouteHandle = Router->BindRoute(
-			FHttpPath(TEXT("/export-struct")),
-			EHttpServerRequestVerbs::VERB_GET,
+		ExportStructRouteHandle = BindExporterRoute(Router,
+			TEXT("/export-struct"),
 			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExportStruct(Request, OnComplete); })
 		);
 
-		ExportEnumRouteHandle = Router->BindRoute(
-			FHttpPath(TEXT("/export-enum")),
-			EHttpServerRequestVerbs::VERB_GET,
+		ExportEnumRouteHandle = BindExporterRoute(Router,
+			TEXT("/export-enum"),
 			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExportEnum(Request, OnComplete); })
 		);
 
+		ExportTypesRouteHandle = BindExporterRoute(Router,
+			TEXT("/export-types"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExportTypes(Request, OnComplete); })
+		);
+
+		ExportMacrosRouteHandle = BindExporterRoute(Router,
+			TEXT("/export-macros"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExportMacros(Request, OnComplete); })
+		);
+
+		QueryRouteHandle = BindExporterRoute(Router,
+			TEXT("/query"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleQuery(Request, OnComplete); }),
+			EExporterRouteThread::Any
+		);
+
+		AnalyzeRouteHandle = BindExporterRoute(Router,
+			TEXT("/analyze"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleAnalyze(Request, OnComplete); })
+		);
+
+		DependenciesRouteHandle = BindExporterRoute(Router,
+			TEXT("/dependencies"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleDependencies(Request, OnComplete); }),
+			EExporterRouteThread::Any
+		);
+
+		ExportBytecodeRouteHandle = BindExporterRoute(Router,
+			TEXT("/export-bytecode"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExportBytecode(Request, OnComplete); })
+		);
+
+		PlanRouteHandle = BindExporterRoute(Router,
+			TEXT("/plan"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandlePlan(Request, OnComplete); })
+		);
+
+		ExportDataTableRouteHandle = BindExporterRoute(Router,
+			TEXT("/export-datatable"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExportDataTable(Request, OnComplete); })
+		);
+
+		MetadataRouteHandle = BindExporterRoute(Router,
+			TEXT("/metadata"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleMetadata(Request, OnComplete); }),
+			EExporterRouteThread::Any
+		);
+
+		ExportPropertyRouteHandle = BindExporterRoute(Router,
+			TEXT("/export-property"),
+			FHttpRequestHandler([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) { return HandleExportProperty(Request, OnComplete); })
+		);
+
 		HttpServerModule.StartAllListeners();
 
-		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: HTTP server started on port %d"), BLUEPRINT_EXPORTER_PORT);
+		if (FBlueprintExporterLocalTransport::IsSupported())
+		{
+			// Per-process default so editors running side by side never collide
+			FString SocketPath = FPaths::Combine(FPlatformProcess::UserTempDir(), FString::Printf(TEXT("BlueprintExporter-%u.sock"), FPlatformProcess::GetCurrentProcessId()));
+			FParse::Value(FCommandLine::Get(), TEXT("BlueprintExporterSocket="), SocketPath);
+
+			LocalTransport.Start(SocketPath, Routes, AnyThreadRoutes);
+		}
+
+		GraphIndex.Start();
+		Registry.Start();
+
+		if (FParse::Param(FCommandLine::Get(), TEXT("BlueprintExporterPrefetch")))
+			Prefetcher.Start(Registry);
+
+		PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FBlueprintExporterModule::OnPackageSaved);
+
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: HTTP server started on port %d"), HttpPort);
 		UE_LOG(LogTemp, Log, TEXT("  GET /ping              - Check if server is running"));
-		UE_LOG(LogTemp, Log, TEXT("  GET /export?path=...   - Export blueprint to JSON"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /export?path=...   - Export blueprint to JSON (level=signature, prune=1, manifest=1, graph=<name>, adjacency=1, typed=1, cse=1, functions=1, canonical=1, max_elements=N)"));
 		UE_LOG(LogTemp, Log, TEXT("  GET /list?filter=...   - List available blueprints"));
 		UE_LOG(LogTemp, Log, TEXT("  GET /export-struct?path=...   - Export UserDefinedStruct to JSON"));
 		UE_LOG(LogTemp, Log, TEXT("  GET /export-enum?path=...    - Export UserDefinedEnum to JSON"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /export-types           - Export all structs and enums to one catalogue"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /export-macros          - Export standard and project macro libraries"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /query?node_type=...&function=...   - Find graph nodes across all blueprints"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /analyze?filter=...  - Rank blueprints by estimated runtime cost"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /dependencies?path=...  - Blueprint parent class, dependencies and referencers"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /export-bytecode?path=...  - Disassemble compiled blueprint bytecode to JSON"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /plan?filter=...  - Dependency-ordered conversion waves (deep=1 loads blueprints)"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /export-datatable?path=...  - Stream DataTable/DataAsset rows (format=ndjson|csv, offset=, limit=)"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /metadata?filter=...  - Parent classes, type and interfaces from registry tags, no loads (offset=, limit=)"));
+		UE_LOG(LogTemp, Log, TEXT("  GET /export-property?path=...&name=...  - Page through a long array/set/map default (offset=, limit=, typed=1)"));
 	}
 
 	virtual void ShutdownModule() override
 	{
+		if (IsRunningCommandlet())
+			return;
+
+		LocalTransport.Stop();
+
+		Prefetcher.Stop();
+		GraphIndex.Stop();
+		Registry.Stop();
+
+		UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
 		FHttpServerModule* HttpServerModule = FModuleManager::Get().GetModulePtr<FHttpServerModule>("HTTPServer");
 		if (HttpServerModule)
 		{
@@ -88,8 +237,25 @@ public:
 	}
 
 private:
+	/** Where a route's handler may run. The HTTP listener always calls handlers on the game thread. */
+	enum class EExporterRouteThread : uint8
+	{
+		GameThread,
+		Any
+	};
+
+	FHttpRouteHandle BindExporterRoute(const TSharedPtr<IHttpRouter>& Router, const TCHAR* Path, const FHttpRequestHandler& Handler, EExporterRouteThread Thread = EExporterRouteThread::GameThread)
+	{
+		Routes.Add(Path, Handler);
+		if (Thread == EExporterRouteThread::Any)
+			AnyThreadRoutes.Add(Path);
+		return Router->BindRoute(FHttpPath(Path), EHttpServerRequestVerbs::VERB_GET, Handler);
+	}
+
 	TUniquePtr<FHttpServerResponse> MakeJsonResponse(const TSharedPtr<FJsonObject>& JsonObj)
 	{
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::SerializeResponse);
+
 		FString ResponseStr;
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseStr);
 		FJsonSerializer::Serialize(JsonObj.ToSharedRef(), Writer);
@@ -97,12 +263,287 @@ private:
 		return FHttpServerResponse::Create(ResponseStr, TEXT("application/json"));
 	}
 
+	static bool GzipBuffer(const void* Data, int32 Size, TArray<uint8>& OutCompressed)
+	{
+		BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::Gzip);
+
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Size);
+		OutCompressed.SetNumUninitialized(CompressedSize);
+
+		if (!FCompression::CompressMemory(NAME_Gzip, OutCompressed.GetData(), CompressedSize, Data, Size))
+			return false;
+
+		OutCompressed.SetNum(CompressedSize);
+		return true;
+	}
+
+	/** Honours q-values: "gzip;q=0" refuses gzip, and "*" only applies when gzip isn't listed itself */
+	static bool AcceptsGzip(const FHttpServerRequest& Request)
+	{
+		float GzipQuality = -1.0f;
+		float WildcardQuality = -1.0f;
+
+		for (const TPair<FString, TArray<FString>>& Header : Request.Headers)
+		{
+			if (!Header.Key.Equals(TEXT("Accept-Encoding"), ESearchCase::IgnoreCase))
+				continue;
+
+			for (const FString& Value : Header.Value)
+			{
+				TArray<FString> Codings;
+				Value.ParseIntoArray(Codings, TEXT(","));
+				for (const FString& Coding : Codings)
+				{
+					TArray<FString> Parts;
+					Coding.ParseIntoArray(Parts, TEXT(";"));
+					if (Parts.Num() == 0)
+						continue;
+
+					float Quality = 1.0f;
+					for (int32 i = 1; i < Parts.Num(); i++)
+					{
+						const FString Param = Parts[i].TrimStartAndEnd();
+						if (Param.StartsWith(TEXT("q="), ESearchCase::IgnoreCase))
+							Quality = FCString::Atof(*Param + 2);
+					}
+
+					const FString Name = Parts[0].TrimStartAndEnd();
+					if (Name.Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("x-gzip"), ESearchCase::IgnoreCase))
+						GzipQuality = Quality;
+					else if (Name == TEXT("*"))
+						WildcardQuality = Quality;
+				}
+			}
+		}
+
+		return GzipQuality >= 0.0f ? GzipQuality > 0.0f : WildcardQuality > 0.0f;
+	}
+
+	static bool WantsCompressedFile(const FHttpServerRequest& Request)
+	{
+		const FString* CompressParam = Request.QueryParams.Find(TEXT("compress"));
+		return CompressParam && (CompressParam->Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || CompressParam->ToBool());
+	}
+
+	/**
+	 * Responds with JsonObj, gzip-encoded when the client accepts it and the body is large enough.
+	 * Compression runs on a worker thread; the response is completed back on the game thread.
+	 */
+	void SendJsonResponse(const TSharedPtr<FJsonObject>& JsonObj, const FHttpResultCallback& OnComplete, bool bAcceptsGzip)
+	{
+		FString ResponseStr;
+		{
+			BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::SerializeResponse);
+			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseStr);
+			FJsonSerializer::Serialize(JsonObj.ToSharedRef(), Writer);
+		}
+
+		if (!bAcceptsGzip || ResponseStr.Len() < MIN_COMPRESSED_RESPONSE_SIZE)
+		{
+			OnComplete(FHttpServerResponse::Create(ResponseStr, TEXT("application/json")));
+			return;
+		}
+
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ResponseStr = MoveTemp(ResponseStr), OnComplete]()
+		{
+			FTCHARToUTF8 Utf8(*ResponseStr);
+			TArray<uint8> Compressed;
+			const bool bCompressed = GzipBuffer(Utf8.Get(), Utf8.Length(), Compressed);
+
+			AsyncTask(ENamedThreads::GameThread, [ResponseStr, Compressed = MoveTemp(Compressed), bCompressed, OnComplete]() mutable
+			{
+				if (!bCompressed)
+				{
+					OnComplete(FHttpServerResponse::Create(ResponseStr, TEXT("application/json")));
+					return;
+				}
+
+				TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Compressed), TEXT("application/json"));
+				Response->Headers.Add(TEXT("Content-Encoding"), { TEXT("gzip") });
+				OnComplete(MoveTemp(Response));
+			});
+		});
+	}
+
+	/**
+	 * Runs Export with its JSON captured in memory instead of written to OutputPath. With bCompress
+	 * it is gzipped to OutputPath.gz on a worker thread and the request completed on the game thread
+	 * with the compressed file's path; otherwise (a local payload=1 request) the JSON is attached to
+	 * the response for the socket transport and no file is written at all.
+	 */
+	void SendCapturedExport(TFunctionRef<bool()> Export, const FString& OutputPath, bool bCompress, const FString& FailureMessage, const FHttpResultCallback& OnComplete)
+	{
+		FScopedJsonExportCapture Capture;
+		if (!Export() || !Capture.bCaptured)
+		{
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), false);
+			ResponseObj->SetStringField(TEXT("error"), FailureMessage);
+			OnComplete(MakeJsonResponse(ResponseObj));
+			return;
+		}
+
+		if (!bCompress)
+		{
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), true);
+			ResponseObj->SetNumberField(TEXT("file_size"), Capture.Json.Num());
+			ResponseObj->SetBoolField(TEXT("payload"), true);
+
+			FString StatusJson;
+			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&StatusJson);
+			FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+			OnComplete(FBlueprintExporterLocalTransport::MakePayloadResponse(StatusJson, MoveTemp(Capture.Json)));
+			return;
+		}
+
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Json = MoveTemp(Capture.Json), OutputPath, OnComplete]()
+		{
+			const FString CompressedPath = OutputPath + TEXT(".gz");
+
+			TArray<uint8> Compressed;
+			const bool bSuccess = GzipBuffer(Json.GetData(), Json.Num(), Compressed)
+				&& FFileHelper::SaveArrayToFile(Compressed, *CompressedPath);
+
+			const int64 UncompressedSize = Json.Num();
+			const int64 CompressedSize = Compressed.Num();
+
+			AsyncTask(ENamedThreads::GameThread, [this, OutputPath, CompressedPath, bSuccess, UncompressedSize, CompressedSize, OnComplete]()
+			{
+				TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+				ResponseObj->SetBoolField(TEXT("success"), bSuccess);
+
+				if (bSuccess)
+				{
+					ResponseObj->SetStringField(TEXT("output_path"), CompressedPath);
+					ResponseObj->SetNumberField(TEXT("file_size"), static_cast<double>(CompressedSize));
+					ResponseObj->SetNumberField(TEXT("uncompressed_size"), static_cast<double>(UncompressedSize));
+					ResponseObj->SetStringField(TEXT("content_encoding"), TEXT("gzip"));
+				}
+				else
+				{
+					ResponseObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to compress export: %s"), *OutputPath));
+				}
+
+				OnComplete(MakeJsonResponse(ResponseObj));
+			});
+		});
+	}
+
+	/** The prefetcher only writes exports with default options */
+	static bool IsDefaultExportOptions(const FBlueprintExportOptions& Options)
+	{
+		const FBlueprintExportOptions Defaults;
+		return FBlueprintExportOptions::StaticStruct()->CompareScriptStruct(&Options, &Defaults, PPF_None);
+	}
+
+	/**
+	 * Answers from the prefetcher's output cache when it holds a current export of AssetPath.
+	 * Compressed requests always miss: compressing replaces the file the cache points at.
+	 */
+	bool TrySendCachedExport(EBlueprintPrefetchKind Kind, const FString& AssetPath, bool bCompress, const FHttpResultCallback& OnComplete)
+	{
+		Prefetcher.NoteRequest(Kind, AssetPath);
+
+		FString CachedPath;
+		if (bCompress || !Prefetcher.FindCachedExport(Kind, AssetPath, CachedPath))
+			return false;
+
+		TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+		ResponseObj->SetBoolField(TEXT("success"), true);
+		ResponseObj->SetStringField(TEXT("output_path"), CachedPath);
+		ResponseObj->SetNumberField(TEXT("file_size"), static_cast<double>(IFileManager::Get().FileSize(*CachedPath)));
+		ResponseObj->SetBoolField(TEXT("cached"), true);
+
+		OnComplete(MakeJsonResponse(ResponseObj));
+		return true;
+	}
+
+	static FBlueprintExportOptions ParseExportOptions(const FHttpServerRequest& Request)
+	{
+		FBlueprintExportOptions Options;
+
+		const FString* LevelParam = Request.QueryParams.Find(TEXT("level"));
+		if (LevelParam && LevelParam->Equals(TEXT("signature"), ESearchCase::IgnoreCase))
+		{
+			Options.Level = EBlueprintExportLevel::Signature;
+		}
+
+		const FString* PruneParam = Request.QueryParams.Find(TEXT("prune"));
+		if (PruneParam)
+		{
+			Options.bPrune = PruneParam->ToBool();
+		}
+
+		const FString* ManifestParam = Request.QueryParams.Find(TEXT("manifest"));
+		if (ManifestParam)
+		{
+			Options.bManifest = ManifestParam->ToBool();
+		}
+
+		const FString* GraphParam = Request.QueryParams.Find(TEXT("graph"));
+		if (GraphParam)
+		{
+			Options.GraphName = *GraphParam;
+		}
+
+		const FString* AdjacencyParam = Request.QueryParams.Find(TEXT("adjacency"));
+		if (AdjacencyParam)
+		{
+			Options.bAdjacency = AdjacencyParam->ToBool();
+		}
+
+		const FString* TypedParam = Request.QueryParams.Find(TEXT("typed"));
+		if (TypedParam)
+		{
+			Options.bTypedValues = TypedParam->ToBool();
+		}
+
+		const FString* CseParam = Request.QueryParams.Find(TEXT("cse"));
+		if (CseParam)
+		{
+			Options.bCommonSubexpressions = CseParam->ToBool();
+		}
+
+		const FString* FunctionsParam = Request.QueryParams.Find(TEXT("functions"));
+		if (FunctionsParam)
+		{
+			Options.bFunctionTable = FunctionsParam->ToBool();
+		}
+
+		const FString* CanonicalParam = Request.QueryParams.Find(TEXT("canonical"));
+		if (CanonicalParam)
+		{
+			Options.bCanonical = CanonicalParam->ToBool();
+		}
+
+		const FString* MaxElementsParam = Request.QueryParams.Find(TEXT("max_elements"));
+		if (MaxElementsParam)
+		{
+			Options.MaxContainerElements = FMath::Max(0, FCString::Atoi(**MaxElementsParam));
+		}
+
+		return Options;
+	}
+
 	bool HandlePing(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 	{
 		TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
 		ResponseObj->SetStringField(TEXT("status"), TEXT("ok"));
 		ResponseObj->SetStringField(TEXT("plugin"), TEXT("BlueprintExporter"));
-		ResponseObj->SetNumberField(TEXT("port"), BLUEPRINT_EXPORTER_PORT);
+		ResponseObj->SetNumberField(TEXT("port"), HttpPort);
+		if (LocalTransport.IsRunning())
+			ResponseObj->SetStringField(TEXT("socket"), LocalTransport.GetSocketPath());
+
+		if (Prefetcher.IsRunning())
+		{
+			TSharedPtr<FJsonObject> PrefetchObj = MakeShareable(new FJsonObject());
+			PrefetchObj->SetNumberField(TEXT("cached"), Prefetcher.GetNumCached());
+			PrefetchObj->SetNumberField(TEXT("pending"), Prefetcher.GetNumPending());
+			PrefetchObj->SetNumberField(TEXT("hits"), Prefetcher.GetNumHits());
+			ResponseObj->SetObjectField(TEXT("prefetch"), PrefetchObj);
+		}
 
 		OnComplete(MakeJsonResponse(ResponseObj));
 		return true;
@@ -133,17 +574,46 @@ private:
 			BlueprintPath = TEXT("/Game/") + BlueprintPath;
 		}
 
+		const FBlueprintExportOptions Options = ParseExportOptions(Request);
+
+		const bool bCompress = WantsCompressedFile(Request);
+		const bool bInlinePayload = FBlueprintExporterLocalTransport::WantsInlinePayload(Request);
+
 		// Dispatch to game thread since ExportBlueprintToJson accesses UObjects
-		AsyncTask(ENamedThreads::GameThread, [this, BlueprintPath, OnComplete]()
+		AsyncTask(ENamedThreads::GameThread, [this, BlueprintPath, Options, bCompress, bInlinePayload, OnComplete]()
 		{
+			if (IsDefaultExportOptions(Options))
+			{
+				if (TrySendCachedExport(EBlueprintPrefetchKind::Blueprint, BlueprintPath, bCompress, OnComplete))
+					return;
+			}
+			else
+			{
+				Prefetcher.NoteRequest(EBlueprintPrefetchKind::Blueprint, BlueprintPath);
+			}
+
 			// Use blueprint name as filename so exports don't overwrite each other
 			FString BPName = FPaths::GetBaseFilename(BlueprintPath);
+			if (Options.bManifest)
+				BPName += TEXT("_manifest");
+			else if (Options.Level == EBlueprintExportLevel::Signature)
+				BPName += TEXT("_signature");
+			else if (!Options.GraphName.IsEmpty())
+				BPName += TEXT("_") + Options.GraphName;
+
 			FString OutputPath = FPaths::Combine(
 				FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
 				BPName + TEXT(".json")
 			);
 
-			bool bSuccess = UBlueprintExporterBPLibrary::ExportBlueprintToJson(BlueprintPath, OutputPath);
+			if (bCompress || bInlinePayload)
+			{
+				SendCapturedExport([&]() { return UBlueprintExporterBPLibrary::ExportBlueprintToJsonWithOptions(BlueprintPath, Options, OutputPath); }, OutputPath, bCompress,
+					FString::Printf(TEXT("Failed to export blueprint: %s"), *BlueprintPath), OnComplete);
+				return;
+			}
+
+			bool bSuccess = UBlueprintExporterBPLibrary::ExportBlueprintToJsonWithOptions(BlueprintPath, Options, OutputPath);
 
 			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
 			ResponseObj->SetBoolField(TEXT("success"), bSuccess);
@@ -176,31 +646,28 @@ private:
 			Filter = *FilterParam;
 		}
 
-		AsyncTask(ENamedThreads::GameThread, [this, Filter, OnComplete]()
-		{
-			FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-			IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-			TArray<FAssetData> AssetList;
-			AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetList);
+		// Answered from the registry snapshot without loading anything. Over HTTP this still runs when the
+		// game thread ticks the listener; over the local socket it runs on the connection thread.
+		const double StartTime = FPlatformTime::Seconds();
+		const TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> Snapshot = Registry.GetSnapshot();
 
-			TArray<TSharedPtr<FJsonValue>> BlueprintPaths;
-			for (const FAssetData& Asset : AssetList)
+		TArray<TSharedPtr<FJsonValue>> BlueprintPaths;
+		for (const FBlueprintRegistryEntry& Entry : Snapshot->Blueprints)
+		{
+			FString PackageName = Entry.PackageName.ToString();
+			if (Filter.IsEmpty() || PackageName.Contains(Filter))
 			{
-				FString PackageName = Asset.PackageName.ToString();
-				if (Filter.IsEmpty() || PackageName.Contains(Filter))
-				{
-					BlueprintPaths.Add(MakeShareable(new FJsonValueString(PackageName)));
-				}
+				BlueprintPaths.Add(MakeShareable(new FJsonValueString(PackageName)));
 			}
+		}
 
-			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
-			ResponseObj->SetBoolField(TEXT("success"), true);
-			ResponseObj->SetNumberField(TEXT("count"), BlueprintPaths.Num());
-			ResponseObj->SetArrayField(TEXT("blueprints"), BlueprintPaths);
+		TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+		ResponseObj->SetBoolField(TEXT("success"), true);
+		ResponseObj->SetNumberField(TEXT("count"), BlueprintPaths.Num());
+		ResponseObj->SetArrayField(TEXT("blueprints"), BlueprintPaths);
+		AddSnapshotInfo(ResponseObj, *Snapshot, StartTime);
 
-			OnComplete(MakeJsonResponse(ResponseObj));
-		});
+		SendJsonResponse(ResponseObj, OnComplete, AcceptsGzip(Request));
 
 		return true;
 	}
@@ -230,16 +697,32 @@ private:
 			StructPath = TEXT("/Game/") + StructPath;
 		}
 
+		const bool bCompress = WantsCompressedFile(Request);
+		const bool bInlinePayload = FBlueprintExporterLocalTransport::WantsInlinePayload(Request);
+
+		const FString* TypedParam = Request.QueryParams.Find(TEXT("typed"));
+		const bool bTypedValues = TypedParam && TypedParam->ToBool();
+
 		// Dispatch to game thread
-		AsyncTask(ENamedThreads::GameThread, [this, StructPath, OnComplete]()
+		AsyncTask(ENamedThreads::GameThread, [this, StructPath, bCompress, bInlinePayload, bTypedValues, OnComplete]()
 		{
+			if (!bTypedValues && TrySendCachedExport(EBlueprintPrefetchKind::Struct, StructPath, bCompress, OnComplete))
+				return;
+
 			FString StructName = FPaths::GetBaseFilename(StructPath);
 			FString OutputPath = FPaths::Combine(
 				FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
 				StructName + TEXT("_struct.json")
 			);
 
-			bool bSuccess = UBlueprintExporterBPLibrary::ExportStructToJson(StructPath, OutputPath);
+			if (bCompress || bInlinePayload)
+			{
+				SendCapturedExport([&]() { return UBlueprintExporterBPLibrary::ExportStructToJson(StructPath, OutputPath, bTypedValues); }, OutputPath, bCompress,
+					FString::Printf(TEXT("Failed to export struct: %s"), *StructPath), OnComplete);
+				return;
+			}
+
+			bool bSuccess = UBlueprintExporterBPLibrary::ExportStructToJson(StructPath, OutputPath, bTypedValues);
 
 			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
 			ResponseObj->SetBoolField(TEXT("success"), bSuccess);
@@ -286,15 +769,28 @@ private:
 			EnumPath = TEXT("/Game/") + EnumPath;
 		}
 
+		const bool bCompress = WantsCompressedFile(Request);
+		const bool bInlinePayload = FBlueprintExporterLocalTransport::WantsInlinePayload(Request);
+
 		// Dispatch to game thread
-		AsyncTask(ENamedThreads::GameThread, [this, EnumPath, OnComplete]()
+		AsyncTask(ENamedThreads::GameThread, [this, EnumPath, bCompress, bInlinePayload, OnComplete]()
 		{
+			if (TrySendCachedExport(EBlueprintPrefetchKind::Enum, EnumPath, bCompress, OnComplete))
+				return;
+
 			FString EnumName = FPaths::GetBaseFilename(EnumPath);
 			FString OutputPath = FPaths::Combine(
 				FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
 				EnumName + TEXT("_enum.json")
 			);
 
+			if (bCompress || bInlinePayload)
+			{
+				SendCapturedExport([&]() { return UBlueprintExporterBPLibrary::ExportEnumToJson(EnumPath, OutputPath); }, OutputPath, bCompress,
+					FString::Printf(TEXT("Failed to export enum: %s"), *EnumPath), OnComplete);
+				return;
+			}
+
 			bool bSuccess = UBlueprintExporterBPLibrary::ExportEnumToJson(EnumPath, OutputPath);
 
 			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
@@ -317,6 +813,710 @@ private:
 
 		return true;
 	}
+
+	bool HandleExportBytecode(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		FString BlueprintPath;
+
+		const FString* PathParam = Request.QueryParams.Find(TEXT("path"));
+		if (PathParam)
+		{
+			BlueprintPath = *PathParam;
+		}
+
+		if (BlueprintPath.IsEmpty())
+		{
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), false);
+			ResponseObj->SetStringField(TEXT("error"), TEXT("Missing 'path' query parameter. Usage: /export-bytecode?path=/Game/Path/To/Blueprint"));
+			OnComplete(MakeJsonResponse(ResponseObj));
+			return true;
+		}
+
+		// Ensure path starts with /Game/
+		if (!BlueprintPath.StartsWith(TEXT("/Game/")))
+		{
+			BlueprintPath = TEXT("/Game/") + BlueprintPath;
+		}
+
+		const bool bCompress = WantsCompressedFile(Request);
+		const bool bInlinePayload = FBlueprintExporterLocalTransport::WantsInlinePayload(Request);
+
+		// Dispatch to game thread
+		AsyncTask(ENamedThreads::GameThread, [this, BlueprintPath, bCompress, bInlinePayload, OnComplete]()
+		{
+			FString BlueprintName = FPaths::GetBaseFilename(BlueprintPath);
+			FString OutputPath = FPaths::Combine(
+				FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
+				BlueprintName + TEXT("_bytecode.json")
+			);
+
+			if (bCompress || bInlinePayload)
+			{
+				SendCapturedExport([&]() { return UBlueprintExporterBPLibrary::ExportBlueprintBytecodeToJson(BlueprintPath, OutputPath); }, OutputPath, bCompress,
+					FString::Printf(TEXT("Failed to export bytecode: %s"), *BlueprintPath), OnComplete);
+				return;
+			}
+
+			bool bSuccess = UBlueprintExporterBPLibrary::ExportBlueprintBytecodeToJson(BlueprintPath, OutputPath);
+
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), bSuccess);
+
+			if (bSuccess)
+			{
+				ResponseObj->SetStringField(TEXT("output_path"), OutputPath);
+
+				int64 FileSize = IFileManager::Get().FileSize(*OutputPath);
+				ResponseObj->SetNumberField(TEXT("file_size"), static_cast<double>(FileSize));
+			}
+			else
+			{
+				ResponseObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to export bytecode: %s"), *BlueprintPath));
+			}
+
+			OnComplete(MakeJsonResponse(ResponseObj));
+		});
+
+		return true;
+	}
+
+	bool HandleExportDataTable(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		FString AssetPath;
+		EDataTableExportFormat Format = EDataTableExportFormat::NDJson;
+		int32 FirstRow = 0;
+		int32 MaxRows = 0;
+
+		const FString* PathParam = Request.QueryParams.Find(TEXT("path"));
+		if (PathParam)
+		{
+			AssetPath = *PathParam;
+		}
+
+		if (AssetPath.IsEmpty())
+		{
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), false);
+			ResponseObj->SetStringField(TEXT("error"), TEXT("Missing 'path' query parameter. Usage: /export-datatable?path=/Game/Path/To/DT_Table&format=ndjson&offset=0&limit=1000"));
+			OnComplete(MakeJsonResponse(ResponseObj));
+			return true;
+		}
+
+		// Ensure path starts with /Game/
+		if (!AssetPath.StartsWith(TEXT("/Game/")))
+		{
+			AssetPath = TEXT("/Game/") + AssetPath;
+		}
+
+		const FString* FormatParam = Request.QueryParams.Find(TEXT("format"));
+		if (FormatParam && FormatParam->Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+		{
+			Format = EDataTableExportFormat::Csv;
+		}
+
+		const FString* OffsetParam = Request.QueryParams.Find(TEXT("offset"));
+		if (OffsetParam)
+		{
+			FirstRow = FMath::Max(0, FCString::Atoi(**OffsetParam));
+		}
+
+		const FString* LimitParam = Request.QueryParams.Find(TEXT("limit"));
+		if (LimitParam)
+		{
+			MaxRows = FMath::Max(0, FCString::Atoi(**LimitParam));
+		}
+
+		// Dispatch to game thread
+		AsyncTask(ENamedThreads::GameThread, [this, AssetPath, Format, FirstRow, MaxRows, OnComplete]()
+		{
+			// One file per page, so concurrent pages of the same table don't overwrite each other
+			FString AssetName = FPaths::GetBaseFilename(AssetPath);
+			FString OutputPath = FPaths::Combine(
+				FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
+				FString::Printf(TEXT("%s_rows_%d_%d"), *AssetName, FirstRow, MaxRows) + (Format == EDataTableExportFormat::Csv ? TEXT(".csv") : TEXT(".ndjson"))
+			);
+
+			int32 NumRows = 0;
+			int32 TotalRows = 0;
+			bool bSuccess = UBlueprintExporterBPLibrary::ExportDataTableRows(AssetPath, OutputPath, Format, FirstRow, MaxRows, NumRows, TotalRows);
+
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), bSuccess);
+
+			if (bSuccess)
+			{
+				ResponseObj->SetStringField(TEXT("output_path"), OutputPath);
+				ResponseObj->SetStringField(TEXT("format"), Format == EDataTableExportFormat::Csv ? TEXT("csv") : TEXT("ndjson"));
+
+				int64 FileSize = IFileManager::Get().FileSize(*OutputPath);
+				ResponseObj->SetNumberField(TEXT("file_size"), static_cast<double>(FileSize));
+				ResponseObj->SetNumberField(TEXT("total_rows"), TotalRows);
+				ResponseObj->SetNumberField(TEXT("row_count"), NumRows);
+
+				const int32 NextRow = FMath::Min(FirstRow, TotalRows) + NumRows;
+				if (NextRow < TotalRows)
+					ResponseObj->SetNumberField(TEXT("next_offset"), NextRow);
+			}
+			else
+			{
+				ResponseObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to export rows: %s"), *AssetPath));
+			}
+
+			OnComplete(MakeJsonResponse(ResponseObj));
+		});
+
+		return true;
+	}
+
+	bool HandleExportTypes(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		bool bForceRebuild = false;
+
+		const FString* ForceParam = Request.QueryParams.Find(TEXT("force"));
+		if (ForceParam)
+		{
+			bForceRebuild = ForceParam->ToBool();
+		}
+
+		// Dispatch to game thread since the catalogue loads changed types
+		AsyncTask(ENamedThreads::GameThread, [this, bForceRebuild, OnComplete]()
+		{
+			FString OutputPath = FPaths::Combine(
+				FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
+				TEXT("type_catalogue.json")
+			);
+
+			int32 NumTypes = 0;
+			int32 NumRebuilt = 0;
+			bool bSuccess = UBlueprintExporterBPLibrary::ExportTypeCatalogueToJson(OutputPath, bForceRebuild, NumTypes, NumRebuilt);
+
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), bSuccess);
+
+			if (bSuccess)
+			{
+				ResponseObj->SetStringField(TEXT("output_path"), OutputPath);
+
+				int64 FileSize = IFileManager::Get().FileSize(*OutputPath);
+				ResponseObj->SetNumberField(TEXT("file_size"), static_cast<double>(FileSize));
+				ResponseObj->SetNumberField(TEXT("type_count"), NumTypes);
+				ResponseObj->SetNumberField(TEXT("rebuilt_count"), NumRebuilt);
+			}
+			else
+			{
+				ResponseObj->SetStringField(TEXT("error"), TEXT("Failed to export type catalogue"));
+			}
+
+			OnComplete(MakeJsonResponse(ResponseObj));
+		});
+
+		return true;
+	}
+
+	void OnPackageSaved(const FString& Filename, UPackage* Package, FObjectPostSaveContext SaveContext)
+	{
+		if (!bMacroLibraryCurrent || !Package)
+			return;
+
+		ForEachObjectWithPackage(Package, [this](UObject* Object)
+		{
+			const UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+			if (Blueprint && Blueprint->BlueprintType == BPTYPE_MacroLibrary)
+				bMacroLibraryCurrent = false;
+			return bMacroLibraryCurrent;
+		}, false);
+	}
+
+	bool HandleExportMacros(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		bool bForceRebuild = false;
+
+		const FString* ForceParam = Request.QueryParams.Find(TEXT("force"));
+		if (ForceParam)
+		{
+			bForceRebuild = ForceParam->ToBool();
+		}
+
+		// Dispatch to game thread since macro libraries may need loading
+		AsyncTask(ENamedThreads::GameThread, [this, bForceRebuild, OnComplete]()
+		{
+			FString OutputPath = FPaths::Combine(
+				FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
+				TEXT("macro_library.json")
+			);
+
+			const bool bCached = bMacroLibraryCurrent && !bForceRebuild && IFileManager::Get().FileExists(*OutputPath);
+			bool bSuccess = true;
+			if (!bCached)
+			{
+				bSuccess = UBlueprintExporterBPLibrary::ExportMacroLibraryToJson(OutputPath, MacroLibraryCount);
+				bMacroLibraryCurrent = bSuccess;
+			}
+
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), bSuccess);
+
+			if (bSuccess)
+			{
+				ResponseObj->SetStringField(TEXT("output_path"), OutputPath);
+
+				int64 FileSize = IFileManager::Get().FileSize(*OutputPath);
+				ResponseObj->SetNumberField(TEXT("file_size"), static_cast<double>(FileSize));
+				ResponseObj->SetNumberField(TEXT("macro_count"), MacroLibraryCount);
+				ResponseObj->SetBoolField(TEXT("cached"), bCached);
+			}
+			else
+			{
+				ResponseObj->SetStringField(TEXT("error"), TEXT("Failed to export macro library"));
+			}
+
+			OnComplete(MakeJsonResponse(ResponseObj));
+		});
+
+		return true;
+	}
+
+	bool HandleAnalyze(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		FString Filter;
+
+		const FString* FilterParam = Request.QueryParams.Find(TEXT("filter"));
+		if (FilterParam)
+		{
+			Filter = *FilterParam;
+		}
+
+		// Snapshots read UObjects on the game thread; scoring and writing the report run on workers
+		AsyncTask(ENamedThreads::GameThread, [this, Filter, OnComplete]()
+		{
+			const double StartTime = FPlatformTime::Seconds();
+
+			TSharedRef<TArray<FBlueprintAnalysisSnapshot>> Snapshots = MakeShared<TArray<FBlueprintAnalysisSnapshot>>();
+			FBlueprintExporterAnalyzer::SnapshotBlueprints(Filter, *Snapshots);
+
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Snapshots, StartTime, OnComplete]()
+			{
+				FString OutputPath = FPaths::Combine(
+					FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
+					TEXT("blueprint_analysis.json")
+				);
+
+				TArray<FBlueprintAnalysisResult> Results;
+				FBlueprintExporterAnalyzer::Analyze(*Snapshots, Results);
+				bool bSuccess = FBlueprintExporterAnalyzer::WriteReport(Results, OutputPath);
+
+				TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+				ResponseObj->SetBoolField(TEXT("success"), bSuccess);
+
+				if (bSuccess)
+				{
+					ResponseObj->SetStringField(TEXT("output_path"), OutputPath);
+					ResponseObj->SetNumberField(TEXT("blueprint_count"), Results.Num());
+
+					TArray<TSharedPtr<FJsonValue>> Top;
+					for (int32 Rank = 0; Rank < FMath::Min(Results.Num(), 10); Rank++)
+					{
+						TSharedPtr<FJsonObject> TopObj = MakeShareable(new FJsonObject());
+						TopObj->SetStringField(TEXT("blueprint"), Results[Rank].BlueprintPath);
+						TopObj->SetNumberField(TEXT("score"), FMath::RoundToDouble(Results[Rank].Score));
+						Top.Add(MakeShareable(new FJsonValueObject(TopObj)));
+					}
+					ResponseObj->SetArrayField(TEXT("top"), Top);
+				}
+				else
+				{
+					ResponseObj->SetStringField(TEXT("error"), TEXT("Failed to write analysis report"));
+				}
+				ResponseObj->SetNumberField(TEXT("latency_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+				AsyncTask(ENamedThreads::GameThread, [this, ResponseObj, OnComplete]()
+				{
+					OnComplete(MakeJsonResponse(ResponseObj));
+				});
+			});
+		});
+
+		return true;
+	}
+
+	bool HandlePlan(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		FString Filter;
+		bool bDeep = false;
+
+		const FString* FilterParam = Request.QueryParams.Find(TEXT("filter"));
+		if (FilterParam)
+		{
+			Filter = *FilterParam;
+		}
+
+		const FString* DeepParam = Request.QueryParams.Find(TEXT("deep"));
+		if (DeepParam)
+		{
+			bDeep = DeepParam->ToBool();
+		}
+
+		// deep=1 loads blueprints on the game thread; ordering and writing the plan run on workers
+		AsyncTask(ENamedThreads::GameThread, [this, Filter, bDeep, OnComplete]()
+		{
+			const double StartTime = FPlatformTime::Seconds();
+
+			TSharedRef<TArray<FConversionPlanAsset>> Assets = MakeShared<TArray<FConversionPlanAsset>>();
+			FBlueprintExporterPlanner::GatherAssets(Filter, *Assets);
+			if (bDeep)
+				FBlueprintExporterPlanner::AddLoadedReferences(*Assets);
+
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Assets, StartTime, OnComplete]()
+			{
+				FString OutputPath = FPaths::Combine(
+					FPlatformMisc::GetEnvironmentVariable(TEXT("TEMP")),
+					TEXT("conversion_plan.json")
+				);
+
+				FConversionPlan Plan;
+				FBlueprintExporterPlanner::BuildPlan(MoveTemp(*Assets), Plan);
+				bool bSuccess = FBlueprintExporterPlanner::WritePlan(Plan, OutputPath);
+
+				TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+				ResponseObj->SetBoolField(TEXT("success"), bSuccess);
+
+				if (bSuccess)
+				{
+					ResponseObj->SetStringField(TEXT("output_path"), OutputPath);
+					ResponseObj->SetNumberField(TEXT("asset_count"), Plan.Assets.Num());
+					ResponseObj->SetNumberField(TEXT("wave_count"), Plan.Waves.Num());
+					ResponseObj->SetNumberField(TEXT("cycle_count"), Plan.Cycles.Num());
+
+					TArray<TSharedPtr<FJsonValue>> WaveSizes;
+					for (const TArray<int32>& Wave : Plan.Waves)
+						WaveSizes.Add(MakeShareable(new FJsonValueNumber(Wave.Num())));
+					ResponseObj->SetArrayField(TEXT("wave_sizes"), WaveSizes);
+				}
+				else
+				{
+					ResponseObj->SetStringField(TEXT("error"), TEXT("Failed to write conversion plan"));
+				}
+				ResponseObj->SetNumberField(TEXT("latency_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+				AsyncTask(ENamedThreads::GameThread, [this, ResponseObj, OnComplete]()
+				{
+					OnComplete(MakeJsonResponse(ResponseObj));
+				});
+			});
+		});
+
+		return true;
+	}
+
+	bool HandleQuery(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		auto GetNameParam = [&Request](const TCHAR* Name) -> FName
+		{
+			const FString* Value = Request.QueryParams.Find(Name);
+			return (Value && !Value->IsEmpty()) ? FName(**Value) : NAME_None;
+		};
+
+		FBlueprintIndexQuery Query;
+		Query.NodeType = GetNameParam(TEXT("node_type"));
+		Query.FunctionName = GetNameParam(TEXT("function"));
+		Query.TargetClass = GetNameParam(TEXT("target_class"));
+		Query.EventName = GetNameParam(TEXT("event"));
+		Query.VariableName = GetNameParam(TEXT("variable"));
+		Query.TargetType = GetNameParam(TEXT("target_type"));
+		Query.MacroName = GetNameParam(TEXT("macro"));
+		Query.Entry = GetNameParam(TEXT("entry"));
+
+		if (const FString* BlueprintParam = Request.QueryParams.Find(TEXT("blueprint")))
+			Query.BlueprintFilter = *BlueprintParam;
+
+		if (const FString* LimitParam = Request.QueryParams.Find(TEXT("limit")))
+			Query.MaxResults = FMath::Clamp(FCString::Atoi(**LimitParam), 1, 100000);
+
+		// The index is guarded by its own lock, so no UObject is touched; the local socket calls this off the game thread
+		TArray<FBlueprintIndexResult> Results;
+		bool bTruncated = false;
+
+		TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+
+		if (!GraphIndex.Query(Query, Results, bTruncated))
+		{
+			ResponseObj->SetBoolField(TEXT("success"), false);
+			ResponseObj->SetStringField(TEXT("error"), TEXT("Specify at least one of node_type, function, target_class, event, variable, target_type, macro, entry. Usage: /query?node_type=CallFunction&function=SpawnActor&entry=ReceiveTick"));
+			OnComplete(MakeJsonResponse(ResponseObj));
+			return true;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Matches;
+		for (const FBlueprintIndexResult& Result : Results)
+		{
+			TSharedPtr<FJsonObject> MatchObj = MakeShareable(new FJsonObject());
+			MatchObj->SetStringField(TEXT("blueprint"), Result.BlueprintPath.ToString());
+			MatchObj->SetStringField(TEXT("graph"), Result.GraphName.ToString());
+			MatchObj->SetStringField(TEXT("node_name"), Result.NodeName.ToString());
+			MatchObj->SetStringField(TEXT("node_type"), Result.NodeType.ToString());
+
+			if (!Result.FunctionName.IsNone())
+				MatchObj->SetStringField(TEXT("function_name"), Result.FunctionName.ToString());
+			if (!Result.TargetClass.IsNone())
+				MatchObj->SetStringField(TEXT("target_class"), Result.TargetClass.ToString());
+			if (!Result.EventName.IsNone())
+				MatchObj->SetStringField(TEXT("event_name"), Result.EventName.ToString());
+			if (!Result.VariableName.IsNone())
+				MatchObj->SetStringField(TEXT("variable_name"), Result.VariableName.ToString());
+			if (!Result.TargetType.IsNone())
+				MatchObj->SetStringField(TEXT("target_type"), Result.TargetType.ToString());
+			if (!Result.MacroName.IsNone())
+				MatchObj->SetStringField(TEXT("macro_name"), Result.MacroName.ToString());
+
+			TArray<TSharedPtr<FJsonValue>> Entries;
+			for (const FName Entry : Result.Entries)
+				Entries.Add(MakeShareable(new FJsonValueString(Entry.ToString())));
+			MatchObj->SetArrayField(TEXT("entries"), Entries);
+
+			Matches.Add(MakeShareable(new FJsonValueObject(MatchObj)));
+		}
+
+		ResponseObj->SetBoolField(TEXT("success"), true);
+		ResponseObj->SetNumberField(TEXT("count"), Matches.Num());
+		ResponseObj->SetBoolField(TEXT("truncated"), bTruncated);
+		ResponseObj->SetArrayField(TEXT("results"), Matches);
+		ResponseObj->SetBoolField(TEXT("index_ready"), GraphIndex.IsBuilt());
+		ResponseObj->SetNumberField(TEXT("indexed_blueprints"), GraphIndex.GetNumIndexedBlueprints());
+		ResponseObj->SetNumberField(TEXT("pending_blueprints"), GraphIndex.GetNumPendingBlueprints());
+		ResponseObj->SetNumberField(TEXT("latency_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		SendJsonResponse(ResponseObj, OnComplete, AcceptsGzip(Request));
+		return true;
+	}
+
+	/**
+	 * latency_ms is the handler's own time only. Time spent queued before the listener got to the
+	 * request (an HTTP request waits for the next game thread tick) is not included.
+	 */
+	static void AddSnapshotInfo(const TSharedPtr<FJsonObject>& ResponseObj, const FBlueprintRegistrySnapshot& Snapshot, double StartTime)
+	{
+		const double Now = FPlatformTime::Seconds();
+		ResponseObj->SetBoolField(TEXT("registry_complete"), Snapshot.bComplete);
+		ResponseObj->SetNumberField(TEXT("snapshot_age_ms"), (Now - Snapshot.BuildTime) * 1000.0);
+		ResponseObj->SetNumberField(TEXT("latency_ms"), (Now - StartTime) * 1000.0);
+	}
+
+	static TArray<TSharedPtr<FJsonValue>> MakeNameArray(const TArray<FName>& Names)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (const FName Name : Names)
+			Values.Add(MakeShareable(new FJsonValueString(Name.ToString())));
+		return Values;
+	}
+
+	bool HandleDependencies(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		FString BlueprintPath;
+
+		const FString* PathParam = Request.QueryParams.Find(TEXT("path"));
+		if (PathParam)
+		{
+			BlueprintPath = *PathParam;
+		}
+
+		if (BlueprintPath.IsEmpty())
+		{
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), false);
+			ResponseObj->SetStringField(TEXT("error"), TEXT("Missing 'path' query parameter. Usage: /dependencies?path=/Game/Path/To/Blueprint"));
+			OnComplete(MakeJsonResponse(ResponseObj));
+			return true;
+		}
+
+		if (!BlueprintPath.StartsWith(TEXT("/Game/")))
+		{
+			BlueprintPath = TEXT("/Game/") + BlueprintPath;
+		}
+
+		// Accept object paths as well as package names
+		const FName PackageName(*FPackageName::ObjectPathToPackageName(BlueprintPath));
+
+		const TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> Snapshot = Registry.GetSnapshot();
+		const FBlueprintRegistryEntry* Entry = Snapshot->Find(PackageName);
+
+		TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+		if (!Entry)
+		{
+			ResponseObj->SetBoolField(TEXT("success"), false);
+			ResponseObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Blueprint not found in asset registry: %s"), *BlueprintPath));
+			AddSnapshotInfo(ResponseObj, *Snapshot, StartTime);
+			OnComplete(MakeJsonResponse(ResponseObj));
+			return true;
+		}
+
+		TArray<FName> Referencers;
+		for (const int32 ReferencerIndex : Entry->Referencers)
+			Referencers.Add(Snapshot->Blueprints[ReferencerIndex].PackageName);
+
+		ResponseObj->SetBoolField(TEXT("success"), true);
+		ResponseObj->SetStringField(TEXT("path"), Entry->PackageName.ToString());
+		ResponseObj->SetStringField(TEXT("parent_class"), Entry->ParentClassPath);
+		ResponseObj->SetStringField(TEXT("native_parent_class"), Entry->NativeParentClassPath);
+		ResponseObj->SetArrayField(TEXT("dependencies"), MakeNameArray(Entry->Dependencies));
+		ResponseObj->SetArrayField(TEXT("referencers"), MakeNameArray(Referencers));
+		AddSnapshotInfo(ResponseObj, *Snapshot, StartTime);
+
+		SendJsonResponse(ResponseObj, OnComplete, AcceptsGzip(Request));
+		return true;
+	}
+
+	bool HandleMetadata(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		FString Filter;
+		int32 FirstAsset = 0;
+		int32 MaxAssets = 0;
+
+		const FString* FilterParam = Request.QueryParams.Find(TEXT("filter"));
+		if (FilterParam)
+		{
+			Filter = *FilterParam;
+		}
+
+		const FString* OffsetParam = Request.QueryParams.Find(TEXT("offset"));
+		if (OffsetParam)
+		{
+			FirstAsset = FMath::Max(0, FCString::Atoi(**OffsetParam));
+		}
+
+		const FString* LimitParam = Request.QueryParams.Find(TEXT("limit"));
+		if (LimitParam)
+		{
+			MaxAssets = FMath::Max(0, FCString::Atoi(**LimitParam));
+		}
+
+		// Tags only, straight from the registry snapshot: no package is loaded, and over the local socket the game thread isn't involved
+		const TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> Snapshot = Registry.GetSnapshot();
+
+		int32 NumMatches = 0;
+		TArray<TSharedPtr<FJsonValue>> Assets;
+		for (const FBlueprintRegistryEntry& Entry : Snapshot->Blueprints)
+		{
+			const FString PackageName = Entry.PackageName.ToString();
+			if (!Filter.IsEmpty() && !PackageName.Contains(Filter))
+				continue;
+
+			const int32 MatchIndex = NumMatches++;
+			if (MatchIndex < FirstAsset || (MaxAssets > 0 && Assets.Num() >= MaxAssets))
+				continue;
+
+			TArray<TSharedPtr<FJsonValue>> Interfaces;
+			for (const FString& InterfacePath : Entry.ImplementedInterfaces)
+				Interfaces.Add(MakeShareable(new FJsonValueString(InterfacePath)));
+
+			TSharedPtr<FJsonObject> AssetObj = MakeShareable(new FJsonObject());
+			AssetObj->SetStringField(TEXT("path"), PackageName);
+			AssetObj->SetStringField(TEXT("parent_class"), Entry.ParentClassPath);
+			AssetObj->SetStringField(TEXT("native_parent_class"), Entry.NativeParentClassPath);
+			AssetObj->SetStringField(TEXT("blueprint_type"), Entry.BlueprintType);
+			AssetObj->SetBoolField(TEXT("is_data_only"), Entry.bDataOnly);
+			AssetObj->SetArrayField(TEXT("implemented_interfaces"), Interfaces);
+			Assets.Add(MakeShareable(new FJsonValueObject(AssetObj)));
+		}
+
+		TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+		ResponseObj->SetBoolField(TEXT("success"), true);
+		ResponseObj->SetNumberField(TEXT("total"), NumMatches);
+		ResponseObj->SetNumberField(TEXT("offset"), FirstAsset);
+		ResponseObj->SetNumberField(TEXT("count"), Assets.Num());
+
+		const int32 NextAsset = FMath::Min(FirstAsset, NumMatches) + Assets.Num();
+		if (NextAsset < NumMatches)
+			ResponseObj->SetNumberField(TEXT("next_offset"), NextAsset);
+
+		ResponseObj->SetArrayField(TEXT("assets"), Assets);
+		AddSnapshotInfo(ResponseObj, *Snapshot, StartTime);
+
+		SendJsonResponse(ResponseObj, OnComplete, AcceptsGzip(Request));
+		return true;
+	}
+
+	bool HandleExportProperty(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		FString BlueprintPath;
+		FString PropertyName;
+		int32 FirstElement = 0;
+		int32 MaxElements = 0;
+		bool bTypedValues = false;
+
+		const FString* PathParam = Request.QueryParams.Find(TEXT("path"));
+		if (PathParam)
+		{
+			BlueprintPath = *PathParam;
+		}
+
+		const FString* NameParam = Request.QueryParams.Find(TEXT("name"));
+		if (NameParam)
+		{
+			PropertyName = *NameParam;
+		}
+
+		if (BlueprintPath.IsEmpty() || PropertyName.IsEmpty())
+		{
+			TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
+			ResponseObj->SetBoolField(TEXT("success"), false);
+			ResponseObj->SetStringField(TEXT("error"), TEXT("Missing 'path' or 'name' query parameter. Usage: /export-property?path=/Game/Path/To/Blueprint&name=Component.Property&offset=0&limit=100"));
+			OnComplete(MakeJsonResponse(ResponseObj));
+			return true;
+		}
+
+		// Ensure path starts with /Game/
+		if (!BlueprintPath.StartsWith(TEXT("/Game/")) && !BlueprintPath.StartsWith(TEXT("/Script/")))
+		{
+			BlueprintPath = TEXT("/Game/") + BlueprintPath;
+		}
+
+		const FString* OffsetParam = Request.QueryParams.Find(TEXT("offset"));
+		if (OffsetParam)
+		{
+			FirstElement = FMath::Max(0, FCString::Atoi(**OffsetParam));
+		}
+
+		const FString* LimitParam = Request.QueryParams.Find(TEXT("limit"));
+		if (LimitParam)
+		{
+			MaxElements = FMath::Max(0, FCString::Atoi(**LimitParam));
+		}
+
+		const FString* TypedParam = Request.QueryParams.Find(TEXT("typed"));
+		if (TypedParam)
+		{
+			bTypedValues = TypedParam->ToBool();
+		}
+
+		const bool bAcceptsGzip = AcceptsGzip(Request);
+
+		// Dispatch to game thread since the page reads the Blueprint's defaults
+		AsyncTask(ENamedThreads::GameThread, [this, BlueprintPath, PropertyName, FirstElement, MaxElements, bTypedValues, bAcceptsGzip, OnComplete]()
+		{
+			FString Error;
+			TSharedPtr<FJsonObject> ResponseObj = ExportContainerPropertyPage(BlueprintPath, PropertyName, FirstElement, MaxElements, bTypedValues, Error);
+			if (!ResponseObj.IsValid())
+			{
+				ResponseObj = MakeShareable(new FJsonObject());
+				ResponseObj->SetBoolField(TEXT("success"), false);
+				ResponseObj->SetStringField(TEXT("error"), Error);
+				OnComplete(MakeJsonResponse(ResponseObj));
+				return;
+			}
+
+			ResponseObj->SetBoolField(TEXT("success"), true);
+			SendJsonResponse(ResponseObj, OnComplete, bAcceptsGzip);
+		});
+
+		return true;
+	}
 };
 
 IMPLEMENT_MODULE(FBlueprintExporterModule, BlueprintExporter)
@@ -0,0 +1,377 @@
+#include "BlueprintExporterPlanner.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Engine/UserDefinedEnum.h"
+#include "UObject/UnrealType.h"
+#include "Misc/PackageName.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Misc/FileHelper.h"
+
+static const TCHAR* GetAssetKindString(const EConversionAssetKind Kind)
+{
+	switch (Kind)
+	{
+	case EConversionAssetKind::Struct: return TEXT("struct");
+	case EConversionAssetKind::Enum:   return TEXT("enum");
+	default:                           return TEXT("blueprint");
+	}
+}
+
+void FBlueprintExporterPlanner::GatherAssets(const FString& Filter, TArray<FConversionPlanAsset>& OutAssets)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	const TPair<UClass*, EConversionAssetKind> PlannedClasses[] = {
+		{ UBlueprint::StaticClass(), EConversionAssetKind::Blueprint },
+		{ UUserDefinedStruct::StaticClass(), EConversionAssetKind::Struct },
+		{ UUserDefinedEnum::StaticClass(), EConversionAssetKind::Enum },
+	};
+
+	TSet<FName> SeenPackages;
+	for (const TPair<UClass*, EConversionAssetKind>& PlannedClass : PlannedClasses)
+	{
+		TArray<FAssetData> AssetList;
+		AssetRegistry.GetAssetsByClass(PlannedClass.Key->GetClassPathName(), AssetList, true);
+
+		for (const FAssetData& Asset : AssetList)
+		{
+			const FString PackageName = Asset.PackageName.ToString();
+			if (!PackageName.StartsWith(TEXT("/Game/")))
+				continue;
+			if (!Filter.IsEmpty() && !PackageName.Contains(Filter))
+				continue;
+
+			bool bAlreadySeen = false;
+			SeenPackages.Add(Asset.PackageName, &bAlreadySeen);
+			if (bAlreadySeen)
+				continue;
+
+			FConversionPlanAsset& PlanAsset = OutAssets.AddDefaulted_GetRef();
+			PlanAsset.PackageName = Asset.PackageName;
+			PlanAsset.Kind = PlannedClass.Value;
+
+			FString TagValue;
+			if (PlanAsset.Kind == EConversionAssetKind::Blueprint && Asset.GetTagValue(FBlueprintTags::ParentClassPath, TagValue))
+				PlanAsset.ParentClassPath = FPackageName::ExportTextPathToObjectPath(TagValue);
+		}
+	}
+
+	// Dependencies are resolved once every planned package is known; anything outside the plan is already converted or native
+	for (FConversionPlanAsset& PlanAsset : OutAssets)
+	{
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(PlanAsset.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		for (const FName Dependency : Dependencies)
+		{
+			if (Dependency != PlanAsset.PackageName && SeenPackages.Contains(Dependency))
+				PlanAsset.Dependencies.Add(Dependency);
+		}
+
+		if (!PlanAsset.ParentClassPath.IsEmpty())
+		{
+			const FName ParentPackage(*FPackageName::ObjectPathToPackageName(PlanAsset.ParentClassPath));
+			if (SeenPackages.Contains(ParentPackage))
+				PlanAsset.Dependencies.Add(ParentPackage);
+		}
+	}
+}
+
+static void AddReferencedPackage(const UObject* Object, const FName Self, const TSet<FName>& PlannedPackages, TSet<FName>& OutDependencies)
+{
+	if (!Object)
+		return;
+
+	const FName PackageName = Object->GetOutermost()->GetFName();
+	if (PackageName != Self && PlannedPackages.Contains(PackageName))
+		OutDependencies.Add(PackageName);
+}
+
+static void AddPropertyTypeReferences(const FProperty* Property, const FName Self, const TSet<FName>& PlannedPackages, TSet<FName>& OutDependencies)
+{
+	if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		AddReferencedPackage(StructProp->Struct, Self, PlannedPackages, OutDependencies);
+	else if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+		AddReferencedPackage(EnumProp->GetEnum(), Self, PlannedPackages, OutDependencies);
+	else if (const FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+		AddReferencedPackage(ByteProp->Enum, Self, PlannedPackages, OutDependencies);
+	else if (const FClassProperty* ClassProp = CastField<FClassProperty>(Property))
+		AddReferencedPackage(ClassProp->MetaClass, Self, PlannedPackages, OutDependencies);
+	else if (const FSoftClassProperty* SoftClassProp = CastField<FSoftClassProperty>(Property))
+		AddReferencedPackage(SoftClassProp->MetaClass, Self, PlannedPackages, OutDependencies);
+	else if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Property))
+		AddReferencedPackage(ObjectProp->PropertyClass, Self, PlannedPackages, OutDependencies);
+	else if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		AddPropertyTypeReferences(ArrayProp->Inner, Self, PlannedPackages, OutDependencies);
+	else if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+		AddPropertyTypeReferences(SetProp->ElementProp, Self, PlannedPackages, OutDependencies);
+	else if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		AddPropertyTypeReferences(MapProp->KeyProp, Self, PlannedPackages, OutDependencies);
+		AddPropertyTypeReferences(MapProp->ValueProp, Self, PlannedPackages, OutDependencies);
+	}
+}
+
+void FBlueprintExporterPlanner::AddLoadedReferences(TArray<FConversionPlanAsset>& Assets)
+{
+	check(IsInGameThread());
+
+	TSet<FName> PlannedPackages;
+	for (const FConversionPlanAsset& PlanAsset : Assets)
+		PlannedPackages.Add(PlanAsset.PackageName);
+
+	for (FConversionPlanAsset& PlanAsset : Assets)
+	{
+		if (PlanAsset.Kind != EConversionAssetKind::Blueprint)
+			continue;
+
+		const FString PackageName = PlanAsset.PackageName.ToString();
+		const FString ObjectPath = PackageName + TEXT(".") + FPackageName::GetShortName(PackageName);
+		const UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath);
+		if (!Blueprint)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Could not load blueprint at %s"), *PackageName);
+			continue;
+		}
+
+		const FName Self = PlanAsset.PackageName;
+
+		for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+			AddReferencedPackage(Var.VarType.PinSubCategoryObject.Get(), Self, PlannedPackages, PlanAsset.Dependencies);
+
+		UClass* GeneratedClass = Blueprint->GeneratedClass;
+		if (!GeneratedClass)
+			continue;
+
+		// Function parameters and locals, including the ubergraph frame
+		for (TFieldIterator<UFunction> FuncIt(GeneratedClass, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
+		{
+			for (TFieldIterator<FProperty> PropIt(*FuncIt); PropIt; ++PropIt)
+				AddPropertyTypeReferences(*PropIt, Self, PlannedPackages, PlanAsset.Dependencies);
+		}
+
+		// Class defaults: object and class values are what the export reports as blueprint_reference
+		const UObject* CDO = GeneratedClass->GetDefaultObject();
+		for (TFieldIterator<FProperty> PropIt(GeneratedClass); PropIt; ++PropIt)
+		{
+			if (PropIt->GetOwnerClass() == GeneratedClass)
+				AddPropertyTypeReferences(*PropIt, Self, PlannedPackages, PlanAsset.Dependencies);
+
+			if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(*PropIt))
+			{
+				for (int32 Index = 0; Index < ObjectProp->ArrayDim; Index++)
+					AddReferencedPackage(ObjectProp->GetObjectPropertyValue_InContainer(CDO, Index), Self, PlannedPackages, PlanAsset.Dependencies);
+			}
+		}
+	}
+}
+
+void FBlueprintExporterPlanner::BuildPlan(TArray<FConversionPlanAsset>&& Assets, FConversionPlan& OutPlan)
+{
+	OutPlan.Assets = MoveTemp(Assets);
+	OutPlan.Waves.Reset();
+	OutPlan.Cycles.Reset();
+
+	const int32 NumAssets = OutPlan.Assets.Num();
+
+	TMap<FName, int32> IndexByPackage;
+	for (int32 Index = 0; Index < NumAssets; Index++)
+		IndexByPackage.Add(OutPlan.Assets[Index].PackageName, Index);
+
+	TArray<TArray<int32>> Edges;
+	Edges.SetNum(NumAssets);
+	for (int32 Index = 0; Index < NumAssets; Index++)
+	{
+		for (const FName Dependency : OutPlan.Assets[Index].Dependencies)
+		{
+			if (const int32* DependencyIndex = IndexByPackage.Find(Dependency))
+				Edges[Index].Add(*DependencyIndex);
+		}
+	}
+
+	// Tarjan's algorithm, iterative so deep dependency chains can't overflow the stack
+	TArray<int32> Order;
+	TArray<int32> LowLink;
+	TArray<bool> OnStack;
+	Order.Init(INDEX_NONE, NumAssets);
+	LowLink.Init(0, NumAssets);
+	OnStack.Init(false, NumAssets);
+
+	TArray<int32> ComponentOf;
+	ComponentOf.Init(INDEX_NONE, NumAssets);
+	TArray<TArray<int32>> Components;
+
+	TArray<int32> Stack;
+	TArray<TPair<int32, int32>> CallStack;
+	int32 NextOrder = 0;
+
+	auto Visit = [&](int32 Node)
+	{
+		Order[Node] = LowLink[Node] = NextOrder++;
+		Stack.Push(Node);
+		OnStack[Node] = true;
+		CallStack.Push(TPair<int32, int32>(Node, 0));
+	};
+
+	for (int32 Root = 0; Root < NumAssets; Root++)
+	{
+		if (Order[Root] != INDEX_NONE)
+			continue;
+
+		Visit(Root);
+		while (CallStack.Num() > 0)
+		{
+			const int32 Node = CallStack.Last().Key;
+			const int32 EdgeIndex = CallStack.Last().Value;
+
+			if (EdgeIndex < Edges[Node].Num())
+			{
+				CallStack.Last().Value++;
+
+				const int32 Next = Edges[Node][EdgeIndex];
+				if (Order[Next] == INDEX_NONE)
+					Visit(Next);
+				else if (OnStack[Next])
+					LowLink[Node] = FMath::Min(LowLink[Node], Order[Next]);
+				continue;
+			}
+
+			CallStack.Pop();
+			if (CallStack.Num() > 0)
+			{
+				const int32 Caller = CallStack.Last().Key;
+				LowLink[Caller] = FMath::Min(LowLink[Caller], LowLink[Node]);
+			}
+
+			if (LowLink[Node] != Order[Node])
+				continue;
+
+			TArray<int32>& Component = Components.AddDefaulted_GetRef();
+			int32 Member;
+			do
+			{
+				Member = Stack.Pop();
+				OnStack[Member] = false;
+				ComponentOf[Member] = Components.Num() - 1;
+				Component.Add(Member);
+			} while (Member != Node);
+		}
+	}
+
+	// Tarjan emits a component only after everything it depends on, so one pass assigns the wave
+	// of each component as one past the deepest component it depends on
+	TArray<int32> ComponentWave;
+	ComponentWave.Init(0, Components.Num());
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		int32 Wave = 0;
+		for (const int32 Member : Components[ComponentIndex])
+		{
+			for (const int32 Dependency : Edges[Member])
+			{
+				if (ComponentOf[Dependency] != ComponentIndex)
+					Wave = FMath::Max(Wave, ComponentWave[ComponentOf[Dependency]] + 1);
+			}
+		}
+		ComponentWave[ComponentIndex] = Wave;
+
+		if (OutPlan.Waves.Num() <= Wave)
+			OutPlan.Waves.SetNum(Wave + 1);
+		OutPlan.Waves[Wave].Append(Components[ComponentIndex]);
+
+		if (Components[ComponentIndex].Num() > 1)
+			OutPlan.Cycles.Add(Components[ComponentIndex]);
+	}
+
+	auto ByPackageName = [&OutPlan](int32 A, int32 B)
+	{
+		return OutPlan.Assets[A].PackageName.LexicalLess(OutPlan.Assets[B].PackageName);
+	};
+
+	for (TArray<int32>& Wave : OutPlan.Waves)
+		Wave.Sort(ByPackageName);
+	for (TArray<int32>& Cycle : OutPlan.Cycles)
+		Cycle.Sort(ByPackageName);
+}
+
+TSharedPtr<FJsonObject> FBlueprintExporterPlanner::BuildReport(const FConversionPlan& Plan)
+{
+	TMap<int32, int32> CycleOf;
+	for (int32 CycleIndex = 0; CycleIndex < Plan.Cycles.Num(); CycleIndex++)
+	{
+		for (const int32 Member : Plan.Cycles[CycleIndex])
+			CycleOf.Add(Member, CycleIndex);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Waves;
+	for (int32 WaveIndex = 0; WaveIndex < Plan.Waves.Num(); WaveIndex++)
+	{
+		TArray<TSharedPtr<FJsonValue>> Assets;
+		for (const int32 AssetIndex : Plan.Waves[WaveIndex])
+		{
+			const FConversionPlanAsset& PlanAsset = Plan.Assets[AssetIndex];
+
+			TSharedPtr<FJsonObject> AssetObj = MakeShareable(new FJsonObject());
+			AssetObj->SetStringField(TEXT("path"), PlanAsset.PackageName.ToString());
+			AssetObj->SetStringField(TEXT("kind"), GetAssetKindString(PlanAsset.Kind));
+			if (!PlanAsset.ParentClassPath.IsEmpty())
+				AssetObj->SetStringField(TEXT("parent_class"), PlanAsset.ParentClassPath);
+
+			TArray<FName> Dependencies = PlanAsset.Dependencies.Array();
+			Dependencies.Sort(FNameLexicalLess());
+
+			TArray<TSharedPtr<FJsonValue>> DependencyValues;
+			for (const FName Dependency : Dependencies)
+				DependencyValues.Add(MakeShareable(new FJsonValueString(Dependency.ToString())));
+			AssetObj->SetArrayField(TEXT("dependencies"), DependencyValues);
+
+			if (const int32* CycleIndex = CycleOf.Find(AssetIndex))
+				AssetObj->SetNumberField(TEXT("cycle"), *CycleIndex);
+
+			Assets.Add(MakeShareable(new FJsonValueObject(AssetObj)));
+		}
+
+		TSharedPtr<FJsonObject> WaveObj = MakeShareable(new FJsonObject());
+		WaveObj->SetNumberField(TEXT("wave"), WaveIndex);
+		WaveObj->SetArrayField(TEXT("assets"), Assets);
+		Waves.Add(MakeShareable(new FJsonValueObject(WaveObj)));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Cycles;
+	for (const TArray<int32>& Cycle : Plan.Cycles)
+	{
+		TArray<TSharedPtr<FJsonValue>> Members;
+		for (const int32 Member : Cycle)
+			Members.Add(MakeShareable(new FJsonValueString(Plan.Assets[Member].PackageName.ToString())));
+		Cycles.Add(MakeShareable(new FJsonValueArray(Members)));
+	}
+
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject());
+	Root->SetNumberField(TEXT("asset_count"), Plan.Assets.Num());
+	Root->SetNumberField(TEXT("wave_count"), Plan.Waves.Num());
+	Root->SetNumberField(TEXT("cycle_count"), Plan.Cycles.Num());
+	Root->SetArrayField(TEXT("waves"), Waves);
+	Root->SetArrayField(TEXT("cycles"), Cycles);
+	return Root;
+}
+
+bool FBlueprintExporterPlanner::WritePlan(const FConversionPlan& Plan, const FString& OutputPath)
+{
+	TSharedPtr<FJsonObject> Root = BuildReport(Plan);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+	if (FFileHelper::SaveStringToFile(OutputString, *OutputPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Wrote conversion plan of %d assets in %d waves to %s"), Plan.Assets.Num(), Plan.Waves.Num(), *OutputPath);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("BlueprintExporter: Failed to write conversion plan %s"), *OutputPath);
+	return false;
+}
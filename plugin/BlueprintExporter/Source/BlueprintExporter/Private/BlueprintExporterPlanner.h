@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+enum class EConversionAssetKind : uint8
+{
+	Blueprint,
+	Struct,
+	Enum
+};
+
+struct FConversionPlanAsset
+{
+	FName PackageName;
+	EConversionAssetKind Kind = EConversionAssetKind::Blueprint;
+
+	/** Object path from the ParentClass tag; Blueprints only */
+	FString ParentClassPath;
+
+	/** Other planned assets that must be converted before this one */
+	TSet<FName> Dependencies;
+};
+
+struct FConversionPlan
+{
+	TArray<FConversionPlanAsset> Assets;
+
+	/** Asset indices per wave. Everything in a wave depends only on earlier waves, so a wave can be exported and converted in parallel. */
+	TArray<TArray<int32>> Waves;
+
+	/** Asset indices of each dependency cycle; its members are placed in the same wave */
+	TArray<TArray<int32>> Cycles;
+};
+
+/**
+ * Orders project Blueprints, UserDefinedStructs and UserDefinedEnums for conversion so nothing
+ * is ported before its parent class or the types it uses.
+ *
+ * Edges come from hard package dependencies in the asset registry plus the ParentClass tag.
+ * Soft references are left out: they load lazily, don't constrain conversion order, and would
+ * otherwise close most cycles in a typical project. Strongly connected components are found
+ * with Tarjan's algorithm; each one becomes a single node, and the resulting DAG is layered
+ * into waves by longest path from assets with no dependencies.
+ */
+class FBlueprintExporterPlanner
+{
+public:
+	/** Collects every /Game/ asset of a planned kind whose path contains Filter. Registry only, any thread. */
+	static void GatherAssets(const FString& Filter, TArray<FConversionPlanAsset>& OutAssets);
+
+	/**
+	 * Loads each Blueprint and adds the struct, enum and Blueprint class references found in its
+	 * variable types, function signatures, locals and class defaults, the same places the export
+	 * reports struct_reference and blueprint_reference. Game thread only.
+	 */
+	static void AddLoadedReferences(TArray<FConversionPlanAsset>& Assets);
+
+	/** Any thread */
+	static void BuildPlan(TArray<FConversionPlanAsset>&& Assets, FConversionPlan& OutPlan);
+
+	static TSharedPtr<FJsonObject> BuildReport(const FConversionPlan& Plan);
+
+	static bool WritePlan(const FConversionPlan& Plan, const FString& OutputPath);
+};
@@ -0,0 +1,427 @@
+#include "BlueprintExporterPrefetcher.h"
+#include "BlueprintExporterBPLibrary.h"
+#include "BlueprintExporterRegistry.h"
+#include "BlueprintExporterTrace.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+// Time after which no further export starts in the same editor frame; best-effort, since the
+// export that crosses it always finishes
+static const double PREFETCH_BUDGET_SECONDS = 0.004;
+
+// Packages the prefetcher may load into memory itself; -BlueprintExporterPrefetchMaxLoads= overrides it
+static const int32 PREFETCH_DEFAULT_MAX_LOADS = 500;
+
+// Seconds without keyboard or mouse input before prefetching starts; -BlueprintExporterPrefetchIdle= overrides it
+static const double PREFETCH_DEFAULT_IDLE_SECONDS = 5.0;
+
+void FBlueprintExporterPrefetcher::Start(const FBlueprintExporterRegistry& InRegistry)
+{
+	Registry = &InRegistry;
+
+	IdleSeconds = PREFETCH_DEFAULT_IDLE_SECONDS;
+	FParse::Value(FCommandLine::Get(), TEXT("BlueprintExporterPrefetchIdle="), IdleSeconds);
+
+	MaxLoads = PREFETCH_DEFAULT_MAX_LOADS;
+	FParse::Value(FCommandLine::Get(), TEXT("BlueprintExporterPrefetchMaxLoads="), MaxLoads);
+
+	LoadCallbacksValid = MakeShared<bool>(true);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FBlueprintExporterPrefetcher::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FBlueprintExporterPrefetcher::OnAssetRenamed);
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FBlueprintExporterPrefetcher::OnPackageSaved);
+
+	// The registry scan must finish before the asset list is complete
+	if (AssetRegistry.IsLoadingAssets())
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FBlueprintExporterPrefetcher::OnFilesLoaded);
+	else
+		EnqueueAllAssets();
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FBlueprintExporterPrefetcher::Tick));
+	bRunning = true;
+}
+
+void FBlueprintExporterPrefetcher::Stop()
+{
+	if (!bRunning)
+		return;
+	bRunning = false;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	*LoadCallbacksValid = false;
+	LoadCallbacksValid.Reset();
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+	}
+
+	Pending.Empty();
+	Cached.Empty();
+	RequestCounts.Empty();
+	LoadedPackages.Empty();
+	LoadingPackage = NAME_None;
+	NumPending = 0;
+	NumCached = 0;
+}
+
+FBlueprintExporterPrefetcher::FPrefetchKey FBlueprintExporterPrefetcher::MakeKey(EBlueprintPrefetchKind Kind, const FString& AssetPath)
+{
+	// Handlers accept both /Game/Foo/BP_Bar and /Game/Foo/BP_Bar.BP_Bar
+	return FPrefetchKey(Kind, FName(*FPackageName::ObjectPathToPackageName(AssetPath)));
+}
+
+FString FBlueprintExporterPrefetcher::GetCachePath(const FPrefetchKey& Key)
+{
+	// Mirrors the package path, so same-named assets in different folders don't collide
+	const TCHAR* Suffix = Key.Key == EBlueprintPrefetchKind::Struct ? TEXT("_struct.json")
+		: Key.Key == EBlueprintPrefetchKind::Enum ? TEXT("_enum.json")
+		: TEXT(".json");
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintExporter"), TEXT("Prefetch"), Key.Value.ToString() + Suffix);
+}
+
+void FBlueprintExporterPrefetcher::NoteRequest(EBlueprintPrefetchKind Kind, const FString& AssetPath)
+{
+	if (bRunning)
+		RequestCounts.FindOrAdd(MakeKey(Kind, AssetPath))++;
+}
+
+bool FBlueprintExporterPrefetcher::FindCachedExport(EBlueprintPrefetchKind Kind, const FString& AssetPath, FString& OutPath)
+{
+	const FPrefetchKey Key = MakeKey(Kind, AssetPath);
+	const FString* CachePath = Cached.Find(Key);
+	if (!CachePath)
+		return false;
+
+	// Unsaved edits aren't in the cached export; the save will queue a fresh one
+	if (IsDirtyWithDependencies(Key))
+		return false;
+
+	if (!IFileManager::Get().FileExists(**CachePath))
+	{
+		Cached.Remove(Key);
+		NumCached = Cached.Num();
+		Enqueue(Key, FDateTime::UtcNow());
+		return false;
+	}
+
+	OutPath = *CachePath;
+	NumHits++;
+	return true;
+}
+
+bool FBlueprintExporterPrefetcher::IsDirtyWithDependencies(const FPrefetchKey& Key) const
+{
+	const UPackage* Package = FindPackage(nullptr, *Key.Value.ToString());
+	if (Package && Package->IsDirty())
+		return true;
+
+	if (Key.Key != EBlueprintPrefetchKind::Blueprint)
+		return false;
+
+	// The export embeds its parents' defaults and its structs' and enums' layouts, so an unsaved
+	// edit to any package it depends on, directly or through a parent Blueprint, makes it stale too
+	const TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> Snapshot = Registry->GetSnapshot();
+
+	TArray<FName> ToVisit = { Key.Value };
+	TSet<FName> Visited(ToVisit);
+	while (ToVisit.Num() > 0)
+	{
+		const FBlueprintRegistryEntry* Entry = Snapshot->Find(ToVisit.Pop(false));
+		if (!Entry)
+			continue;
+
+		for (const FName Dependency : Entry->Dependencies)
+		{
+			bool bAlreadyVisited = false;
+			Visited.Add(Dependency, &bAlreadyVisited);
+			if (bAlreadyVisited)
+				continue;
+
+			const UPackage* DependencyPackage = FindPackage(nullptr, *Dependency.ToString());
+			if (DependencyPackage && DependencyPackage->IsDirty())
+				return true;
+			ToVisit.Add(Dependency);
+		}
+	}
+	return false;
+}
+
+void FBlueprintExporterPrefetcher::OnFilesLoaded()
+{
+	EnqueueAllAssets();
+}
+
+void FBlueprintExporterPrefetcher::EnqueueAllAssets()
+{
+	if (bInitialQueueDone)
+		return;
+	bInitialQueueDone = true;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	const TPair<EBlueprintPrefetchKind, UClass*> PrefetchedClasses[] = {
+		{ EBlueprintPrefetchKind::Blueprint, UBlueprint::StaticClass() },
+		{ EBlueprintPrefetchKind::Struct, UUserDefinedStruct::StaticClass() },
+		{ EBlueprintPrefetchKind::Enum, UUserDefinedEnum::StaticClass() },
+	};
+
+	for (const TPair<EBlueprintPrefetchKind, UClass*>& PrefetchedClass : PrefetchedClasses)
+	{
+		TArray<FAssetData> AssetList;
+		AssetRegistry.GetAssetsByClass(PrefetchedClass.Value->GetClassPathName(), AssetList, true);
+
+		for (const FAssetData& Asset : AssetList)
+		{
+			const FString PackageString = Asset.PackageName.ToString();
+			if (!PackageString.StartsWith(TEXT("/Game/")))
+				continue;
+
+			const FString Filename = FPackageName::LongPackageNameToFilename(PackageString, FPackageName::GetAssetPackageExtension());
+			Enqueue(FPrefetchKey(PrefetchedClass.Key, Asset.PackageName), IFileManager::Get().GetTimeStamp(*Filename));
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Prefetching %d assets while the editor is idle"), Pending.Num());
+}
+
+void FBlueprintExporterPrefetcher::Enqueue(const FPrefetchKey& Key, const FDateTime& ModifiedTime)
+{
+	FDateTime& Existing = Pending.FindOrAdd(Key, ModifiedTime);
+	Existing = FMath::Max(Existing, ModifiedTime);
+	NumPending = Pending.Num();
+}
+
+static bool IsPackageInMemory(const FName PackageName)
+{
+	const UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+	return Package && Package->IsFullyLoaded();
+}
+
+bool FBlueprintExporterPrefetcher::FindNextPending(FPrefetchKey& OutKey) const
+{
+	// Most-requested first, then most recently modified: what is being worked on now gets asked for next
+	int32 BestRequests = -1;
+	FDateTime BestModified;
+	for (const TPair<FPrefetchKey, FDateTime>& Entry : Pending)
+	{
+		const int32* Requests = RequestCounts.Find(Entry.Key);
+		const int32 NumRequests = Requests ? *Requests : 0;
+		if (NumRequests > BestRequests || (NumRequests == BestRequests && Entry.Value > BestModified))
+		{
+			OutKey = Entry.Key;
+			BestRequests = NumRequests;
+			BestModified = Entry.Value;
+		}
+	}
+	return BestRequests >= 0;
+}
+
+void FBlueprintExporterPrefetcher::StartLoad(const FPrefetchKey& Key)
+{
+	LoadingPackage = Key.Value;
+	LoadedPackages.Add(Key.Value);
+
+	if (LoadedPackages.Num() == MaxLoads)
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Prefetch has loaded %d packages; queued assets not in memory are dropped from now on"), MaxLoads);
+
+	TSharedPtr<bool> bCallbackValid = LoadCallbacksValid;
+	LoadPackageAsync(Key.Value.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+		[this, Key, bCallbackValid](const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+		{
+			if (!*bCallbackValid)
+				return;
+
+			LoadingPackage = NAME_None;
+			if (Result != EAsyncLoadingResult::Succeeded)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Prefetch could not load %s"), *PackageName.ToString());
+				Pending.Remove(Key);
+				NumPending = Pending.Num();
+			}
+		}));
+}
+
+bool FBlueprintExporterPrefetcher::Export(const FPrefetchKey& Key)
+{
+	const FString AssetPath = Key.Value.ToString();
+	const FString CachePath = GetCachePath(Key);
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(CachePath), true);
+
+	switch (Key.Key)
+	{
+	case EBlueprintPrefetchKind::Blueprint:
+		return UBlueprintExporterBPLibrary::ExportBlueprintToJsonWithOptions(AssetPath, FBlueprintExportOptions(), CachePath);
+	case EBlueprintPrefetchKind::Struct:
+		return UBlueprintExporterBPLibrary::ExportStructToJson(AssetPath, CachePath);
+	case EBlueprintPrefetchKind::Enum:
+		return UBlueprintExporterBPLibrary::ExportEnumToJson(AssetPath, CachePath);
+	}
+	return false;
+}
+
+bool FBlueprintExporterPrefetcher::Tick(float DeltaTime)
+{
+	// Loading assets mid-PIE or during GC causes hitches and is not safe
+	if (Pending.Num() == 0 || IsGarbageCollecting() || (GEditor && GEditor->PlayWorld))
+		return true;
+
+	// Wait for the package being loaded rather than reordering the queue around it
+	if (!LoadingPackage.IsNone())
+		return true;
+
+	// Only while nobody is using the editor; an export can take longer than a frame
+	if (!FSlateApplication::IsInitialized() || FPlatformTime::Seconds() - FSlateApplication::Get().GetLastUserInteractionTime() < IdleSeconds)
+		return true;
+
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::Prefetch);
+
+	const double StartTime = FPlatformTime::Seconds();
+	FPrefetchKey Key;
+	while (FPlatformTime::Seconds() - StartTime < PREFETCH_BUDGET_SECONDS && FindNextPending(Key))
+	{
+		// Loading happens off this frame; the asset is exported on a later tick once it's in memory
+		if (!IsPackageInMemory(Key.Value))
+		{
+			if (LoadedPackages.Num() < MaxLoads)
+			{
+				StartLoad(Key);
+				break;
+			}
+
+			Pending.Remove(Key);
+			continue;
+		}
+
+		Pending.Remove(Key);
+
+		if (Export(Key))
+			Cached.Add(Key, GetCachePath(Key));
+		else
+			UE_LOG(LogTemp, Warning, TEXT("BlueprintExporter: Prefetch failed for %s"), *Key.Value.ToString());
+	}
+	NumPending = Pending.Num();
+	NumCached = Cached.Num();
+
+	if (Pending.Num() == 0)
+		UE_LOG(LogTemp, Log, TEXT("BlueprintExporter: Prefetch queue drained (%d exports cached)"), Cached.Num());
+
+	return true;
+}
+
+void FBlueprintExporterPrefetcher::Invalidate(const FName PackageName, EBlueprintPrefetchKind SavedKind, bool bSavedIsPrefetchable)
+{
+	const FDateTime Now = FDateTime::UtcNow();
+
+	// The saved asset itself
+	for (const EBlueprintPrefetchKind Kind : { EBlueprintPrefetchKind::Blueprint, EBlueprintPrefetchKind::Struct, EBlueprintPrefetchKind::Enum })
+		Cached.Remove(FPrefetchKey(Kind, PackageName));
+	if (bSavedIsPrefetchable)
+		Enqueue(FPrefetchKey(SavedKind, PackageName), Now);
+
+	// Blueprint exports embed their parents' defaults and their structs' and enums' layouts, so
+	// every Blueprint that depends on the package, directly or not, is re-exported as well
+	const TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> Snapshot = Registry->GetSnapshot();
+
+	TArray<int32> Stale;
+	if (const int32* SavedIndex = Snapshot->IndexByPackage.Find(PackageName))
+	{
+		Stale.Append(Snapshot->Blueprints[*SavedIndex].Referencers);
+	}
+	else
+	{
+		for (int32 Index = 0; Index < Snapshot->Blueprints.Num(); Index++)
+		{
+			if (Snapshot->Blueprints[Index].Dependencies.Contains(PackageName))
+				Stale.Add(Index);
+		}
+	}
+
+	TSet<int32> Visited(Stale);
+	while (Stale.Num() > 0)
+	{
+		const FBlueprintRegistryEntry& Entry = Snapshot->Blueprints[Stale.Pop(false)];
+
+		const FPrefetchKey Key(EBlueprintPrefetchKind::Blueprint, Entry.PackageName);
+		if (Cached.Remove(Key) > 0)
+			Enqueue(Key, Now);
+
+		for (const int32 Referencer : Entry.Referencers)
+		{
+			bool bAlreadyVisited = false;
+			Visited.Add(Referencer, &bAlreadyVisited);
+			if (!bAlreadyVisited)
+				Stale.Add(Referencer);
+		}
+	}
+
+	NumCached = Cached.Num();
+}
+
+void FBlueprintExporterPrefetcher::OnPackageSaved(const FString& Filename, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (!Package)
+		return;
+
+	EBlueprintPrefetchKind SavedKind = EBlueprintPrefetchKind::Blueprint;
+	bool bPrefetchable = false;
+	ForEachObjectWithPackage(Package, [&SavedKind, &bPrefetchable](UObject* Object)
+	{
+		if (Object->IsA<UBlueprint>())
+			SavedKind = EBlueprintPrefetchKind::Blueprint;
+		else if (Object->IsA<UUserDefinedStruct>())
+			SavedKind = EBlueprintPrefetchKind::Struct;
+		else if (Object->IsA<UUserDefinedEnum>())
+			SavedKind = EBlueprintPrefetchKind::Enum;
+		else
+			return true;
+
+		bPrefetchable = true;
+		return false;
+	}, false);
+
+	Invalidate(Package->GetFName(), SavedKind, bPrefetchable && Package->GetName().StartsWith(TEXT("/Game/")));
+}
+
+void FBlueprintExporterPrefetcher::RemoveAsset(const FName PackageName)
+{
+	for (const EBlueprintPrefetchKind Kind : { EBlueprintPrefetchKind::Blueprint, EBlueprintPrefetchKind::Struct, EBlueprintPrefetchKind::Enum })
+	{
+		const FPrefetchKey Key(Kind, PackageName);
+		Cached.Remove(Key);
+		Pending.Remove(Key);
+		RequestCounts.Remove(Key);
+	}
+	NumCached = Cached.Num();
+	NumPending = Pending.Num();
+}
+
+void FBlueprintExporterPrefetcher::OnAssetRemoved(const FAssetData& AssetData)
+{
+	RemoveAsset(AssetData.PackageName);
+}
+
+void FBlueprintExporterPrefetcher::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	RemoveAsset(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+class FBlueprintExporterRegistry;
+class UPackage;
+class FObjectPostSaveContext;
+struct FAssetData;
+
+/** The exports the prefetcher produces; each matches a handler called with default options */
+enum class EBlueprintPrefetchKind : uint8
+{
+	Blueprint,
+	Struct,
+	Enum
+};
+
+/**
+ * Opt-in (-BlueprintExporterPrefetch) background exporter that warms the output cache while the
+ * editor is idle, so interactive /export, /export-struct and /export-enum calls skip the load and walk.
+ *
+ * Once the asset registry has finished scanning, every project Blueprint, struct and enum is queued.
+ * When there has been no user input for the idle time (-BlueprintExporterPrefetchIdle=, seconds),
+ * assets are exported on the game thread, most-requested first, then most recently modified.
+ * Packages that aren't in memory are loaded asynchronously, one at a time, and exported on a later
+ * tick. The per-frame budget only decides whether another export starts: the walk of one asset
+ * always runs to completion, so a large Blueprint can still take a long frame.
+ *
+ * Loaded assets stay resident, so at most -BlueprintExporterPrefetchMaxLoads= packages are loaded by
+ * the prefetcher; past that, queued assets that aren't in memory are dropped. Saving a package drops its
+ * cached export and those of every Blueprint depending on it, and queues them again. Game thread
+ * only, apart from the counters.
+ */
+class FBlueprintExporterPrefetcher
+{
+public:
+	void Start(const FBlueprintExporterRegistry& InRegistry);
+	void Stop();
+
+	bool IsRunning() const { return bRunning; }
+
+	/** Counts an interactive request so the asset is prefetched earlier next time it is stale */
+	void NoteRequest(EBlueprintPrefetchKind Kind, const FString& AssetPath);
+
+	/** Output path of a current default-options export of AssetPath, or false on a miss */
+	bool FindCachedExport(EBlueprintPrefetchKind Kind, const FString& AssetPath, FString& OutPath);
+
+	int32 GetNumCached() const { return NumCached; }
+	int32 GetNumPending() const { return NumPending; }
+	int32 GetNumHits() const { return NumHits; }
+
+private:
+	using FPrefetchKey = TPair<EBlueprintPrefetchKind, FName>;
+
+	static FPrefetchKey MakeKey(EBlueprintPrefetchKind Kind, const FString& AssetPath);
+	static FString GetCachePath(const FPrefetchKey& Key);
+
+	void EnqueueAllAssets();
+	void Enqueue(const FPrefetchKey& Key, const FDateTime& ModifiedTime);
+	bool FindNextPending(FPrefetchKey& OutKey) const;
+	void StartLoad(const FPrefetchKey& Key);
+	bool IsDirtyWithDependencies(const FPrefetchKey& Key) const;
+	bool Export(const FPrefetchKey& Key);
+	void Invalidate(const FName PackageName, EBlueprintPrefetchKind SavedKind, bool bSavedIsPrefetchable);
+	void RemoveAsset(const FName PackageName);
+
+	bool Tick(float DeltaTime);
+	void OnPackageSaved(const FString& Filename, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnFilesLoaded();
+
+	const FBlueprintExporterRegistry* Registry = nullptr;
+	double IdleSeconds = 0.0;
+	int32 MaxLoads = 0;
+
+	/** Queued exports with the package file timestamp, or the save time for packages saved this session */
+	TMap<FPrefetchKey, FDateTime> Pending;
+	TMap<FPrefetchKey, FString> Cached;
+	TMap<FPrefetchKey, int32> RequestCounts;
+
+	/** Packages the prefetcher loaded itself, counted against MaxLoads */
+	TSet<FName> LoadedPackages;
+	FName LoadingPackage;
+
+	/** Cleared by Stop, so a load completing afterwards doesn't touch the prefetcher */
+	TSharedPtr<bool> LoadCallbacksValid;
+	bool bInitialQueueDone = false;
+	bool bRunning = false;
+
+	// Read by /ping from other threads
+	std::atomic<int32> NumPending{0};
+	std::atomic<int32> NumCached{0};
+	std::atomic<int32> NumHits{0};
+
+	FTSTicker::FDelegateHandle TickHandle;
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
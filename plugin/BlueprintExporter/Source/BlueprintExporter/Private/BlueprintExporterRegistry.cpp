@@ -0,0 +1,195 @@
+#include "BlueprintExporterRegistry.h"
+#include "BlueprintExporterTrace.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+
+// Minimum time between snapshot rebuilds; the initial registry scan fires thousands of events
+static const double REGISTRY_REFRESH_INTERVAL = 1.0;
+
+const FBlueprintRegistryEntry* FBlueprintRegistrySnapshot::Find(const FName PackageName) const
+{
+	const int32* Index = IndexByPackage.Find(PackageName);
+	return Index ? &Blueprints[*Index] : nullptr;
+}
+
+void FBlueprintExporterRegistry::Start()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FBlueprintExporterRegistry::MarkStale);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FBlueprintExporterRegistry::MarkStale);
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FBlueprintExporterRegistry::MarkStale);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FBlueprintExporterRegistry::OnAssetRenamed);
+
+	const bool bLoading = AssetRegistry.IsLoadingAssets();
+	if (bLoading)
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FBlueprintExporterRegistry::OnFilesLoaded);
+
+	// Built synchronously once so GetSnapshot() never returns null
+	Snapshot = BuildSnapshot(!bLoading);
+	LastRebuildTime = FPlatformTime::Seconds();
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FBlueprintExporterRegistry::Tick));
+}
+
+void FBlueprintExporterRegistry::Stop()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+	}
+
+	// The rebuild task writes into this object
+	if (PendingRebuild.IsValid())
+		PendingRebuild.Wait();
+
+	FWriteScopeLock WriteLock(Lock);
+	Snapshot.Reset();
+}
+
+TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> FBlueprintExporterRegistry::GetSnapshot() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Snapshot;
+}
+
+void FBlueprintExporterRegistry::MarkStale(const FAssetData& AssetData)
+{
+	if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+		bStale = true;
+}
+
+void FBlueprintExporterRegistry::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	MarkStale(AssetData);
+}
+
+void FBlueprintExporterRegistry::OnFilesLoaded()
+{
+	bStale = true;
+}
+
+bool FBlueprintExporterRegistry::Tick(float DeltaTime)
+{
+	if (!bStale || (PendingRebuild.IsValid() && !PendingRebuild.IsReady()))
+		return true;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastRebuildTime < REGISTRY_REFRESH_INTERVAL)
+		return true;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const bool bComplete = !AssetRegistry.IsLoadingAssets();
+
+	bStale = false;
+	LastRebuildTime = Now;
+
+	// Registry queries are thread-safe, so the rebuild stays off the game thread entirely
+	PendingRebuild = Async(EAsyncExecution::ThreadPool, [this, bComplete]()
+	{
+		TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> NewSnapshot = BuildSnapshot(bComplete);
+
+		FWriteScopeLock WriteLock(Lock);
+		Snapshot = MoveTemp(NewSnapshot);
+	});
+
+	return true;
+}
+
+/** The ImplementedInterfaces tag is either a comma separated list of class paths or exported (Interface=...,Graphs=(...)) entries */
+static void ParseImplementedInterfaces(const FString& TagValue, TArray<FString>& OutInterfaces)
+{
+	TArray<FString> Items;
+	if (TagValue.Contains(TEXT("Interface=")))
+	{
+		// Graph lists contain commas too, so only the text after each Interface= is taken
+		static const FString Key = TEXT("Interface=");
+		int32 Start = TagValue.Find(Key);
+		while (Start != INDEX_NONE)
+		{
+			Start += Key.Len();
+			int32 End = Start;
+			while (End < TagValue.Len() && TagValue[End] != TCHAR(',') && TagValue[End] != TCHAR(')'))
+				End++;
+			Items.Add(TagValue.Mid(Start, End - Start));
+			Start = TagValue.Find(Key, ESearchCase::CaseSensitive, ESearchDir::FromStart, End);
+		}
+	}
+	else
+	{
+		TagValue.ParseIntoArray(Items, TEXT(","));
+	}
+
+	for (const FString& Item : Items)
+	{
+		const FString InterfacePath = FPackageName::ExportTextPathToObjectPath(Item.TrimStartAndEnd().TrimQuotes());
+		if (!InterfacePath.IsEmpty() && InterfacePath != TEXT("None"))
+			OutInterfaces.AddUnique(InterfacePath);
+	}
+}
+
+TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> FBlueprintExporterRegistry::BuildSnapshot(bool bComplete)
+{
+	BLUEPRINT_EXPORTER_TRACE_SCOPE(BlueprintExporter::BuildRegistrySnapshot);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FAssetData> AssetList;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetList);
+
+	TSharedPtr<FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FBlueprintRegistrySnapshot, ESPMode::ThreadSafe>();
+	NewSnapshot->bComplete = bComplete;
+	NewSnapshot->BuildTime = FPlatformTime::Seconds();
+	NewSnapshot->Blueprints.Reserve(AssetList.Num());
+
+	for (const FAssetData& Asset : AssetList)
+	{
+		if (NewSnapshot->IndexByPackage.Contains(Asset.PackageName))
+			continue;
+
+		FBlueprintRegistryEntry& Entry = NewSnapshot->Blueprints.AddDefaulted_GetRef();
+		Entry.PackageName = Asset.PackageName;
+
+		FString TagValue;
+		if (Asset.GetTagValue(FBlueprintTags::ParentClassPath, TagValue))
+			Entry.ParentClassPath = FPackageName::ExportTextPathToObjectPath(TagValue);
+		if (Asset.GetTagValue(FBlueprintTags::NativeParentClassPath, TagValue))
+			Entry.NativeParentClassPath = FPackageName::ExportTextPathToObjectPath(TagValue);
+		if (Asset.GetTagValue(FBlueprintTags::BlueprintType, TagValue))
+			Entry.BlueprintType = TagValue;
+		if (Asset.GetTagValue(FBlueprintTags::ImplementedInterfaces, TagValue))
+			ParseImplementedInterfaces(TagValue, Entry.ImplementedInterfaces);
+		if (Asset.GetTagValue(FBlueprintTags::IsDataOnly, TagValue))
+			Entry.bDataOnly = TagValue.ToBool();
+
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(Asset.PackageName, Dependencies);
+		for (const FName Dependency : Dependencies)
+		{
+			if (!FPackageName::IsScriptPackage(Dependency.ToString()))
+				Entry.Dependencies.Add(Dependency);
+		}
+
+		NewSnapshot->IndexByPackage.Add(Asset.PackageName, NewSnapshot->Blueprints.Num() - 1);
+	}
+
+	for (int32 Index = 0; Index < NewSnapshot->Blueprints.Num(); Index++)
+	{
+		for (const FName Dependency : NewSnapshot->Blueprints[Index].Dependencies)
+		{
+			if (const int32* DependencyIndex = NewSnapshot->IndexByPackage.Find(Dependency))
+				NewSnapshot->Blueprints[*DependencyIndex].Referencers.Add(Index);
+		}
+	}
+
+	return NewSnapshot;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
+
+struct FAssetData;
+
+/** Registry-only facts about one Blueprint asset; nothing here requires loading it */
+struct FBlueprintRegistryEntry
+{
+	FName PackageName;
+
+	/** Object paths from the ParentClass/NativeParentClass tags, e.g. /Script/Engine.Actor */
+	FString ParentClassPath;
+	FString NativeParentClassPath;
+
+	/** BlueprintType tag: BPTYPE_Normal, BPTYPE_Interface, BPTYPE_FunctionLibrary, BPTYPE_MacroLibrary, ... */
+	FString BlueprintType;
+
+	/** Object paths of the interfaces the Blueprint implements itself; inherited ones aren't tagged */
+	TArray<FString> ImplementedInterfaces;
+
+	/** IsDataOnly tag: no graphs or variables of its own, only class defaults */
+	bool bDataOnly = false;
+
+	/** Content packages this Blueprint's package depends on (native /Script/ modules excluded) */
+	TArray<FName> Dependencies;
+
+	/** Indices of other Blueprints in the snapshot that depend on this one */
+	TArray<int32> Referencers;
+};
+
+/** Immutable once published; readers hold a shared pointer, so a rebuild never blocks them */
+struct FBlueprintRegistrySnapshot
+{
+	TArray<FBlueprintRegistryEntry> Blueprints;
+	TMap<FName, int32> IndexByPackage;
+
+	/** False while the asset registry was still scanning when this snapshot was taken */
+	bool bComplete = false;
+
+	double BuildTime = 0.0;
+
+	const FBlueprintRegistryEntry* Find(const FName PackageName) const;
+};
+
+/**
+ * Keeps an immutable snapshot of the asset registry's Blueprint entries, so registry-only
+ * endpoints can be answered without loading anything and from any thread. HTTP handlers still
+ * run when the game thread ticks the listener; the local socket transport calls them on its
+ * connection threads, where a game thread stall doesn't delay them.
+ *
+ * Registry changes only mark the snapshot stale; a replacement is built on a worker thread at
+ * most once per REGISTRY_REFRESH_INTERVAL and swapped in. Readers see either the old or the new
+ * snapshot, never a partial one.
+ */
+class FBlueprintExporterRegistry
+{
+public:
+	void Start();
+	void Stop();
+
+	/** Never null after Start(). Any thread. */
+	TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> GetSnapshot() const;
+
+private:
+	static TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> BuildSnapshot(bool bComplete);
+
+	bool Tick(float DeltaTime);
+	void MarkStale(const FAssetData& AssetData);
+
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnFilesLoaded();
+
+	mutable FRWLock Lock;
+	TSharedPtr<const FBlueprintRegistrySnapshot, ESPMode::ThreadSafe> Snapshot;
+
+	// Game-thread state
+	bool bStale = false;
+	double LastRebuildTime = 0.0;
+	TFuture<void> PendingRebuild;
+
+	FTSTicker::FDelegateHandle TickHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+/**
+ * Unreal Insights instrumentation. Scopes and counters only record while the BlueprintExporter
+ * channel is enabled, e.g. -trace=cpu,counters,BlueprintExporter on the command line or
+ * Trace.Enable BlueprintExporter at runtime; without trace support they compile away.
+ */
+UE_TRACE_CHANNEL_EXTERN(BlueprintExporterChannel);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(BlueprintExporter_NodesExported);
+TRACE_DECLARE_INT_COUNTER_EXTERN(BlueprintExporter_PinsExported);
+TRACE_DECLARE_INT_COUNTER_EXTERN(BlueprintExporter_BytesWritten);
+
+#define BLUEPRINT_EXPORTER_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, BlueprintExporterChannel)
+
+#define BLUEPRINT_EXPORTER_TRACE_COUNT(Counter, Amount) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(BlueprintExporterChannel)) \
+		{ \
+			TRACE_COUNTER_ADD(Counter, Amount); \
+		} \
+	} while (0)
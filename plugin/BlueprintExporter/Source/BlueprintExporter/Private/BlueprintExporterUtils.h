@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraphNode;
+class UEdGraphPin;
+class FJsonObject;
+
+/**
+ * The node-specific data ExportNode writes for a graph node, independent of its JSON form.
+ * Fields that don't apply to the node's type are left empty.
+ */
+struct FBlueprintNodeInfo
+{
+	FString NodeType;
+	FString FunctionName;
+	FString TargetClass;
+	FString EventName;
+	FString VariableName;
+	FString TargetType;
+	FString MacroName;
+
+	/** Path of the macro graph, matching macro_id in the macro library export */
+	FString MacroId;
+};
+
+FBlueprintNodeInfo DescribeBlueprintNode(const UEdGraphNode* Node);
+
+/** NodeType DescribeBlueprintNode reports for macro instances */
+static const TCHAR* const MACRO_NODE_TYPE = TEXT("Macro");
+
+/** The pins ExportNode writes for a node (visible ones, in pin order). Pin ids index this list. */
+void GetExportPins(const UEdGraphNode* Node, TArray<const UEdGraphPin*>& OutPins);
+
+/** Events, function entries and anything else that starts execution without being called from an exec pin */
+bool IsGraphEntryNode(const UEdGraphNode* Node);
+
+/**
+ * Collects every node that can run or be evaluated from Root: follows exec outputs forward
+ * from nodes reached through exec, and data inputs backward from every reached node.
+ * Disabled nodes are treated as removed, the same way the Kismet compiler does.
+ */
+void CollectReachableNodes(const UEdGraphNode* Root, TSet<const UEdGraphNode*>& OutReachable);
+
+/**
+ * One page of an array, set or map property for /export-property: on the Blueprint's class defaults
+ * ("Items") or on one of its construction script components ("Mesh.OverrideMaterials"). Elements
+ * [Offset, Offset + Limit) are returned (Limit 0 = the rest). Null with OutError set when the
+ * Blueprint, component or property isn't found or isn't a container. Game thread only.
+ */
+TSharedPtr<FJsonObject> ExportContainerPropertyPage(const FString& BlueprintPath, const FString& PropertyName, int32 Offset, int32 Limit, bool bTypedValues, FString& OutError);
+
+/**
+ * While one is alive, JSON exports run on the same thread serialize into Json (UTF-8) instead of
+ * writing their output path, so a caller that wants the bytes (to gzip or hand to a client) skips
+ * writing and reading back a file. Streamed exports (DataTable rows) still write their file.
+ */
+struct FScopedJsonExportCapture
+{
+	FScopedJsonExportCapture();
+	~FScopedJsonExportCapture();
+
+	TArray<uint8> Json;
+	bool bCaptured = false;
+
+private:
+	FScopedJsonExportCapture* Previous;
+};
@@ -0,0 +1,307 @@
+#include "BlueprintExporterValues.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/TextProperty.h"
+#include "UObject/EnumProperty.h"
+#include "Misc/OutputDeviceNull.h"
+#include "Misc/DefaultValueHelper.h"
+
+// Integers beyond this lose precision as JSON doubles and are written as strings instead
+static const int64 MAX_EXACT_JSON_INTEGER = 1LL << 53;
+
+static TSharedPtr<FJsonValue> MakeStringValue(const FString& Value)
+{
+	return MakeShareable(new FJsonValueString(Value));
+}
+
+static TSharedPtr<FJsonValue> MakeObjectPathValue(const UObject* Object)
+{
+	if (!Object)
+		return MakeShareable(new FJsonValueNull());
+	return MakeStringValue(Object->GetPathName());
+}
+
+static TSharedPtr<FJsonValue> MakeIntegerValue(int64 Value)
+{
+	if (Value > MAX_EXACT_JSON_INTEGER || Value < -MAX_EXACT_JSON_INTEGER)
+		return MakeStringValue(LexToString(Value));
+	return MakeShareable(new FJsonValueNumber(static_cast<double>(Value)));
+}
+
+static TSharedPtr<FJsonValue> MakeFloatValue(double Value)
+{
+	if (!FMath::IsFinite(Value))
+		return MakeStringValue(LexToString(Value));
+	return MakeShareable(new FJsonValueNumber(Value));
+}
+
+static TSharedPtr<FJsonValue> MakeEnumValue(const UEnum* Enum, int64 Value)
+{
+	if (!Enum)
+		return MakeIntegerValue(Value);
+
+	const FString Name = Enum->GetNameStringByValue(Value);
+	return Name.IsEmpty() ? MakeIntegerValue(Value) : MakeStringValue(Name);
+}
+
+TSharedPtr<FJsonValue> PropertyValueToJson(const FProperty* Property, const void* ValuePtr)
+{
+	if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+		return MakeShareable(new FJsonValueBoolean(BoolProp->GetPropertyValue(ValuePtr)));
+
+	if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+		return MakeEnumValue(EnumProp->GetEnum(), EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+
+	if (const FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProp->GetIntPropertyEnum())
+			return MakeEnumValue(Enum, NumericProp->GetSignedIntPropertyValue(ValuePtr));
+		if (NumericProp->IsFloatingPoint())
+			return MakeFloatValue(NumericProp->GetFloatingPointPropertyValue(ValuePtr));
+
+		// uint64 above INT64_MAX would wrap through the signed getter
+		if (CastField<FUInt64Property>(Property))
+		{
+			const uint64 Value = NumericProp->GetUnsignedIntPropertyValue(ValuePtr);
+			return Value > static_cast<uint64>(MAX_EXACT_JSON_INTEGER) ? MakeStringValue(LexToString(Value)) : MakeIntegerValue(static_cast<int64>(Value));
+		}
+		return MakeIntegerValue(NumericProp->GetSignedIntPropertyValue(ValuePtr));
+	}
+
+	if (const FStrProperty* StrProp = CastField<FStrProperty>(Property))
+		return MakeStringValue(StrProp->GetPropertyValue(ValuePtr));
+
+	if (const FNameProperty* NameProp = CastField<FNameProperty>(Property))
+		return MakeStringValue(NameProp->GetPropertyValue(ValuePtr).ToString());
+
+	if (const FTextProperty* TextProp = CastField<FTextProperty>(Property))
+		return MakeStringValue(TextProp->GetPropertyValue(ValuePtr).ToString());
+
+	// Soft references are checked first: they are object properties too, but must not be resolved
+	if (const FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Property))
+	{
+		const FSoftObjectPath& Path = SoftProp->GetPropertyValue(ValuePtr).ToSoftObjectPath();
+		return Path.IsNull() ? MakeShareable(new FJsonValueNull()) : MakeStringValue(Path.ToString());
+	}
+
+	if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Property))
+		return MakeObjectPathValue(ObjectProp->GetObjectPropertyValue(ValuePtr));
+
+	if (const FInterfaceProperty* InterfaceProp = CastField<FInterfaceProperty>(Property))
+		return MakeObjectPathValue(InterfaceProp->GetPropertyValue(ValuePtr).GetObject());
+
+	if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		return MakeShareable(new FJsonValueObject(StructToJson(StructProp->Struct, ValuePtr)));
+
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		Elements.Reserve(Helper.Num());
+		for (int32 Index = 0; Index < Helper.Num(); Index++)
+			Elements.Add(PropertyValueToJson(ArrayProp->Inner, Helper.GetRawPtr(Index)));
+		return MakeShareable(new FJsonValueArray(Elements));
+	}
+
+	if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProp, ValuePtr);
+
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+		{
+			if (Helper.IsValidIndex(Index))
+				Elements.Add(PropertyValueToJson(SetProp->ElementProp, Helper.GetElementPtr(Index)));
+		}
+		return MakeShareable(new FJsonValueArray(Elements));
+	}
+
+	if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Helper(MapProp, ValuePtr);
+
+		TArray<TSharedPtr<FJsonValue>> Pairs;
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+		{
+			if (!Helper.IsValidIndex(Index))
+				continue;
+
+			TSharedPtr<FJsonObject> PairObj = MakeShareable(new FJsonObject());
+			PairObj->SetField(TEXT("key"), PropertyValueToJson(MapProp->KeyProp, Helper.GetKeyPtr(Index)));
+			PairObj->SetField(TEXT("value"), PropertyValueToJson(MapProp->ValueProp, Helper.GetValuePtr(Index)));
+			Pairs.Add(MakeShareable(new FJsonValueObject(PairObj)));
+		}
+		return MakeShareable(new FJsonValueArray(Pairs));
+	}
+
+	FString ValueStr;
+	Property->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, nullptr, PPF_None);
+	return MakeStringValue(ValueStr);
+}
+
+TSharedPtr<FJsonValue> PropertyToJson_InContainer(const FProperty* Property, const void* Container)
+{
+	if (Property->ArrayDim == 1)
+		return PropertyValueToJson(Property, Property->ContainerPtrToValuePtr<void>(Container));
+
+	TArray<TSharedPtr<FJsonValue>> Elements;
+	for (int32 Index = 0; Index < Property->ArrayDim; Index++)
+		Elements.Add(PropertyValueToJson(Property, Property->ContainerPtrToValuePtr<void>(Container, Index)));
+	return MakeShareable(new FJsonValueArray(Elements));
+}
+
+TSharedPtr<FJsonObject> StructToJson(const UStruct* Struct, const void* StructData)
+{
+	TSharedPtr<FJsonObject> StructObj = MakeShareable(new FJsonObject());
+
+	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+	{
+		// GetAuthoredName strips the _N_GUID suffix UserDefinedStruct fields carry
+		StructObj->SetField(PropIt->GetAuthoredName(), PropertyToJson_InContainer(*PropIt, StructData));
+	}
+
+	return StructObj;
+}
+
+int32 GetContainerNum(const FProperty* Property, const void* ValuePtr)
+{
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		return FScriptArrayHelper(ArrayProp, ValuePtr).Num();
+	if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+		return FScriptSetHelper(SetProp, ValuePtr).Num();
+	if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+		return FScriptMapHelper(MapProp, ValuePtr).Num();
+	return INDEX_NONE;
+}
+
+/** One element as the container's own ExportText writes it: delimited, so strings stay quoted */
+static FString ExportElementText(const FProperty* Property, const void* ValuePtr)
+{
+	FString Text;
+	Property->ExportTextItem_Direct(Text, ValuePtr, nullptr, nullptr, PPF_Delimited);
+	return Text;
+}
+
+void ContainerElementsToJson(const FProperty* Property, const void* ValuePtr, int32 Offset, int32 Count, TArray<FString>& OutText, TArray<TSharedPtr<FJsonValue>>* OutTyped)
+{
+	const int32 End = Offset + Count;
+
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+		for (int32 Index = FMath::Max(Offset, 0); Index < FMath::Min(End, Helper.Num()); Index++)
+		{
+			OutText.Add(ExportElementText(ArrayProp->Inner, Helper.GetRawPtr(Index)));
+			if (OutTyped)
+				OutTyped->Add(PropertyValueToJson(ArrayProp->Inner, Helper.GetRawPtr(Index)));
+		}
+		return;
+	}
+
+	// Sets and maps are sparse; Element counts only the live entries
+	if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProp, ValuePtr);
+		for (int32 Index = 0, Element = 0; Index < Helper.GetMaxIndex() && Element < End; Index++)
+		{
+			if (!Helper.IsValidIndex(Index) || Element++ < Offset)
+				continue;
+
+			OutText.Add(ExportElementText(SetProp->ElementProp, Helper.GetElementPtr(Index)));
+			if (OutTyped)
+				OutTyped->Add(PropertyValueToJson(SetProp->ElementProp, Helper.GetElementPtr(Index)));
+		}
+		return;
+	}
+
+	if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Helper(MapProp, ValuePtr);
+		for (int32 Index = 0, Element = 0; Index < Helper.GetMaxIndex() && Element < End; Index++)
+		{
+			if (!Helper.IsValidIndex(Index) || Element++ < Offset)
+				continue;
+
+			OutText.Add(FString::Printf(TEXT("(%s, %s)"),
+				*ExportElementText(MapProp->KeyProp, Helper.GetKeyPtr(Index)),
+				*ExportElementText(MapProp->ValueProp, Helper.GetValuePtr(Index))));
+			if (OutTyped)
+			{
+				TSharedPtr<FJsonObject> PairObj = MakeShareable(new FJsonObject());
+				PairObj->SetField(TEXT("key"), PropertyValueToJson(MapProp->KeyProp, Helper.GetKeyPtr(Index)));
+				PairObj->SetField(TEXT("value"), PropertyValueToJson(MapProp->ValueProp, Helper.GetValuePtr(Index)));
+				OutTyped->Add(MakeShareable(new FJsonValueObject(PairObj)));
+			}
+		}
+	}
+}
+
+TSharedPtr<FJsonValue> PinDefaultToJson(const UEdGraphPin* Pin)
+{
+	const FEdGraphPinType& PinType = Pin->PinType;
+	const FName Category = PinType.PinCategory;
+
+	if (Pin->DefaultObject)
+		return MakeObjectPathValue(Pin->DefaultObject);
+
+	if (Category == UEdGraphSchema_K2::PC_Text)
+		return Pin->DefaultTextValue.IsEmpty() ? nullptr : MakeStringValue(Pin->DefaultTextValue.ToString());
+
+	if (Pin->DefaultValue.IsEmpty() || PinType.IsContainer())
+		return nullptr;
+
+	const FString& Value = Pin->DefaultValue;
+
+	if (Category == UEdGraphSchema_K2::PC_Boolean)
+		return MakeShareable(new FJsonValueBoolean(Value.ToBool()));
+
+	if (Category == UEdGraphSchema_K2::PC_Int || Category == UEdGraphSchema_K2::PC_Int64)
+		return MakeIntegerValue(FCString::Atoi64(*Value));
+
+	if (Category == UEdGraphSchema_K2::PC_Real)
+		return MakeFloatValue(FCString::Atod(*Value));
+
+	if (Category == UEdGraphSchema_K2::PC_Byte && !PinType.PinSubCategoryObject.IsValid())
+		return MakeIntegerValue(FCString::Atoi64(*Value));
+
+	if (Category == UEdGraphSchema_K2::PC_Struct)
+	{
+		UScriptStruct* Struct = Cast<UScriptStruct>(PinType.PinSubCategoryObject.Get());
+		if (!Struct)
+			return MakeStringValue(Value);
+
+		// K2 keeps these as bare "X,Y,Z", "P,Y,R" and "T|R|S" lists, which ImportText doesn't accept
+		if (Struct == TBaseStructure<FVector>::Get())
+		{
+			FVector Vector;
+			if (FDefaultValueHelper::ParseVector(Value, Vector))
+				return MakeShareable(new FJsonValueObject(StructToJson(Struct, &Vector)));
+		}
+		else if (Struct == TBaseStructure<FRotator>::Get())
+		{
+			FRotator Rotator;
+			if (FDefaultValueHelper::ParseRotator(Value, Rotator))
+				return MakeShareable(new FJsonValueObject(StructToJson(Struct, &Rotator)));
+		}
+		else if (Struct == TBaseStructure<FTransform>::Get())
+		{
+			FTransform Transform;
+			if (Transform.InitFromString(Value))
+				return MakeShareable(new FJsonValueObject(StructToJson(Struct, &Transform)));
+		}
+
+		FStructOnScope TempStruct(Struct);
+		FOutputDeviceNull ImportErrors;
+		if (!Struct->ImportText(*Value, TempStruct.GetStructMemory(), nullptr, PPF_None, &ImportErrors, Struct->GetName()))
+			return MakeStringValue(Value);
+
+		return MakeShareable(new FJsonValueObject(StructToJson(Struct, TempStruct.GetStructMemory())));
+	}
+
+	// Enum pins already hold the enumerator name; names, strings and the rest are plain text
+	return MakeStringValue(Value);
+}
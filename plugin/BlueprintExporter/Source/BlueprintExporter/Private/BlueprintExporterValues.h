@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonValue;
+class FJsonObject;
+class UEdGraphPin;
+
+/**
+ * Typed JSON for property values, written by walking the FProperty tree instead of formatting
+ * ExportText and parsing it back:
+ *
+ *   bool, integers, floats     JSON booleans and numbers (non-finite floats as strings)
+ *   enums                      enumerator name
+ *   strings, names, text       JSON strings
+ *   object/class/soft refs     object path string, or null
+ *   structs                    object keyed by field name (authored names for UserDefinedStructs)
+ *   arrays, sets               JSON arrays
+ *   maps                       array of { "key": ..., "value": ... } (keys need not be strings)
+ *
+ * Anything else (delegates, field paths) falls back to its ExportText string.
+ */
+TSharedPtr<FJsonValue> PropertyValueToJson(const FProperty* Property, const void* ValuePtr);
+
+/** The whole property inside Container; a JSON array when it is a fixed-size C array */
+TSharedPtr<FJsonValue> PropertyToJson_InContainer(const FProperty* Property, const void* Container);
+
+TSharedPtr<FJsonObject> StructToJson(const UStruct* Struct, const void* StructData);
+
+/** Number of elements in an array, set or map value; INDEX_NONE for any other property */
+int32 GetContainerNum(const FProperty* Property, const void* ValuePtr);
+
+/**
+ * Elements [Offset, Offset + Count) of an array, set or map value in iteration order, so large
+ * containers can be written a page at a time. OutText gets each element as it appears inside the
+ * container's ExportText (map pairs as "(Key, Value)"); OutTyped, when given, gets the elements the
+ * way PropertyValueToJson writes them.
+ */
+void ContainerElementsToJson(const FProperty* Property, const void* ValuePtr, int32 Offset, int32 Count, TArray<FString>& OutText, TArray<TSharedPtr<FJsonValue>>* OutTyped);
+
+/**
+ * A pin's default parsed according to its type; struct defaults are imported into a temporary
+ * instance of the struct and walked like any other value. Null when the pin has no default.
+ */
+TSharedPtr<FJsonValue> PinDefaultToJson(const UEdGraphPin* Pin);
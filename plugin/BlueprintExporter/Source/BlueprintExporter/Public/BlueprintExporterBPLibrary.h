@@ -4,6 +4,72 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "BlueprintExporterBPLibrary.generated.h"
 
+UENUM(BlueprintType)
+enum class EBlueprintExportLevel : uint8
+{
+	/** Everything: defaults, variables, components and every graph node */
+	Full,
+
+	/** Variables, components, interfaces, dispatchers and function signatures; no graph nodes */
+	Signature
+};
+
+UENUM(BlueprintType)
+enum class EDataTableExportFormat : uint8
+{
+	/** A header line with the row struct's fields, then one JSON object per row */
+	NDJson,
+
+	/** A header row of column names, then one row per table row in DataTable CSV import format */
+	Csv
+};
+
+/** Optional transformations applied while exporting a blueprint's graphs */
+USTRUCT(BlueprintType)
+struct BLUEPRINTEXPORTER_API FBlueprintExportOptions
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	EBlueprintExportLevel Level = EBlueprintExportLevel::Full;
+
+	/** Only export nodes reachable from an event, custom event or function entry through exec and data links */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bPrune = false;
+
+	/** Only list graphs, variables and components with sizes and hashes; no nodes are exported */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bManifest = false;
+
+	/** Export just this event, function or macro graph (empty = everything) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	FString GraphName;
+
+	/** Give nodes and pins integer ids and add each graph's edge list with CSR in/out offsets */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bAdjacency = false;
+
+	/** Also write defaults as typed JSON (numbers, bools, objects, arrays, object paths) in typed_* fields */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bTypedValues = false;
+
+	/** Annotate graphs with pure expressions that are computed more than once, with a suggested temp for each */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bCommonSubexpressions = false;
+
+	/** List each called function's signature once in called_functions; call nodes refer to it by function_index instead of carrying target_class */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bFunctionTable = false;
+
+	/** Order graphs, nodes, connections, variables and components by stable keys so an unchanged asset exports byte-identical JSON */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bCanonical = false;
+
+	/** Cut array, set and map values in class defaults, variables and components to this many elements (0 = no limit); the rest pages through /export-property */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blueprint Exporter")
+	int32 MaxContainerElements = 0;
+};
+
 UCLASS()
 class BLUEPRINTEXPORTER_API UBlueprintExporterBPLibrary : public UBlueprintFunctionLibrary
 {
@@ -21,16 +87,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
 	static bool ExportBlueprintToJson(const FString& BlueprintPath, const FString& OutputPath = TEXT(""));
 
+	/**
+	 * Same as ExportBlueprintToJson, with control over how graphs are exported.
+	 *
+	 * @param BlueprintPath - Asset path like "/Game/Core/Inventory/BP_InventoryVisual"
+	 * @param Options - Graph export options (see FBlueprintExportOptions)
+	 * @param OutputPath - Where to save the JSON file (empty = %TEMP%/blueprint_graph.json)
+	 * @return true if export was successful
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static bool ExportBlueprintToJsonWithOptions(const FString& BlueprintPath, const FBlueprintExportOptions& Options, const FString& OutputPath = TEXT(""));
+
 	/**
 	 * Export a UserDefinedStruct's field definitions to a JSON file.
 	 * Includes field names, types, and default values.
 	 *
 	 * @param StructPath - Asset path like "/Game/Data/Structs/MyStruct"
 	 * @param OutputPath - Where to save the JSON file (empty = %TEMP%/struct.json)
+	 * @param bTypedValues - Also write each field's default as typed JSON in typed_default_value
 	 * @return true if export was successful
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
-	static bool ExportStructToJson(const FString& StructPath, const FString& OutputPath = TEXT(""));
+	static bool ExportStructToJson(const FString& StructPath, const FString& OutputPath = TEXT(""), bool bTypedValues = false);
 
 	/**
 	 * Export a UserDefinedEnum's values to a JSON file.
@@ -42,4 +120,57 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
 	static bool ExportEnumToJson(const FString& EnumPath, const FString& OutputPath = TEXT(""));
+
+	/**
+	 * Export a DataTable's rows, or a DataAsset as a single row, streaming them to the file in
+	 * chunks so output memory stays bounded however large the table is.
+	 *
+	 * @param AssetPath - Asset path like "/Game/Data/DT_Items"
+	 * @param OutputPath - Where to save the file (empty = %TEMP%/<name>_rows.ndjson or .csv)
+	 * @param Format - NDJSON with typed values, or CSV with the same cell text DataTable CSV export uses
+	 * @param FirstRow - Index of the first row to write
+	 * @param MaxRows - Number of rows to write (0 or less = all remaining rows)
+	 * @param OutNumRows - Number of rows written
+	 * @param OutTotalRows - Number of rows in the table
+	 * @return true if export was successful
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static bool ExportDataTableRows(const FString& AssetPath, const FString& OutputPath, EDataTableExportFormat Format, int32 FirstRow, int32 MaxRows, int32& OutNumRows, int32& OutTotalRows);
+
+	/**
+	 * Export the compiled Kismet bytecode of every function in a blueprint's generated class.
+	 * Reflects the last compile, so the blueprint's compile status is included alongside it.
+	 *
+	 * @param BlueprintPath - Asset path like "/Game/Blueprints/BP_MyActor"
+	 * @param OutputPath - Where to save the JSON file (empty = %TEMP%/<name>_bytecode.json)
+	 * @return true if export was successful
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static bool ExportBlueprintBytecodeToJson(const FString& BlueprintPath, const FString& OutputPath = TEXT(""));
+
+	/**
+	 * Export every UserDefinedStruct and UserDefinedEnum under /Game/ into a single catalogue file.
+	 * Entries from the previous catalogue are reused when their package hasn't changed on disk,
+	 * so only modified types are loaded and rebuilt.
+	 *
+	 * @param OutputPath - Where to save the catalogue (empty = %TEMP%/type_catalogue.json)
+	 * @param bForceRebuild - Ignore the previous catalogue and rebuild every entry
+	 * @param OutNumTypes - Number of types in the catalogue
+	 * @param OutNumRebuilt - Number of types that had to be (re)exported
+	 * @return true if the catalogue is up to date on disk
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static bool ExportTypeCatalogueToJson(const FString& OutputPath, bool bForceRebuild, int32& OutNumTypes, int32& OutNumRebuilt);
+
+	/**
+	 * Export every macro in the engine StandardMacros library and the project's macro libraries
+	 * to a single JSON file. Each macro has its graph plus the tunnel entry/exit pins that
+	 * macro instance pins map to; instances in blueprint exports reference it by macro_id.
+	 *
+	 * @param OutputPath - Where to save the JSON file (empty = %TEMP%/macro_library.json)
+	 * @param OutNumMacros - Number of macros exported
+	 * @return true if export was successful
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static bool ExportMacroLibraryToJson(const FString& OutputPath, int32& OutNumMacros);
 };
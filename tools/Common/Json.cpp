@@ -0,0 +1,466 @@
+#include "Json.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+namespace BlueprintTools
+{
+
+static const FJsonNode EmptyArrayNode = []()
+{
+	FJsonNode Node;
+	Node.Type = EJsonType::Array;
+	return Node;
+}();
+
+const FJsonNode* FJsonNode::Find(std::string_view Key) const
+{
+	if (Type != EJsonType::Object)
+		return nullptr;
+
+	for (uint32_t i = 0; i < Count; i++)
+	{
+		if (Keys[i] == Key)
+			return &Children[i];
+	}
+	return nullptr;
+}
+
+std::string_view FJsonNode::GetString(std::string_view Key, std::string_view Default) const
+{
+	const FJsonNode* Node = Find(Key);
+	return (Node && Node->Type == EJsonType::String) ? Node->String : Default;
+}
+
+double FJsonNode::GetNumber(std::string_view Key, double Default) const
+{
+	const FJsonNode* Node = Find(Key);
+	return (Node && Node->Type == EJsonType::Number) ? Node->Number : Default;
+}
+
+bool FJsonNode::GetBool(std::string_view Key, bool Default) const
+{
+	const FJsonNode* Node = Find(Key);
+	return (Node && Node->Type == EJsonType::Bool) ? Node->bBool : Default;
+}
+
+const FJsonNode& FJsonNode::GetArray(std::string_view Key) const
+{
+	const FJsonNode* Node = Find(Key);
+	return (Node && Node->Type == EJsonType::Array) ? *Node : EmptyArrayNode;
+}
+
+bool ReadFileToString(const std::string& Path, std::string& Out)
+{
+	FILE* File = std::fopen(Path.c_str(), "rb");
+	if (!File)
+		return false;
+
+	std::fseek(File, 0, SEEK_END);
+	long Size = std::ftell(File);
+	std::fseek(File, 0, SEEK_SET);
+
+	if (Size < 0)
+	{
+		std::fclose(File);
+		return false;
+	}
+
+	Out.resize(static_cast<size_t>(Size));
+	size_t Read = Size > 0 ? std::fread(&Out[0], 1, static_cast<size_t>(Size), File) : 0;
+	std::fclose(File);
+	return Read == static_cast<size_t>(Size);
+}
+
+bool WriteStringToFile(const std::string& Path, std::string_view Contents)
+{
+	FILE* File = std::fopen(Path.c_str(), "wb");
+	if (!File)
+		return false;
+
+	size_t Written = std::fwrite(Contents.data(), 1, Contents.size(), File);
+	bool bClosed = std::fclose(File) == 0;
+	return bClosed && Written == Contents.size();
+}
+
+void AppendJsonString(std::string& Out, std::string_view Value)
+{
+	Out += '"';
+	for (char C : Value)
+	{
+		switch (C)
+		{
+		case '"': Out += "\\\""; break;
+		case '\\': Out += "\\\\"; break;
+		case '\n': Out += "\\n"; break;
+		case '\r': Out += "\\r"; break;
+		case '\t': Out += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(C) < 0x20)
+			{
+				char Escaped[8];
+				std::snprintf(Escaped, sizeof(Escaped), "\\u%04x", C);
+				Out += Escaped;
+			}
+			else
+			{
+				Out += C;
+			}
+		}
+	}
+	Out += '"';
+}
+
+static bool ParseHex4(const char* Src, uint32_t& Out)
+{
+	Out = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		char C = Src[i];
+		Out <<= 4;
+		if (C >= '0' && C <= '9') Out |= C - '0';
+		else if (C >= 'a' && C <= 'f') Out |= C - 'a' + 10;
+		else if (C >= 'A' && C <= 'F') Out |= C - 'A' + 10;
+		else return false;
+	}
+	return true;
+}
+
+static char* EncodeUtf8(char* Dest, uint32_t CodePoint)
+{
+	if (CodePoint < 0x80)
+	{
+		*Dest++ = static_cast<char>(CodePoint);
+	}
+	else if (CodePoint < 0x800)
+	{
+		*Dest++ = static_cast<char>(0xC0 | (CodePoint >> 6));
+		*Dest++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+	}
+	else if (CodePoint < 0x10000)
+	{
+		*Dest++ = static_cast<char>(0xE0 | (CodePoint >> 12));
+		*Dest++ = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+		*Dest++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+	}
+	else
+	{
+		*Dest++ = static_cast<char>(0xF0 | (CodePoint >> 18));
+		*Dest++ = static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F));
+		*Dest++ = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+		*Dest++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+	}
+	return Dest;
+}
+
+bool FJsonDocument::ParseFile(const std::string& Path)
+{
+	std::string Text;
+	if (!ReadFileToString(Path, Text))
+	{
+		Error = "could not read " + Path;
+		return false;
+	}
+	return Parse(std::move(Text));
+}
+
+bool FJsonDocument::Parse(std::string Text)
+{
+	// FFileHelper::SaveStringToFile falls back to UTF-16LE with a BOM when an export has non-ANSI text
+	if (Text.size() >= 2 && static_cast<unsigned char>(Text[0]) == 0xFF && static_cast<unsigned char>(Text[1]) == 0xFE)
+	{
+		std::string Utf8;
+		Utf8.reserve(Text.size() / 2);
+		char Encoded[4];
+		for (size_t i = 2; i + 1 < Text.size(); i += 2)
+		{
+			uint32_t CodePoint = static_cast<unsigned char>(Text[i]) | (static_cast<unsigned char>(Text[i + 1]) << 8);
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && i + 3 < Text.size())
+			{
+				uint32_t Low = static_cast<unsigned char>(Text[i + 2]) | (static_cast<unsigned char>(Text[i + 3]) << 8);
+				if (Low >= 0xDC00 && Low <= 0xDFFF)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+					i += 2;
+				}
+			}
+			Utf8.append(Encoded, EncodeUtf8(Encoded, CodePoint) - Encoded);
+		}
+		Text = std::move(Utf8);
+	}
+
+	Buffer = std::move(Text);
+	Cursor = Buffer.data();
+	End = Cursor + Buffer.size();
+	NodeBlocks.clear();
+	KeyBlocks.clear();
+	Error.clear();
+	RootNode = FJsonNode();
+
+	// Skip a UTF-8 BOM
+	if (End - Cursor >= 3 && static_cast<unsigned char>(Cursor[0]) == 0xEF &&
+		static_cast<unsigned char>(Cursor[1]) == 0xBB && static_cast<unsigned char>(Cursor[2]) == 0xBF)
+	{
+		Cursor += 3;
+	}
+
+	if (!ParseValue(RootNode))
+		return false;
+
+	SkipWhitespace();
+	if (Cursor != End)
+		return Fail("trailing characters after root value");
+
+	return true;
+}
+
+bool FJsonDocument::Fail(const char* Message)
+{
+	if (Error.empty())
+	{
+		Error = Message;
+		Error += " at offset " + std::to_string(Cursor - Buffer.data());
+	}
+	return false;
+}
+
+void FJsonDocument::SkipWhitespace()
+{
+	while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t'))
+		Cursor++;
+}
+
+template <typename T>
+T* FJsonDocument::Allocate(uint32_t Num)
+{
+	std::unique_ptr<T[]> Block(new T[Num]);
+	T* Result = Block.get();
+	if constexpr (std::is_same_v<T, FJsonNode>)
+		NodeBlocks.push_back(std::move(Block));
+	else
+		KeyBlocks.push_back(std::move(Block));
+	return Result;
+}
+
+bool FJsonDocument::ParseValue(FJsonNode& Out)
+{
+	SkipWhitespace();
+	if (Cursor >= End)
+		return Fail("unexpected end of input");
+
+	switch (*Cursor)
+	{
+	case '{':
+		return ParseContainer(Out, true);
+	case '[':
+		return ParseContainer(Out, false);
+	case '"':
+		Out.Type = EJsonType::String;
+		return ParseString(Out.String);
+	case 't':
+		if (End - Cursor >= 4 && std::memcmp(Cursor, "true", 4) == 0)
+		{
+			Out.Type = EJsonType::Bool;
+			Out.bBool = true;
+			Cursor += 4;
+			return true;
+		}
+		return Fail("invalid literal");
+	case 'f':
+		if (End - Cursor >= 5 && std::memcmp(Cursor, "false", 5) == 0)
+		{
+			Out.Type = EJsonType::Bool;
+			Out.bBool = false;
+			Cursor += 5;
+			return true;
+		}
+		return Fail("invalid literal");
+	case 'n':
+		if (End - Cursor >= 4 && std::memcmp(Cursor, "null", 4) == 0)
+		{
+			Out.Type = EJsonType::Null;
+			Cursor += 4;
+			return true;
+		}
+		return Fail("invalid literal");
+	default:
+		return ParseNumber(Out);
+	}
+}
+
+bool FJsonDocument::ParseString(std::string_view& Out)
+{
+	// Skip opening quote
+	Cursor++;
+	char* Start = Cursor;
+
+	// Fast path: scan for the closing quote; most strings in exports have no escapes
+	while (Cursor < End && *Cursor != '"' && *Cursor != '\\')
+		Cursor++;
+
+	if (Cursor < End && *Cursor == '"')
+	{
+		Out = std::string_view(Start, Cursor - Start);
+		Cursor++;
+		return true;
+	}
+
+	// Slow path: unescape in place, the decoded form is never longer than the source
+	char* Dest = Cursor;
+	while (Cursor < End)
+	{
+		char C = *Cursor++;
+		if (C == '"')
+		{
+			Out = std::string_view(Start, Dest - Start);
+			return true;
+		}
+
+		if (C != '\\')
+		{
+			*Dest++ = C;
+			continue;
+		}
+
+		if (Cursor >= End)
+			break;
+
+		char Escape = *Cursor++;
+		switch (Escape)
+		{
+		case '"': *Dest++ = '"'; break;
+		case '\\': *Dest++ = '\\'; break;
+		case '/': *Dest++ = '/'; break;
+		case 'b': *Dest++ = '\b'; break;
+		case 'f': *Dest++ = '\f'; break;
+		case 'n': *Dest++ = '\n'; break;
+		case 'r': *Dest++ = '\r'; break;
+		case 't': *Dest++ = '\t'; break;
+		case 'u':
+		{
+			uint32_t CodePoint;
+			if (End - Cursor < 4 || !ParseHex4(Cursor, CodePoint))
+				return Fail("invalid unicode escape");
+			Cursor += 4;
+
+			// Combine UTF-16 surrogate pairs
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && End - Cursor >= 6 && Cursor[0] == '\\' && Cursor[1] == 'u')
+			{
+				uint32_t Low;
+				if (ParseHex4(Cursor + 2, Low) && Low >= 0xDC00 && Low <= 0xDFFF)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+					Cursor += 6;
+				}
+			}
+			Dest = EncodeUtf8(Dest, CodePoint);
+			break;
+		}
+		default:
+			return Fail("invalid escape sequence");
+		}
+	}
+
+	return Fail("unterminated string");
+}
+
+bool FJsonDocument::ParseNumber(FJsonNode& Out)
+{
+	char* Start = Cursor;
+	if (Cursor < End && *Cursor == '-')
+		Cursor++;
+	while (Cursor < End && ((*Cursor >= '0' && *Cursor <= '9') || *Cursor == '.' || *Cursor == 'e' || *Cursor == 'E' || *Cursor == '+' || *Cursor == '-'))
+		Cursor++;
+
+	if (Cursor == Start)
+		return Fail("unexpected character");
+
+	std::from_chars_result Result = std::from_chars(Start, Cursor, Out.Number);
+	if (Result.ec != std::errc() || Result.ptr != Cursor)
+		return Fail("invalid number");
+
+	Out.Type = EJsonType::Number;
+	return true;
+}
+
+bool FJsonDocument::ParseContainer(FJsonNode& Out, bool bObject)
+{
+	// Skip opening bracket
+	Cursor++;
+
+	const size_t NodeBase = NodeStack.size();
+	const size_t KeyBase = KeyStack.size();
+	const char Close = bObject ? '}' : ']';
+
+	SkipWhitespace();
+	if (Cursor < End && *Cursor == Close)
+	{
+		Cursor++;
+	}
+	else
+	{
+		for (;;)
+		{
+			if (bObject)
+			{
+				SkipWhitespace();
+				if (Cursor >= End || *Cursor != '"')
+					return Fail("expected object key");
+
+				std::string_view Key;
+				if (!ParseString(Key))
+					return false;
+				KeyStack.push_back(Key);
+
+				SkipWhitespace();
+				if (Cursor >= End || *Cursor != ':')
+					return Fail("expected ':'");
+				Cursor++;
+			}
+
+			FJsonNode Child;
+			if (!ParseValue(Child))
+				return false;
+			NodeStack.push_back(Child);
+
+			SkipWhitespace();
+			if (Cursor < End && *Cursor == ',')
+			{
+				Cursor++;
+				continue;
+			}
+			if (Cursor < End && *Cursor == Close)
+			{
+				Cursor++;
+				break;
+			}
+			return Fail(bObject ? "expected ',' or '}'" : "expected ',' or ']'");
+		}
+	}
+
+	Out.Type = bObject ? EJsonType::Object : EJsonType::Array;
+	Out.Count = static_cast<uint32_t>(NodeStack.size() - NodeBase);
+
+	if (Out.Count > 0)
+	{
+		FJsonNode* Children = Allocate<FJsonNode>(Out.Count);
+		std::copy(NodeStack.begin() + NodeBase, NodeStack.end(), Children);
+		Out.Children = Children;
+
+		if (bObject)
+		{
+			std::string_view* Keys = Allocate<std::string_view>(Out.Count);
+			std::copy(KeyStack.begin() + KeyBase, KeyStack.end(), Keys);
+			Out.Keys = Keys;
+		}
+	}
+
+	NodeStack.resize(NodeBase);
+	KeyStack.resize(KeyBase);
+	return true;
+}
+
+} // namespace BlueprintTools
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BlueprintTools
+{
+
+enum class EJsonType : uint8_t
+{
+	Null,
+	Bool,
+	Number,
+	String,
+	Array,
+	Object
+};
+
+/**
+ * Read-only JSON value. Strings point into the owning FJsonDocument's buffer,
+ * array/object children are stored contiguously in the document's arena.
+ */
+struct FJsonNode
+{
+	EJsonType Type = EJsonType::Null;
+	bool bBool = false;
+	double Number = 0.0;
+	std::string_view String;
+
+	const FJsonNode* Children = nullptr;
+	const std::string_view* Keys = nullptr;
+	uint32_t Count = 0;
+
+	bool IsNull() const { return Type == EJsonType::Null; }
+	bool IsArray() const { return Type == EJsonType::Array; }
+	bool IsObject() const { return Type == EJsonType::Object; }
+
+	const FJsonNode* begin() const { return Children; }
+	const FJsonNode* end() const { return Children + Count; }
+
+	/** Object member lookup, nullptr when missing or when this is not an object. */
+	const FJsonNode* Find(std::string_view Key) const;
+
+	std::string_view GetString(std::string_view Key, std::string_view Default = {}) const;
+	double GetNumber(std::string_view Key, double Default = 0.0) const;
+	bool GetBool(std::string_view Key, bool Default = false) const;
+
+	/** Returns an empty array node when the member is missing, so range-for is always safe. */
+	const FJsonNode& GetArray(std::string_view Key) const;
+};
+
+/**
+ * Single-pass in-situ JSON parser.
+ * The input buffer is owned by the document and strings are unescaped in place,
+ * so parsing does no per-string allocation. Children of every container are
+ * allocated in one block once the container is closed.
+ */
+class FJsonDocument
+{
+public:
+	bool ParseFile(const std::string& Path);
+	bool Parse(std::string Text);
+
+	const FJsonNode& Root() const { return RootNode; }
+	const std::string& GetError() const { return Error; }
+
+private:
+	bool ParseValue(FJsonNode& Out);
+	bool ParseString(std::string_view& Out);
+	bool ParseNumber(FJsonNode& Out);
+	bool ParseContainer(FJsonNode& Out, bool bObject);
+	void SkipWhitespace();
+	bool Fail(const char* Message);
+
+	template <typename T>
+	T* Allocate(uint32_t Num);
+
+	std::string Buffer;
+	char* Cursor = nullptr;
+	char* End = nullptr;
+	FJsonNode RootNode;
+	std::string Error;
+
+	std::vector<std::unique_ptr<FJsonNode[]>> NodeBlocks;
+	std::vector<std::unique_ptr<std::string_view[]>> KeyBlocks;
+
+	// Scratch stacks shared by all nesting levels; each container owns the tail it pushed
+	std::vector<FJsonNode> NodeStack;
+	std::vector<std::string_view> KeyStack;
+};
+
+/** Appends Value to Out as a quoted, escaped JSON string. */
+void AppendJsonString(std::string& Out, std::string_view Value);
+
+bool ReadFileToString(const std::string& Path, std::string& Out);
+bool WriteStringToFile(const std::string& Path, std::string_view Contents);
+
+} // namespace BlueprintTools
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace BlueprintTools
+{
+
+inline unsigned GetDefaultWorkerCount()
+{
+	unsigned Count = std::thread::hardware_concurrency();
+	return Count > 0 ? Count : 4;
+}
+
+/**
+ * Runs Body(Index, WorkerIndex) for every index in [0, Num) on NumWorkers threads.
+ * Workers pull indices from a shared atomic counter, so uneven item costs
+ * (a 5 MB export next to a 2 KB one) still balance across cores.
+ */
+inline void ParallelFor(size_t Num, unsigned NumWorkers, const std::function<void(size_t, unsigned)>& Body)
+{
+	NumWorkers = std::max(1u, std::min<unsigned>(NumWorkers, static_cast<unsigned>(std::max<size_t>(Num, 1))));
+
+	if (NumWorkers == 1)
+	{
+		for (size_t i = 0; i < Num; i++)
+			Body(i, 0);
+		return;
+	}
+
+	std::atomic<size_t> NextIndex{0};
+	std::vector<std::thread> Workers;
+	Workers.reserve(NumWorkers);
+
+	for (unsigned Worker = 0; Worker < NumWorkers; Worker++)
+	{
+		Workers.emplace_back([&, Worker]()
+		{
+			for (size_t i = NextIndex.fetch_add(1); i < Num; i = NextIndex.fetch_add(1))
+				Body(i, Worker);
+		});
+	}
+
+	for (std::thread& Thread : Workers)
+		Thread.join();
+}
+
+} // namespace BlueprintTools
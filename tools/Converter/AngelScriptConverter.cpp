@@ -0,0 +1,1029 @@
+#include "AngelScriptConverter.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace BlueprintTools
+{
+
+// Native parents whose script classes take the A prefix; everything else native is a U class
+static const std::unordered_set<std::string_view> ActorClassNames = {
+	"Actor", "Pawn", "Character", "DefaultPawn", "SpectatorPawn", "WheeledVehiclePawn",
+	"Controller", "PlayerController", "AIController",
+	"GameModeBase", "GameMode", "GameStateBase", "GameState", "PlayerState", "HUD",
+	"Info", "WorldSettings", "LevelScriptActor", "PlayerCameraManager",
+	"Volume", "TriggerBase", "TriggerBox", "TriggerSphere", "TriggerCapsule", "TriggerVolume", "BlockingVolume",
+	"StaticMeshActor", "SkeletalMeshActor", "CameraActor", "Emitter", "Brush",
+	"Light", "PointLight", "SpotLight", "DirectionalLight", "RectLight", "SkyLight",
+	"DecalActor", "NavigationData", "Note", "TargetPoint", "PlayerStart"
+};
+
+// Native structs as named by UScriptStruct::GetName(), i.e. without the F prefix
+static const std::unordered_set<std::string_view> NativeStructNames = {
+	"Vector", "Vector2D", "Vector4", "Vector3f", "Rotator", "Transform", "Quat",
+	"LinearColor", "Color", "IntPoint", "IntVector", "Box", "Box2D", "BoxSphereBounds",
+	"Plane", "Matrix", "HitResult", "Key", "Guid", "DateTime", "Timespan",
+	"SoftObjectPath", "SoftClassPath", "GameplayTag", "GameplayTagContainer",
+	"RandomStream", "Margin", "SlateColor", "SlateBrush", "InputActionValue"
+};
+
+static const std::unordered_map<std::string_view, std::string_view> PrimitiveTypeNames = {
+	{"bool", "bool"},
+	{"int32", "int"},
+	{"int", "int"},
+	{"int64", "int64"},
+	{"uint8", "uint8"},
+	{"float", "float"},
+	{"double", "float"},
+	{"float64", "float64"},
+	{"FString", "FString"},
+	{"FName", "FName"},
+	{"FText", "FText"}
+};
+
+static bool StartsWith(std::string_view Str, std::string_view Prefix)
+{
+	return Str.size() >= Prefix.size() && Str.compare(0, Prefix.size(), Prefix) == 0;
+}
+
+static bool EndsWith(std::string_view Str, std::string_view Suffix)
+{
+	return Str.size() >= Suffix.size() && Str.compare(Str.size() - Suffix.size(), Suffix.size(), Suffix) == 0;
+}
+
+static bool IsUpper(char C)
+{
+	return C >= 'A' && C <= 'Z';
+}
+
+static std::string_view Trim(std::string_view Str)
+{
+	while (!Str.empty() && std::isspace(static_cast<unsigned char>(Str.front())))
+		Str.remove_prefix(1);
+	while (!Str.empty() && std::isspace(static_cast<unsigned char>(Str.back())))
+		Str.remove_suffix(1);
+	return Str;
+}
+
+static std::string_view StripClassSuffix(std::string_view ClassName)
+{
+	if (EndsWith(ClassName, "_C"))
+		ClassName.remove_suffix(2);
+	return ClassName;
+}
+
+static std::string_view FirstLine(std::string_view Str)
+{
+	size_t NewLine = Str.find('\n');
+	return NewLine == std::string_view::npos ? Str : Str.substr(0, NewLine);
+}
+
+/** Keeps identifier characters only, so titles like "On Component Hit (Box)" become usable names. */
+static std::string SanitizeIdentifier(std::string_view Str)
+{
+	std::string Result;
+	for (char C : Str)
+	{
+		if (std::isalnum(static_cast<unsigned char>(C)) || C == '_')
+			Result += C;
+	}
+	if (!Result.empty() && std::isdigit(static_cast<unsigned char>(Result[0])))
+		Result.insert(Result.begin(), '_');
+	return Result;
+}
+
+/** UserDefinedStruct members are named "Health_5_8F3A...": strip the "_<index>_<guid>" tail. */
+static std::string_view StripStructMemberGuid(std::string_view Name)
+{
+	if (Name.size() < 34 || Name[Name.size() - 33] != '_')
+		return Name;
+
+	for (size_t i = Name.size() - 32; i < Name.size(); i++)
+	{
+		if (!std::isxdigit(static_cast<unsigned char>(Name[i])))
+			return Name;
+	}
+
+	std::string_view Head = Name.substr(0, Name.size() - 33);
+	size_t Underscore = Head.rfind('_');
+	if (Underscore == std::string_view::npos || Underscore + 1 == Head.size())
+		return Name;
+
+	for (size_t i = Underscore + 1; i < Head.size(); i++)
+	{
+		if (!std::isdigit(static_cast<unsigned char>(Head[i])))
+			return Name;
+	}
+	return Head.substr(0, Underscore);
+}
+
+static bool IsActorClassName(std::string_view ClassName)
+{
+	std::string_view Name = StripClassSuffix(ClassName);
+	if (StartsWith(Name, "W_"))
+		return false;
+	if (StartsWith(Name, "BP_"))
+		return true;
+	return ActorClassNames.count(Name) > 0;
+}
+
+static bool IsEnumTypeName(std::string_view Name)
+{
+	return StartsWith(Name, "E_") || (Name.size() > 1 && Name[0] == 'E' && IsUpper(Name[1]));
+}
+
+static bool IsStructTypeName(std::string_view Name)
+{
+	return NativeStructNames.count(Name) > 0 || StartsWith(Name, "S_") || (Name.size() > 1 && Name[0] == 'F' && IsUpper(Name[1]));
+}
+
+std::string GetScriptClassName(std::string_view BlueprintName, bool bActor)
+{
+	std::string_view Name = StripClassSuffix(BlueprintName);
+
+	if (StartsWith(Name, "W_"))
+		return "U" + std::string(Name.substr(2)) + "Widget";
+
+	if (StartsWith(Name, "BP_"))
+		Name.remove_prefix(3);
+
+	return std::string(bActor ? "A" : "U") + std::string(Name);
+}
+
+std::string GetScriptStructName(std::string_view StructName)
+{
+	if (StartsWith(StructName, "S_"))
+		return "F" + std::string(StructName.substr(2));
+	if (StructName.size() > 1 && StructName[0] == 'F' && IsUpper(StructName[1]) && NativeStructNames.count(StructName) == 0)
+		return std::string(StructName);
+	return "F" + std::string(StructName);
+}
+
+std::string GetScriptEnumName(std::string_view EnumName)
+{
+	if (StartsWith(EnumName, "E_"))
+		return "E" + std::string(EnumName.substr(2));
+	if (EnumName.size() > 1 && EnumName[0] == 'E' && IsUpper(EnumName[1]))
+		return std::string(EnumName);
+	return "E" + std::string(EnumName);
+}
+
+static std::string GetScriptObjectTypeName(std::string_view ClassName)
+{
+	if (ClassName == "UObject" || ClassName == "Object")
+		return "UObject";
+	return GetScriptClassName(ClassName, IsActorClassName(ClassName));
+}
+
+static bool UnwrapTemplate(std::string_view Type, std::string_view Template, std::string_view& OutInner)
+{
+	if (!StartsWith(Type, Template) || Type.size() <= Template.size() + 1 || Type[Template.size()] != '<' || Type.back() != '>')
+		return false;
+	OutInner = Trim(Type.substr(Template.size() + 1, Type.size() - Template.size() - 2));
+	return true;
+}
+
+std::string GetScriptTypeName(std::string_view ExportType, bool bIsEnum, bool bIsStruct)
+{
+	std::string_view Type = Trim(ExportType);
+	if (EndsWith(Type, "&"))
+		Type.remove_suffix(1);
+
+	// Containers of a type with no script spelling have none either
+	std::string_view Inner;
+	if (UnwrapTemplate(Type, "TArray", Inner))
+	{
+		std::string Element = GetScriptTypeName(Inner, bIsEnum, bIsStruct);
+		return Element.empty() ? std::string() : "TArray<" + Element + ">";
+	}
+	if (UnwrapTemplate(Type, "TSet", Inner))
+	{
+		std::string Element = GetScriptTypeName(Inner, bIsEnum, bIsStruct);
+		return Element.empty() ? std::string() : "TSet<" + Element + ">";
+	}
+	if (UnwrapTemplate(Type, "TMap", Inner))
+	{
+		// Exports before the value type was written have the literal "TMap<Key, Value>"
+		size_t Comma = Inner.find(',');
+		if (Comma == std::string_view::npos || Trim(Inner.substr(Comma + 1)) == "Value")
+			return std::string();
+
+		std::string Key = GetScriptTypeName(Trim(Inner.substr(0, Comma)));
+		std::string Value = GetScriptTypeName(Trim(Inner.substr(Comma + 1)));
+		return Key.empty() || Value.empty() ? std::string() : "TMap<" + Key + ", " + Value + ">";
+	}
+	if (UnwrapTemplate(Type, "TSubclassOf", Inner))
+		return "TSubclassOf<" + GetScriptObjectTypeName(Inner) + ">";
+
+	auto Primitive = PrimitiveTypeNames.find(Type);
+	if (Primitive != PrimitiveTypeNames.end())
+		return std::string(Primitive->second);
+
+	if (Type == "exec" || Type == "Wildcard")
+		return std::string();
+
+	if (bIsEnum || (!bIsStruct && IsEnumTypeName(Type)))
+		return GetScriptEnumName(Type);
+
+	if (bIsStruct || IsStructTypeName(Type))
+		return GetScriptStructName(Type);
+
+	return GetScriptObjectTypeName(Type);
+}
+
+static bool IsNumber(std::string_view Str)
+{
+	Str = Trim(Str);
+	if (Str.empty())
+		return false;
+
+	std::string Copy(Str);
+	char* End = nullptr;
+	std::strtod(Copy.c_str(), &End);
+	return End == Copy.c_str() + Copy.size();
+}
+
+static std::string FormatFloat(std::string_view Value)
+{
+	if (!IsNumber(Value))
+		return std::string();
+
+	double Number = std::strtod(std::string(Trim(Value)).c_str(), nullptr);
+	char Buffer[64];
+	std::snprintf(Buffer, sizeof(Buffer), "%.6f", Number);
+
+	std::string Result = Buffer;
+	while (Result.size() > 1 && Result.back() == '0' && Result[Result.size() - 2] != '.')
+		Result.pop_back();
+	if (Result == "-0.0")
+		Result = "0.0";
+	return Result + "f";
+}
+
+static std::string FormatInt(std::string_view Value)
+{
+	Value = Trim(Value);
+	return IsNumber(Value) ? std::string(Value) : std::string();
+}
+
+/** Splits "(X=1.0,Y=2.0,Z=3.0)" into key/value pairs, respecting nested parentheses and quotes. */
+static bool ParseStructText(std::string_view Text, std::vector<std::pair<std::string_view, std::string_view>>& OutFields)
+{
+	Text = Trim(Text);
+	if (Text.size() < 2 || Text.front() != '(' || Text.back() != ')')
+		return false;
+
+	Text = Text.substr(1, Text.size() - 2);
+
+	int Depth = 0;
+	bool bInQuotes = false;
+	size_t FieldStart = 0;
+
+	for (size_t i = 0; i <= Text.size(); i++)
+	{
+		const bool bAtEnd = i == Text.size();
+		const char C = bAtEnd ? ',' : Text[i];
+
+		if (C == '"' && (i == 0 || Text[i - 1] != '\\'))
+			bInQuotes = !bInQuotes;
+		if (bInQuotes)
+			continue;
+
+		if (C == '(')
+			Depth++;
+		else if (C == ')')
+			Depth--;
+		else if (C == ',' && Depth == 0)
+		{
+			std::string_view Field = Trim(Text.substr(FieldStart, i - FieldStart));
+			FieldStart = i + 1;
+			if (Field.empty())
+				continue;
+
+			size_t Equals = Field.find('=');
+			if (Equals == std::string_view::npos)
+				return false;
+			OutFields.emplace_back(Trim(Field.substr(0, Equals)), Trim(Field.substr(Equals + 1)));
+		}
+	}
+
+	return Depth == 0 && !bInQuotes;
+}
+
+static std::string_view FindField(const std::vector<std::pair<std::string_view, std::string_view>>& Fields, std::string_view Key)
+{
+	for (const auto& Field : Fields)
+	{
+		if (Field.first == Key)
+			return Field.second;
+	}
+	return std::string_view();
+}
+
+/** Builds "Type(a, b, c)" from the named struct fields, or returns empty if any field is missing. */
+static std::string MakeConstructor(std::string_view ScriptType, std::string_view Text, std::initializer_list<std::string_view> Keys, bool bFloat)
+{
+	std::vector<std::pair<std::string_view, std::string_view>> Fields;
+	if (!ParseStructText(Text, Fields))
+		return std::string();
+
+	std::string Result = std::string(ScriptType) + "(";
+	bool bFirst = true;
+	for (std::string_view Key : Keys)
+	{
+		std::string Arg = bFloat ? FormatFloat(FindField(Fields, Key)) : FormatInt(FindField(Fields, Key));
+		if (Arg.empty())
+			return std::string();
+
+		if (!bFirst)
+			Result += ", ";
+		Result += Arg;
+		bFirst = false;
+	}
+	return Result + ")";
+}
+
+static std::string QuoteString(std::string_view Str)
+{
+	std::string Result = "\"";
+	for (char C : Str)
+	{
+		if (C == '"' || C == '\\')
+			Result += '\\';
+		Result += C;
+	}
+	return Result + "\"";
+}
+
+static std::string_view Unquote(std::string_view Str)
+{
+	Str = Trim(Str);
+	if (Str.size() >= 2 && Str.front() == '"' && Str.back() == '"')
+		return Str.substr(1, Str.size() - 2);
+	return Str;
+}
+
+std::string ConvertDefaultValue(std::string_view ScriptType, std::string_view Value, std::string_view PropertyName, const FEnumeratorNames* EnumeratorNames)
+{
+	Value = Trim(Value);
+
+	if (ScriptType == "bool")
+	{
+		if (Value == "True" || Value == "true")
+			return "true";
+		if (Value == "False" || Value == "false")
+			return "false";
+		return std::string();
+	}
+
+	if (ScriptType == "int" || ScriptType == "int64" || ScriptType == "uint8")
+		return FormatInt(Value);
+
+	if (ScriptType == "float" || ScriptType == "float64")
+		return FormatFloat(Value);
+
+	if (ScriptType == "FString")
+		return StartsWith(Value, "\"") ? std::string(Value) : QuoteString(Value);
+
+	if (ScriptType == "FName")
+		return "n" + QuoteString(Unquote(Value));
+
+	if (ScriptType == "FText")
+	{
+		// NSLOCTEXT("Ns", "Key", "Source") / INVTEXT("Source"): the last quoted literal is the source string
+		size_t Close = Value.rfind('"');
+		if (Close == std::string_view::npos || Close == 0)
+			return std::string();
+		size_t Open = Value.rfind('"', Close - 1);
+		if (Open == std::string_view::npos)
+			return std::string();
+		return "FText::FromString(" + std::string(Value.substr(Open, Close - Open + 1)) + ")";
+	}
+
+	if (ScriptType == "FVector")
+		return MakeConstructor(ScriptType, Value, {"X", "Y", "Z"}, true);
+
+	if (ScriptType == "FRotator")
+		return MakeConstructor(ScriptType, Value, {"Pitch", "Yaw", "Roll"}, true);
+
+	if (ScriptType == "FVector2D")
+		return MakeConstructor(ScriptType, Value, {"X", "Y"}, true);
+
+	if (ScriptType == "FIntPoint")
+	{
+		// Widget components expose DrawSize as FVector2D in script
+		if (PropertyName == "DrawSize")
+			return MakeConstructor("FVector2D", Value, {"X", "Y"}, true);
+		return MakeConstructor(ScriptType, Value, {"X", "Y"}, false);
+	}
+
+	if (ScriptType == "FLinearColor")
+		return MakeConstructor(ScriptType, Value, {"R", "G", "B", "A"}, true);
+
+	if (ScriptType == "FColor")
+		return MakeConstructor(ScriptType, Value, {"R", "G", "B", "A"}, false);
+
+	if (ScriptType == "FTransform")
+	{
+		std::vector<std::pair<std::string_view, std::string_view>> Fields;
+		if (!ParseStructText(Value, Fields))
+			return std::string();
+
+		std::string Rotation = MakeConstructor("FQuat", FindField(Fields, "Rotation"), {"X", "Y", "Z", "W"}, true);
+		std::string Translation = MakeConstructor("FVector", FindField(Fields, "Translation"), {"X", "Y", "Z"}, true);
+		std::string Scale = MakeConstructor("FVector", FindField(Fields, "Scale3D"), {"X", "Y", "Z"}, true);
+		if (Rotation.empty() || Translation.empty() || Scale.empty())
+			return std::string();
+		return "FTransform(" + Rotation + ", " + Translation + ", " + Scale + ")";
+	}
+
+	if (IsEnumTypeName(ScriptType) && !Value.empty() && !StartsWith(Value, "("))
+	{
+		size_t Scope = Value.rfind("::");
+		std::string_view Entry = Scope == std::string_view::npos ? Value : Value.substr(Scope + 2);
+
+		// UserDefinedEnum values are internal names; the generated enum declares the display names
+		if (EnumeratorNames)
+		{
+			auto Enum = EnumeratorNames->find(std::string(ScriptType));
+			if (Enum != EnumeratorNames->end())
+			{
+				auto Enumerator = Enum->second.find(std::string(Entry));
+				return Enumerator == Enum->second.end() ? std::string() : std::string(ScriptType) + "::" + Enumerator->second;
+			}
+		}
+		if (StartsWith(Entry, "NewEnumerator"))
+			return std::string();
+
+		return std::string(ScriptType) + "::" + std::string(Entry);
+	}
+
+	return std::string();
+}
+
+static bool IsObjectScriptType(std::string_view ScriptType)
+{
+	return ScriptType.size() > 1 && (ScriptType[0] == 'A' || ScriptType[0] == 'U') && IsUpper(ScriptType[1]);
+}
+
+static std::string_view ClipForComment(std::string_view Value)
+{
+	constexpr size_t MaxCommentValue = 120;
+	return Value.size() > MaxCommentValue ? Value.substr(0, MaxCommentValue) : Value;
+}
+
+/**
+ * Emits `default Target = Value;`. Structs without a script constructor are expanded member by
+ * member (PrimaryActorTick=(bCanEverTick=True,...) -> default PrimaryActorTick.bCanEverTick = true;).
+ * Values with no script literal are kept as a TODO comment so nothing is silently dropped.
+ */
+static void EmitDefault(std::string& Out, const std::string& Target, std::string_view ScriptType, std::string_view RawValue, std::string_view PropertyName, const FEnumeratorNames* EnumeratorNames, int Depth = 0)
+{
+	std::string Converted = ConvertDefaultValue(ScriptType, RawValue, PropertyName, EnumeratorNames);
+	if (!Converted.empty())
+	{
+		Out += "\tdefault " + Target + " = " + Converted + ";\n";
+		return;
+	}
+
+	std::vector<std::pair<std::string_view, std::string_view>> Fields;
+	if (Depth < 2 && ParseStructText(RawValue, Fields) && !Fields.empty())
+	{
+		for (const auto& Field : Fields)
+		{
+			const std::string MemberTarget = Target + "." + std::string(Field.first);
+			std::string_view MemberValue = Field.second;
+
+			if (MemberValue == "True" || MemberValue == "False")
+				EmitDefault(Out, MemberTarget, "bool", MemberValue, Field.first, EnumeratorNames, Depth + 1);
+			else if (IsNumber(MemberValue))
+				EmitDefault(Out, MemberTarget, MemberValue.find_first_of(".eE") != std::string_view::npos ? "float" : "int", MemberValue, Field.first, EnumeratorNames, Depth + 1);
+			else
+				EmitDefault(Out, MemberTarget, std::string_view(), MemberValue, Field.first, EnumeratorNames, Depth + 1);
+		}
+		return;
+	}
+
+	Out += "\t// TODO: default " + Target + " = " + std::string(ClipForComment(RawValue)) + ";\n";
+}
+
+static std::string GetZeroValue(const std::string& ScriptType)
+{
+	if (ScriptType == "bool")
+		return "false";
+	if (ScriptType == "int" || ScriptType == "int64" || ScriptType == "uint8")
+		return "0";
+	if (ScriptType == "float" || ScriptType == "float64")
+		return "0.0f";
+	if (IsObjectScriptType(ScriptType))
+		return "nullptr";
+	return ScriptType + "()";
+}
+
+static std::string GetOutputDirectory(std::string_view AssetPath)
+{
+	// /Game/Core/Inventory/BP_InventoryVisual -> Core/Inventory/
+	std::string_view Path = AssetPath;
+	if (StartsWith(Path, "/Game/"))
+		Path.remove_prefix(6);
+	else if (StartsWith(Path, "/"))
+	{
+		// Plugin content: /PluginName/Dir/Asset keeps the mount point as a directory
+		Path.remove_prefix(1);
+	}
+
+	size_t Slash = Path.rfind('/');
+	return Slash == std::string_view::npos ? std::string() : std::string(Path.substr(0, Slash + 1));
+}
+
+// ---- Graph helpers ----
+
+struct FGraphView
+{
+	const FJsonNode* Graph = nullptr;
+	std::unordered_map<std::string_view, const FJsonNode*> NodesByName;
+
+	explicit FGraphView(const FJsonNode& InGraph)
+		: Graph(&InGraph)
+	{
+		for (const FJsonNode& Node : InGraph.GetArray("nodes"))
+			NodesByName.emplace(Node.GetString("name"), &Node);
+	}
+
+	const FJsonNode* FindNode(std::string_view Name) const
+	{
+		auto It = NodesByName.find(Name);
+		return It != NodesByName.end() ? It->second : nullptr;
+	}
+};
+
+static bool IsExecPin(const FJsonNode& Pin)
+{
+	return Pin.GetString("type") == "exec";
+}
+
+static void TraceExecFlow(const FGraphView& View, const FJsonNode& Node, int Indent, std::unordered_set<const FJsonNode*>& Visited, std::vector<std::string>& OutLines)
+{
+	constexpr size_t MaxTraceLines = 200;
+
+	const FJsonNode* Current = &Node;
+	while (Current && OutLines.size() < MaxTraceLines)
+	{
+		std::vector<const FJsonNode*> ConnectedExecOutputs;
+		for (const FJsonNode& Pin : Current->GetArray("outputs"))
+		{
+			if (IsExecPin(Pin) && Pin.GetArray("connections").Count > 0)
+				ConnectedExecOutputs.push_back(&Pin);
+		}
+
+		if (ConnectedExecOutputs.empty())
+			return;
+
+		auto FollowPin = [&View](const FJsonNode& Pin) -> const FJsonNode*
+		{
+			const FJsonNode& Connections = Pin.GetArray("connections");
+			return Connections.Count > 0 ? View.FindNode(Connections.Children[0].GetString("node_name")) : nullptr;
+		};
+
+		if (ConnectedExecOutputs.size() == 1)
+		{
+			const FJsonNode* Next = FollowPin(*ConnectedExecOutputs[0]);
+			if (!Next || !Visited.insert(Next).second)
+				return;
+
+			OutLines.push_back(std::string(Indent * 2, ' ') + std::string(FirstLine(Next->GetString("title"))));
+			Current = Next;
+			continue;
+		}
+
+		// Branch, Sequence, loops: trace every connected exec output under its pin name
+		for (const FJsonNode* Pin : ConnectedExecOutputs)
+		{
+			OutLines.push_back(std::string(Indent * 2, ' ') + "[" + std::string(Pin->GetString("name")) + "]");
+
+			const FJsonNode* Next = FollowPin(*Pin);
+			if (!Next || !Visited.insert(Next).second)
+				continue;
+
+			OutLines.push_back(std::string((Indent + 1) * 2, ' ') + std::string(FirstLine(Next->GetString("title"))));
+			TraceExecFlow(View, *Next, Indent + 1, Visited, OutLines);
+		}
+		return;
+	}
+}
+
+static void EmitFunctionBody(std::string& Out, const FGraphView& View, const FJsonNode& EntryNode, std::string_view GraphName, const std::string& ReturnType)
+{
+	std::unordered_set<const FJsonNode*> Visited = {&EntryNode};
+	std::vector<std::string> Lines;
+	TraceExecFlow(View, EntryNode, 1, Visited, Lines);
+
+	Out += "\t{\n";
+	if (!Lines.empty())
+	{
+		Out += "\t\t// Exec flow:\n";
+		for (const std::string& Line : Lines)
+			Out += "\t\t//" + Line + "\n";
+	}
+	Out += "\t\t// TODO: implement from " + std::string(GraphName) + "\n";
+	if (!ReturnType.empty() && ReturnType != "void")
+		Out += "\t\treturn " + GetZeroValue(ReturnType) + ";\n";
+	Out += "\t}\n";
+}
+
+static std::string BuildParameterList(const FJsonNode& Pins, bool bSkipDelegates)
+{
+	std::string Params;
+	for (const FJsonNode& Pin : Pins)
+	{
+		std::string_view PinType = Pin.GetString("type");
+		if (IsExecPin(Pin) || (bSkipDelegates && PinType == "Delegate"))
+			continue;
+
+		std::string ScriptType = GetScriptTypeName(PinType);
+		if (ScriptType.empty())
+			continue;
+
+		if (!Params.empty())
+			Params += ", ";
+		Params += ScriptType + (EndsWith(PinType, "&") ? "&in " : " ") + SanitizeIdentifier(Pin.GetString("name"));
+	}
+	return Params;
+}
+
+static void EmitFunctionGraph(std::string& Out, const FJsonNode& Graph)
+{
+	FGraphView View(Graph);
+	std::string_view GraphName = Graph.GetString("name");
+
+	const FJsonNode* Entry = nullptr;
+	const FJsonNode* Result = nullptr;
+	for (const FJsonNode& Node : Graph.GetArray("nodes"))
+	{
+		std::string_view NodeType = Node.GetString("node_type");
+		if (NodeType == "FunctionEntry" && !Entry)
+			Entry = &Node;
+		else if (NodeType == "FunctionResult" && !Result)
+			Result = &Node;
+	}
+
+	if (!Entry)
+	{
+		Out += "\t// TODO: function graph " + std::string(GraphName) + " has no entry node\n\n";
+		return;
+	}
+
+	if (GraphName == "UserConstructionScript")
+	{
+		Out += "\tUFUNCTION(BlueprintOverride)\n\tvoid ConstructionScript()\n";
+		EmitFunctionBody(Out, View, *Entry, GraphName, "void");
+		Out += "\n";
+		return;
+	}
+
+	std::string Params = BuildParameterList(Entry->GetArray("outputs"), false);
+
+	// A single result pin becomes the return value, any others become out parameters
+	std::string ReturnType = "void";
+	if (Result)
+	{
+		std::vector<const FJsonNode*> ResultPins;
+		for (const FJsonNode& Pin : Result->GetArray("inputs"))
+		{
+			if (!IsExecPin(Pin) && !GetScriptTypeName(Pin.GetString("type")).empty())
+				ResultPins.push_back(&Pin);
+		}
+
+		for (size_t i = 0; i < ResultPins.size(); i++)
+		{
+			std::string ScriptType = GetScriptTypeName(ResultPins[i]->GetString("type"));
+			if (i == 0 && (ResultPins.size() == 1 || ResultPins[i]->GetString("name") == "ReturnValue"))
+			{
+				ReturnType = ScriptType;
+				continue;
+			}
+
+			if (!Params.empty())
+				Params += ", ";
+			Params += ScriptType + "&out " + SanitizeIdentifier(ResultPins[i]->GetString("name"));
+		}
+	}
+
+	Out += "\tUFUNCTION()\n";
+	Out += "\t" + ReturnType + " " + SanitizeIdentifier(GraphName) + "(" + Params + ")\n";
+	EmitFunctionBody(Out, View, *Entry, GraphName, ReturnType);
+	Out += "\n";
+}
+
+static void EmitEventGraph(std::string& Out, const FJsonNode& Graph)
+{
+	FGraphView View(Graph);
+	std::string_view GraphName = Graph.GetString("name");
+
+	for (const FJsonNode& Node : Graph.GetArray("nodes"))
+	{
+		std::string_view NodeType = Node.GetString("node_type");
+		if (NodeType != "Event" && NodeType != "CustomEvent")
+			continue;
+
+		std::string_view NodeClass = Node.GetString("class");
+		std::string_view EventName = Node.GetString("event_name");
+
+		std::string FunctionName;
+		bool bOverride = false;
+
+		if (NodeClass == "K2Node_Event")
+		{
+			// ReceiveBeginPlay -> BeginPlay, ReceiveTick -> Tick
+			bOverride = true;
+			FunctionName = std::string(StartsWith(EventName, "Receive") ? EventName.substr(7) : EventName);
+		}
+		else if (NodeClass == "K2Node_CustomEvent")
+		{
+			// Custom events carry their name in the title rather than the event reference
+			FunctionName = SanitizeIdentifier(EventName.empty() || EventName == "None" ? FirstLine(Node.GetString("compact_title")) : EventName);
+		}
+		else
+		{
+			// Component-bound and input events: a plain UFUNCTION the script binds in BeginPlay
+			FunctionName = SanitizeIdentifier(FirstLine(Node.GetString("compact_title")));
+			Out += "\t// TODO: bind " + std::string(NodeClass) + " '" + std::string(FirstLine(Node.GetString("title"))) + "'\n";
+		}
+
+		if (FunctionName.empty())
+			continue;
+
+		Out += bOverride ? "\tUFUNCTION(BlueprintOverride)\n" : "\tUFUNCTION()\n";
+		Out += "\tvoid " + FunctionName + "(" + BuildParameterList(Node.GetArray("outputs"), true) + ")\n";
+		EmitFunctionBody(Out, View, Node, GraphName, "void");
+		Out += "\n";
+	}
+}
+
+// ---- Top-level converters ----
+
+static bool ConvertBlueprint(const FJsonNode& Root, FConversionResult& Out, const FEnumeratorNames* EnumeratorNames)
+{
+	std::string_view Name = Root.GetString("name");
+	std::string_view BlueprintPath = Root.GetString("blueprint_path");
+	std::string_view ParentClass = Root.GetString("parent_class", "Object");
+
+	const bool bWidget = StartsWith(Name, "W_");
+	const bool bActor = !bWidget && IsActorClassName(ParentClass);
+	const std::string ClassName = GetScriptClassName(Name, bActor);
+
+	std::string FileName = std::string(StripClassSuffix(Name));
+	if (StartsWith(FileName, "BP_"))
+		FileName = FileName.substr(3);
+	else if (bWidget)
+		FileName = FileName.substr(2) + "Widget";
+
+	Out.RelativePath = GetOutputDirectory(BlueprintPath) + FileName + ".as";
+
+	std::string& Code = Out.Code;
+	Code.reserve(4096);
+	Code += "// Generated from " + std::string(BlueprintPath) + "\n";
+	if (bWidget)
+		Code += "UCLASS(Abstract)\n";
+	Code += "class " + ClassName + " : " + GetScriptObjectTypeName(ParentClass) + "\n{\n";
+
+	// 1. Class defaults at the very top
+	bool bAnyDefaults = false;
+	for (const FJsonNode& Default : Root.GetArray("class_defaults"))
+	{
+		if (Default.GetBool("is_blueprint_reference"))
+			continue;
+
+		std::string_view PropName = Default.GetString("name");
+		std::string ScriptType = GetScriptTypeName(Default.GetString("type"), false, Default.Find("struct_source") != nullptr);
+		bAnyDefaults = true;
+		if (ScriptType.empty())
+		{
+			Code += "\t// TODO: default " + std::string(PropName) + " has type " + std::string(Default.GetString("type")) + ", which has no script spelling\n";
+			continue;
+		}
+		EmitDefault(Code, std::string(PropName), ScriptType, Default.GetString("value"), PropName, EnumeratorNames);
+	}
+	if (bAnyDefaults)
+		Code += "\n";
+
+	// 2. Components with their defaults grouped right after the declaration
+	bool bHasRoot = false;
+	for (const FJsonNode& Component : Root.GetArray("components"))
+	{
+		std::string_view CompName = Component.GetString("name");
+		std::string_view AttachParent = Component.GetString("attach_parent");
+
+		if (!AttachParent.empty())
+			Code += "\tUPROPERTY(DefaultComponent, Attach = " + std::string(AttachParent) + ")\n";
+		else if (!bHasRoot && bActor)
+		{
+			Code += "\tUPROPERTY(DefaultComponent, RootComponent)\n";
+			bHasRoot = true;
+		}
+		else
+			Code += "\tUPROPERTY(DefaultComponent)\n";
+
+		Code += "\t" + GetScriptObjectTypeName(Component.GetString("type")) + " " + std::string(CompName) + ";\n";
+
+		for (const FJsonNode& Property : Component.GetArray("properties"))
+		{
+			if (Property.GetBool("is_blueprint_reference"))
+				continue;
+
+			std::string_view PropName = Property.GetString("name");
+			std::string ScriptType = GetScriptTypeName(Property.GetString("type"), false, Property.Find("struct_source") != nullptr);
+			if (ScriptType.empty())
+			{
+				Code += "\t// TODO: default " + std::string(CompName) + "." + std::string(PropName) + " has type " + std::string(Property.GetString("type")) + ", which has no script spelling\n";
+				continue;
+			}
+			EmitDefault(Code, std::string(CompName) + "." + std::string(PropName), ScriptType, Property.GetString("value"), PropName, EnumeratorNames);
+		}
+		Code += "\n";
+	}
+
+	// 3. Properties: editor-configurable ones get UPROPERTY, runtime state is private
+	const FJsonNode& Dispatchers = Root.GetArray("event_dispatchers");
+	for (const FJsonNode& Dispatcher : Dispatchers)
+		Code += "\t// TODO: event dispatcher " + std::string(Dispatcher.String) + " (declare its delegate signature)\n";
+	if (Dispatchers.Count > 0)
+		Code += "\n";
+
+	std::string EditableProperties;
+	std::string RuntimeState;
+	for (const FJsonNode& Variable : Root.GetArray("variables"))
+	{
+		std::string_view VarType = Variable.GetString("type");
+		if (VarType == "MulticastDelegate" || VarType == "Delegate")
+			continue;
+
+		std::string ScriptType = GetScriptTypeName(VarType, Variable.GetBool("is_enum"), Variable.Find("struct_source") != nullptr);
+		if (ScriptType.empty())
+		{
+			RuntimeState += "\t// TODO: variable " + std::string(Variable.GetString("name")) + " has type " + std::string(VarType) + ", which has no script spelling\n";
+			continue;
+		}
+
+		std::string VarName = SanitizeIdentifier(Variable.GetString("name"));
+		std::string_view Flags = Variable.GetString("flags");
+
+		std::string Initializer;
+		if (!Variable.GetBool("is_blueprint_reference"))
+			Initializer = ConvertDefaultValue(ScriptType, Variable.GetString("cdo_default_value"), VarName, EnumeratorNames);
+
+		if (Flags.find("EditAnywhere") != std::string_view::npos)
+		{
+			std::string_view Category = Variable.GetString("category", "Default");
+			const bool bReadOnly = Flags.find("BlueprintReadOnly") != std::string_view::npos;
+			EditableProperties += "\tUPROPERTY(EditAnywhere, " + std::string(bReadOnly ? "BlueprintReadOnly" : "BlueprintReadWrite") + ", Category = " + QuoteString(Category) + ")\n";
+			EditableProperties += "\t" + ScriptType + " " + VarName + (Initializer.empty() ? "" : " = " + Initializer) + ";\n\n";
+		}
+		else
+		{
+			// Runtime state: bool state vars take the b prefix, object refs start out null
+			if (ScriptType == "bool" && !(VarName.size() > 1 && VarName[0] == 'b' && IsUpper(VarName[1])))
+				VarName = "b" + VarName;
+			if (Initializer.empty() && IsObjectScriptType(ScriptType))
+				Initializer = "nullptr";
+
+			RuntimeState += "\tprivate " + ScriptType + " " + VarName + (Initializer.empty() ? "" : " = " + Initializer) + ";\n";
+		}
+	}
+	Code += EditableProperties;
+	if (!RuntimeState.empty())
+		Code += RuntimeState + "\n";
+
+	// 4. Functions
+	for (const FJsonNode& Graph : Root.GetArray("graphs"))
+	{
+		std::string_view GraphType = Graph.GetString("type");
+		if (GraphType == "EventGraph")
+			EmitEventGraph(Code, Graph);
+		else if (GraphType == "FunctionGraph")
+			EmitFunctionGraph(Code, Graph);
+	}
+
+	while (EndsWith(Code, "\n\n"))
+		Code.pop_back();
+	Code += "};\n";
+	return true;
+}
+
+static bool ConvertStruct(const FJsonNode& Root, FConversionResult& Out, const FEnumeratorNames* EnumeratorNames)
+{
+	std::string_view StructPath = Root.GetString("struct_path");
+	const std::string StructName = GetScriptStructName(Root.GetString("name"));
+
+	Out.RelativePath = GetOutputDirectory(StructPath) + StructName + ".as";
+
+	std::string& Code = Out.Code;
+	Code += "// Generated from " + std::string(StructPath) + "\n";
+	Code += "struct " + StructName + "\n{\n";
+
+	for (const FJsonNode& Field : Root.GetArray("fields"))
+	{
+		std::string ScriptType = GetScriptTypeName(Field.GetString("type"), false, Field.Find("struct_source") != nullptr);
+		std::string FieldName = SanitizeIdentifier(StripStructMemberGuid(Field.GetString("name")));
+		std::string Initializer = ConvertDefaultValue(ScriptType, Field.GetString("default_value"), FieldName, EnumeratorNames);
+
+		Code += "\t" + ScriptType + " " + FieldName + (Initializer.empty() ? "" : " = " + Initializer) + ";\n";
+	}
+
+	Code += "};\n";
+	return true;
+}
+
+static std::string_view GetEnumeratorShortName(const FJsonNode& Entry)
+{
+	std::string_view Internal = Entry.GetString("name");
+	size_t Scope = Internal.rfind("::");
+	return Scope == std::string_view::npos ? Internal : Internal.substr(Scope + 2);
+}
+
+static std::string GetScriptEnumeratorName(const FJsonNode& Entry)
+{
+	// Display names are the clean authored names; internal ones are NewEnumeratorN
+	std::string EntryName = SanitizeIdentifier(Entry.GetString("display_name"));
+	if (EntryName.empty())
+		EntryName = SanitizeIdentifier(GetEnumeratorShortName(Entry));
+	return EntryName;
+}
+
+void CollectEnumeratorNames(const FJsonNode& Root, FEnumeratorNames& OutNames)
+{
+	if (GetExportKind(Root) != EExportKind::Enum)
+		return;
+
+	std::unordered_map<std::string, std::string>& Names = OutNames[GetScriptEnumName(Root.GetString("name"))];
+	for (const FJsonNode& Entry : Root.GetArray("values"))
+		Names.emplace(std::string(GetEnumeratorShortName(Entry)), GetScriptEnumeratorName(Entry));
+}
+
+static bool ConvertEnum(const FJsonNode& Root, FConversionResult& Out)
+{
+	std::string_view EnumPath = Root.GetString("enum_path");
+	const std::string EnumName = GetScriptEnumName(Root.GetString("name"));
+
+	Out.RelativePath = GetOutputDirectory(EnumPath) + EnumName + ".as";
+
+	std::string& Code = Out.Code;
+	Code += "// Generated from " + std::string(EnumPath) + "\n";
+	Code += "enum " + EnumName + "\n{\n";
+
+	const FJsonNode& Values = Root.GetArray("values");
+	double ExpectedValue = 0.0;
+	for (uint32_t i = 0; i < Values.Count; i++)
+	{
+		const FJsonNode& Entry = Values.Children[i];
+		const std::string EntryName = GetScriptEnumeratorName(Entry);
+
+		const double Value = Entry.GetNumber("value", ExpectedValue);
+		Code += "\t" + EntryName;
+		if (Value != ExpectedValue)
+			Code += " = " + std::to_string(static_cast<long long>(Value));
+		Code += i + 1 < Values.Count ? ",\n" : "\n";
+		ExpectedValue = Value + 1.0;
+	}
+
+	Code += "};\n";
+	return true;
+}
+
+EExportKind GetExportKind(const FJsonNode& Root)
+{
+	if (!Root.IsObject())
+		return EExportKind::Unknown;
+	if (Root.Find("blueprint_path"))
+		return EExportKind::Blueprint;
+	if (Root.Find("struct_path"))
+		return EExportKind::Struct;
+	if (Root.Find("enum_path") && Root.Find("values"))
+		return EExportKind::Enum;
+	return EExportKind::Unknown;
+}
+
+bool ConvertExport(const FJsonNode& Root, FConversionResult& Out, const FEnumeratorNames* EnumeratorNames)
+{
+	Out.Kind = GetExportKind(Root);
+	switch (Out.Kind)
+	{
+	case EExportKind::Blueprint:
+		return ConvertBlueprint(Root, Out, EnumeratorNames);
+	case EExportKind::Struct:
+		return ConvertStruct(Root, Out, EnumeratorNames);
+	case EExportKind::Enum:
+		return ConvertEnum(Root, Out);
+	default:
+		Out.Error = "not a blueprint, struct or enum export";
+		return false;
+	}
+}
+
+} // namespace BlueprintTools
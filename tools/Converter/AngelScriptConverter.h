@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Json.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace BlueprintTools
+{
+
+enum class EExportKind
+{
+	Unknown,
+	Blueprint,
+	Struct,
+	Enum
+};
+
+struct FConversionResult
+{
+	EExportKind Kind = EExportKind::Unknown;
+
+	/** Path of the generated file relative to the Script/ root, e.g. "Core/Inventory/InventoryVisual.as" */
+	std::string RelativePath;
+
+	std::string Code;
+	std::string Error;
+};
+
+/**
+ * Script enumerator names keyed by script enum name, then by exported enumerator name.
+ * UserDefinedEnums export their values under internal NewEnumeratorN names, while the
+ * generated enum declares the authored display names.
+ */
+using FEnumeratorNames = std::unordered_map<std::string, std::unordered_map<std::string, std::string>>;
+
+/** Detects which exporter endpoint produced the document (/export, /export-struct or /export-enum). */
+EExportKind GetExportKind(const FJsonNode& Root);
+
+/** Adds the enumerators of an /export-enum document to OutNames; other documents are ignored. */
+void CollectEnumeratorNames(const FJsonNode& Root, FEnumeratorNames& OutNames);
+
+/**
+ * Converts one exporter JSON document to an AngelScript skeleton, applying the
+ * conversion rules from SKILL.md: naming prefixes, class `default` statements,
+ * DefaultComponent/Attach declarations with component defaults, and property
+ * defaults from the CDO. Function bodies are stubs annotated with the exec flow.
+ * Enum defaults are spelled through EnumeratorNames when given.
+ */
+bool ConvertExport(const FJsonNode& Root, FConversionResult& Out, const FEnumeratorNames* EnumeratorNames = nullptr);
+
+// Naming rules, exposed for tools that need to map exported names to script names
+
+/** BP_Player -> APlayer, W_InventorySlot -> UInventorySlotWidget, BP_Foo_C -> AFoo */
+std::string GetScriptClassName(std::string_view BlueprintName, bool bActor);
+
+/** S_Data -> FData, Vector -> FVector */
+std::string GetScriptStructName(std::string_view StructName);
+
+/** E_SignalType -> ESignalType, MyEnum -> EMyEnum */
+std::string GetScriptEnumName(std::string_view EnumName);
+
+/** Converts an exported type string ("int32", "TArray<Actor>", "TSubclassOf<BP_Foo_C>") to its script spelling. */
+std::string GetScriptTypeName(std::string_view ExportType, bool bIsEnum = false, bool bIsStruct = false);
+
+/**
+ * Returns an empty string when the value has no script literal (object references, containers,
+ * or a UserDefinedEnum value whose enum isn't in EnumeratorNames).
+ */
+std::string ConvertDefaultValue(std::string_view ScriptType, std::string_view Value, std::string_view PropertyName = {}, const FEnumeratorNames* EnumeratorNames = nullptr);
+
+} // namespace BlueprintTools
@@ -0,0 +1,231 @@
+// bp2as: offline batch converter from BlueprintExporter JSON to AngelScript skeletons.
+//
+//   bp2as [-o <ScriptDir>] [-j <Jobs>] [--stdout] [--flat] <export.json | directory>...
+//
+// Directories are scanned recursively for *.json exports. Files are parsed and
+// converted on a pool of worker threads; each one is independent, apart from the
+// enumerator names read from the *_enum.json exports up front so UserDefinedEnum
+// defaults can be spelled the way the generated enums declare them.
+
+#include "AngelScriptConverter.h"
+#include "Json.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace BlueprintTools;
+
+struct FCommandLine
+{
+	std::vector<std::string> Inputs;
+	std::string OutputDir = "Script";
+	unsigned Jobs = GetDefaultWorkerCount();
+	bool bStdout = false;
+	bool bFlat = false;
+	bool bQuiet = false;
+};
+
+static void PrintUsage()
+{
+	std::fprintf(stderr,
+		"Usage: bp2as [options] <export.json | directory>...\n"
+		"\n"
+		"Converts BlueprintExporter JSON (/export, /export-struct, /export-enum) to AngelScript.\n"
+		"\n"
+		"Options:\n"
+		"  -o, --out <dir>   Script root to write to (default: Script)\n"
+		"  -j, --jobs <n>    Worker threads (default: hardware concurrency)\n"
+		"      --flat        Write all files directly into the output dir instead of mirroring /Game paths\n"
+		"      --stdout      Print generated code to stdout instead of writing files\n"
+		"  -q, --quiet       Only print failures and the summary\n");
+}
+
+static bool ParseCommandLine(int Argc, char** Argv, FCommandLine& Out)
+{
+	for (int i = 1; i < Argc; i++)
+	{
+		const char* Arg = Argv[i];
+		auto NextValue = [&](const char*& Value) -> bool
+		{
+			if (i + 1 >= Argc)
+			{
+				std::fprintf(stderr, "bp2as: %s expects a value\n", Arg);
+				return false;
+			}
+			Value = Argv[++i];
+			return true;
+		};
+
+		const char* Value = nullptr;
+		if (!std::strcmp(Arg, "-o") || !std::strcmp(Arg, "--out"))
+		{
+			if (!NextValue(Value))
+				return false;
+			Out.OutputDir = Value;
+		}
+		else if (!std::strcmp(Arg, "-j") || !std::strcmp(Arg, "--jobs"))
+		{
+			if (!NextValue(Value))
+				return false;
+			Out.Jobs = static_cast<unsigned>(std::max(1, std::atoi(Value)));
+		}
+		else if (!std::strcmp(Arg, "--flat"))
+			Out.bFlat = true;
+		else if (!std::strcmp(Arg, "--stdout"))
+			Out.bStdout = true;
+		else if (!std::strcmp(Arg, "-q") || !std::strcmp(Arg, "--quiet"))
+			Out.bQuiet = true;
+		else if (!std::strcmp(Arg, "-h") || !std::strcmp(Arg, "--help"))
+			return false;
+		else if (Arg[0] == '-')
+		{
+			std::fprintf(stderr, "bp2as: unknown option %s\n", Arg);
+			return false;
+		}
+		else
+			Out.Inputs.push_back(Arg);
+	}
+
+	return !Out.Inputs.empty();
+}
+
+static void CollectInputFiles(const std::vector<std::string>& Inputs, std::vector<std::string>& OutFiles)
+{
+	for (const std::string& Input : Inputs)
+	{
+		std::error_code Error;
+		if (fs::is_directory(Input, Error))
+		{
+			for (fs::recursive_directory_iterator It(Input, Error), End; It != End; It.increment(Error))
+			{
+				if (It->is_regular_file(Error) && It->path().extension() == ".json")
+					OutFiles.push_back(It->path().string());
+			}
+		}
+		else
+		{
+			OutFiles.push_back(Input);
+		}
+	}
+}
+
+int main(int Argc, char** Argv)
+{
+	FCommandLine Options;
+	if (!ParseCommandLine(Argc, Argv, Options))
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	const auto StartTime = std::chrono::steady_clock::now();
+
+	std::vector<std::string> Files;
+	CollectInputFiles(Options.Inputs, Files);
+
+	// Enum exports are small; reading them first gives every conversion the full name table
+	std::vector<std::string> EnumFiles;
+	for (const std::string& File : Files)
+	{
+		const std::string FileName = fs::path(File).filename().string();
+		if (FileName.size() > 10 && FileName.compare(FileName.size() - 10, 10, "_enum.json") == 0)
+			EnumFiles.push_back(File);
+	}
+
+	FEnumeratorNames EnumeratorNames;
+	std::mutex EnumeratorNamesMutex;
+	ParallelFor(EnumFiles.size(), Options.Jobs, [&](size_t Index, unsigned)
+	{
+		FJsonDocument Document;
+		if (!Document.ParseFile(EnumFiles[Index]))
+			return;
+
+		FEnumeratorNames Names;
+		CollectEnumeratorNames(Document.Root(), Names);
+
+		std::lock_guard<std::mutex> Lock(EnumeratorNamesMutex);
+		EnumeratorNames.merge(Names);
+	});
+
+	std::atomic<size_t> NumConverted{0};
+	std::atomic<size_t> NumSkipped{0};
+	std::atomic<size_t> NumFailed{0};
+	std::mutex OutputMutex;
+
+	ParallelFor(Files.size(), Options.bStdout ? 1 : Options.Jobs, [&](size_t Index, unsigned)
+	{
+		const std::string& File = Files[Index];
+
+		FJsonDocument Document;
+		if (!Document.ParseFile(File))
+		{
+			std::lock_guard<std::mutex> Lock(OutputMutex);
+			std::fprintf(stderr, "FAILED  %s: %s\n", File.c_str(), Document.GetError().c_str());
+			NumFailed++;
+			return;
+		}
+
+		FConversionResult Result;
+		if (!ConvertExport(Document.Root(), Result, &EnumeratorNames))
+		{
+			// Directory scans pick up /list responses and other JSON; only explicit files are errors
+			if (Result.Kind == EExportKind::Unknown)
+				NumSkipped++;
+			else
+				NumFailed++;
+
+			if (!Options.bQuiet || Result.Kind != EExportKind::Unknown)
+			{
+				std::lock_guard<std::mutex> Lock(OutputMutex);
+				std::fprintf(stderr, "SKIPPED %s: %s\n", File.c_str(), Result.Error.c_str());
+			}
+			return;
+		}
+
+		if (Options.bStdout)
+		{
+			std::fwrite(Result.Code.data(), 1, Result.Code.size(), stdout);
+			NumConverted++;
+			return;
+		}
+
+		fs::path OutputPath = Options.bFlat
+			? fs::path(Options.OutputDir) / fs::path(Result.RelativePath).filename()
+			: fs::path(Options.OutputDir) / Result.RelativePath;
+
+		std::error_code Error;
+		fs::create_directories(OutputPath.parent_path(), Error);
+
+		if (!WriteStringToFile(OutputPath.string(), Result.Code))
+		{
+			std::lock_guard<std::mutex> Lock(OutputMutex);
+			std::fprintf(stderr, "FAILED  %s: could not write %s\n", File.c_str(), OutputPath.string().c_str());
+			NumFailed++;
+			return;
+		}
+
+		NumConverted++;
+		if (!Options.bQuiet)
+		{
+			std::lock_guard<std::mutex> Lock(OutputMutex);
+			std::printf("%s -> %s\n", File.c_str(), OutputPath.string().c_str());
+		}
+	});
+
+	const double ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+	std::fprintf(Options.bStdout ? stderr : stdout, "bp2as: %zu converted, %zu skipped, %zu failed in %.1f ms (%u jobs)\n",
+		NumConverted.load(), NumSkipped.load(), NumFailed.load(), ElapsedMs, Options.bStdout ? 1u : Options.Jobs);
+
+	return NumFailed > 0 ? 1 : 0;
+}
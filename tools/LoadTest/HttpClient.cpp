@@ -0,0 +1,190 @@
+#include "HttpClient.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace BlueprintTools
+{
+
+static int Connect(const std::string& Host, int Port, int TimeoutMs)
+{
+	addrinfo Hints = {};
+	Hints.ai_family = AF_UNSPEC;
+	Hints.ai_socktype = SOCK_STREAM;
+
+	addrinfo* Addresses = nullptr;
+	const std::string PortString = std::to_string(Port);
+	if (getaddrinfo(Host.c_str(), PortString.c_str(), &Hints, &Addresses) != 0)
+		return -1;
+
+	int Socket = -1;
+	for (addrinfo* Address = Addresses; Address; Address = Address->ai_next)
+	{
+		Socket = socket(Address->ai_family, Address->ai_socktype, Address->ai_protocol);
+		if (Socket < 0)
+			continue;
+
+		timeval Timeout;
+		Timeout.tv_sec = TimeoutMs / 1000;
+		Timeout.tv_usec = (TimeoutMs % 1000) * 1000;
+		setsockopt(Socket, SOL_SOCKET, SO_RCVTIMEO, &Timeout, sizeof(Timeout));
+		setsockopt(Socket, SOL_SOCKET, SO_SNDTIMEO, &Timeout, sizeof(Timeout));
+
+		const int NoDelay = 1;
+		setsockopt(Socket, IPPROTO_TCP, TCP_NODELAY, &NoDelay, sizeof(NoDelay));
+
+		if (connect(Socket, Address->ai_addr, Address->ai_addrlen) == 0)
+			break;
+
+		close(Socket);
+		Socket = -1;
+	}
+
+	freeaddrinfo(Addresses);
+	return Socket;
+}
+
+static const char* GetErrnoCategory(int Error)
+{
+	if (Error == EAGAIN || Error == EWOULDBLOCK || Error == ETIMEDOUT)
+		return "timeout";
+	if (Error == ECONNRESET || Error == EPIPE)
+		return "reset";
+	return "io";
+}
+
+static bool SendAll(int Socket, const std::string& Data)
+{
+	size_t Offset = 0;
+	while (Offset < Data.size())
+	{
+		const ssize_t Sent = send(Socket, Data.data() + Offset, Data.size() - Offset, MSG_NOSIGNAL);
+		if (Sent < 0 && errno == EINTR)
+			continue;
+		if (Sent <= 0)
+			return false;
+		Offset += static_cast<size_t>(Sent);
+	}
+	return true;
+}
+
+/** Case-insensitive header lookup in the raw header block; returns -1 when missing */
+static long long FindContentLength(std::string_view Headers)
+{
+	static const char Name[] = "content-length:";
+	const size_t NameLength = sizeof(Name) - 1;
+
+	for (size_t LineStart = 0; LineStart < Headers.size();)
+	{
+		size_t LineEnd = Headers.find("\r\n", LineStart);
+		if (LineEnd == std::string_view::npos)
+			LineEnd = Headers.size();
+
+		const std::string_view Line = Headers.substr(LineStart, LineEnd - LineStart);
+		if (Line.size() > NameLength && strncasecmp(Line.data(), Name, NameLength) == 0)
+			return std::atoll(std::string(Line.substr(NameLength)).c_str());
+
+		LineStart = LineEnd + 2;
+	}
+	return -1;
+}
+
+bool HttpGet(const std::string& Host, int Port, const std::string& Target, int TimeoutMs, FHttpResponse& Out)
+{
+	Out = FHttpResponse();
+
+	const int Socket = Connect(Host, Port, TimeoutMs);
+	if (Socket < 0)
+	{
+		Out.Error = "connect";
+		return false;
+	}
+
+	const std::string Request = "GET " + Target + " HTTP/1.1\r\nHost: " + Host + ":" + std::to_string(Port) + "\r\nConnection: close\r\n\r\n";
+	if (!SendAll(Socket, Request))
+	{
+		Out.Error = GetErrnoCategory(errno);
+		close(Socket);
+		return false;
+	}
+
+	std::string Raw;
+	size_t HeaderEnd = std::string::npos;
+	long long ContentLength = -1;
+	char Buffer[16 * 1024];
+
+	for (;;)
+	{
+		const ssize_t Received = recv(Socket, Buffer, sizeof(Buffer), 0);
+		if (Received < 0 && errno == EINTR)
+			continue;
+		if (Received < 0)
+		{
+			Out.Error = GetErrnoCategory(errno);
+			close(Socket);
+			return false;
+		}
+		if (Received == 0)
+			break;
+
+		Raw.append(Buffer, static_cast<size_t>(Received));
+
+		if (HeaderEnd == std::string::npos)
+		{
+			HeaderEnd = Raw.find("\r\n\r\n");
+			if (HeaderEnd != std::string::npos)
+				ContentLength = FindContentLength(std::string_view(Raw).substr(0, HeaderEnd));
+		}
+
+		// The server may keep the connection open; stop as soon as the body is complete
+		if (HeaderEnd != std::string::npos && ContentLength >= 0 && Raw.size() >= HeaderEnd + 4 + static_cast<size_t>(ContentLength))
+			break;
+	}
+	close(Socket);
+
+	if (HeaderEnd == std::string::npos || Raw.compare(0, 5, "HTTP/") != 0)
+	{
+		Out.Error = "malformed";
+		return false;
+	}
+
+	const size_t StatusStart = Raw.find(' ');
+	Out.Status = StatusStart != std::string::npos ? std::atoi(Raw.c_str() + StatusStart + 1) : 0;
+	Out.Body = Raw.substr(HeaderEnd + 4, ContentLength >= 0 ? static_cast<size_t>(ContentLength) : std::string::npos);
+	return Out.Status != 0;
+}
+
+std::string UrlEncode(std::string_view Value)
+{
+	static const char Hex[] = "0123456789ABCDEF";
+
+	std::string Out;
+	Out.reserve(Value.size());
+	for (char C : Value)
+	{
+		const unsigned char Byte = static_cast<unsigned char>(C);
+		if ((Byte >= 'a' && Byte <= 'z') || (Byte >= 'A' && Byte <= 'Z') || (Byte >= '0' && Byte <= '9') ||
+		    Byte == '-' || Byte == '_' || Byte == '.' || Byte == '~' || Byte == '/')
+		{
+			Out += C;
+		}
+		else
+		{
+			Out += '%';
+			Out += Hex[Byte >> 4];
+			Out += Hex[Byte & 15];
+		}
+	}
+	return Out;
+}
+
+} // namespace BlueprintTools
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace BlueprintTools
+{
+
+struct FHttpResponse
+{
+	/** 0 when the request never got a status line (connect failure, timeout, reset) */
+	int Status = 0;
+	std::string Body;
+
+	/** Short failure category for reporting, e.g. "connect", "timeout", "reset" */
+	std::string Error;
+};
+
+/**
+ * Minimal blocking HTTP/1.1 GET over a fresh TCP connection per request,
+ * so every sample includes connection setup the way curl-based tools see it.
+ */
+bool HttpGet(const std::string& Host, int Port, const std::string& Target, int TimeoutMs, FHttpResponse& Out);
+
+/** Percent-encodes everything except unreserved characters and '/'. */
+std::string UrlEncode(std::string_view Value);
+
+} // namespace BlueprintTools
@@ -0,0 +1,221 @@
+#include "LoadStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+
+namespace BlueprintTools
+{
+
+// Upper bounds of the latency histogram buckets; the last bucket is unbounded
+static const double HistogramBoundsMs[] = {0.5, 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000};
+
+void FEndpointStats::AddSample(double LatencyMs, const std::string& ErrorKind)
+{
+	LatenciesMs.push_back(LatencyMs);
+	if (!ErrorKind.empty())
+	{
+		Errors++;
+		ErrorKinds[ErrorKind]++;
+	}
+}
+
+void FEndpointStats::Merge(const FEndpointStats& Other)
+{
+	LatenciesMs.insert(LatenciesMs.end(), Other.LatenciesMs.begin(), Other.LatenciesMs.end());
+	Errors += Other.Errors;
+	for (const auto& [Kind, Count] : Other.ErrorKinds)
+		ErrorKinds[Kind] += Count;
+}
+
+double GetPercentile(const std::vector<double>& Sorted, double Percentile)
+{
+	if (Sorted.empty())
+		return 0.0;
+
+	const size_t Rank = static_cast<size_t>(std::ceil(Percentile / 100.0 * Sorted.size()));
+	return Sorted[std::min(Sorted.size(), std::max<size_t>(Rank, 1)) - 1];
+}
+
+static void AppendNumber(std::string& Out, double Value)
+{
+	char Buffer[64];
+	std::snprintf(Buffer, sizeof(Buffer), "%.3f", Value);
+	Out += Buffer;
+}
+
+static void AppendEndpointJson(std::string& Out, FEndpointStats& Stats, double DurationSeconds)
+{
+	std::vector<double>& Sorted = Stats.LatenciesMs;
+	std::sort(Sorted.begin(), Sorted.end());
+
+	const size_t Requests = Sorted.size();
+	const double Mean = Requests ? std::accumulate(Sorted.begin(), Sorted.end(), 0.0) / Requests : 0.0;
+
+	Out += "{\"requests\": " + std::to_string(Requests);
+	Out += ", \"errors\": " + std::to_string(Stats.Errors);
+	Out += ", \"error_rate\": ";
+	AppendNumber(Out, Requests ? static_cast<double>(Stats.Errors) / Requests : 0.0);
+	Out += ", \"throughput_rps\": ";
+	AppendNumber(Out, DurationSeconds > 0.0 ? Requests / DurationSeconds : 0.0);
+
+	Out += ", \"latency_ms\": {\"mean\": ";
+	AppendNumber(Out, Mean);
+	Out += ", \"p50\": ";
+	AppendNumber(Out, GetPercentile(Sorted, 50));
+	Out += ", \"p90\": ";
+	AppendNumber(Out, GetPercentile(Sorted, 90));
+	Out += ", \"p99\": ";
+	AppendNumber(Out, GetPercentile(Sorted, 99));
+	Out += ", \"max\": ";
+	AppendNumber(Out, Requests ? Sorted.back() : 0.0);
+	Out += "}";
+
+	Out += ", \"histogram\": [";
+	size_t Begin = 0;
+	for (size_t Bucket = 0; Bucket <= std::size(HistogramBoundsMs); Bucket++)
+	{
+		const bool bLast = Bucket == std::size(HistogramBoundsMs);
+		const size_t End = bLast ? Requests : static_cast<size_t>(std::upper_bound(Sorted.begin(), Sorted.end(), HistogramBoundsMs[Bucket]) - Sorted.begin());
+
+		if (Bucket > 0)
+			Out += ", ";
+		Out += "{\"le_ms\": ";
+		if (bLast)
+			Out += "\"+Inf\"";
+		else
+			AppendNumber(Out, HistogramBoundsMs[Bucket]);
+		Out += ", \"count\": " + std::to_string(End - Begin) + "}";
+
+		Begin = End;
+	}
+	Out += "]";
+
+	Out += ", \"error_kinds\": {";
+	bool bFirst = true;
+	for (const auto& [Kind, Count] : Stats.ErrorKinds)
+	{
+		if (!bFirst)
+			Out += ", ";
+		bFirst = false;
+		AppendJsonString(Out, Kind);
+		Out += ": " + std::to_string(Count);
+	}
+	Out += "}}";
+}
+
+std::string BuildResultsJson(FLoadTestReport& Report)
+{
+	std::string Out = "{\n  \"format\": \"bp_loadtest\",\n  \"version\": 1,\n  \"config\": {";
+
+	bool bFirst = true;
+	for (const auto& [Key, Value] : Report.Config)
+	{
+		Out += bFirst ? "\n    " : ",\n    ";
+		bFirst = false;
+		AppendJsonString(Out, Key);
+		Out += ": ";
+		AppendJsonString(Out, Value);
+	}
+	Out += "\n  },\n  \"duration_s\": ";
+	AppendNumber(Out, Report.DurationSeconds);
+
+	Out += ",\n  \"endpoints\": {";
+	bFirst = true;
+	for (auto& [Name, Stats] : Report.Endpoints)
+	{
+		Out += bFirst ? "\n    " : ",\n    ";
+		bFirst = false;
+		AppendJsonString(Out, Name);
+		Out += ": ";
+		AppendEndpointJson(Out, Stats, Report.DurationSeconds);
+	}
+	Out += "\n  },\n  \"stall_probe\": ";
+	AppendEndpointJson(Out, Report.StallProbe, Report.DurationSeconds);
+	Out += "\n}\n";
+
+	return Out;
+}
+
+static void PrintEndpointRow(const char* Name, FEndpointStats& Stats, double DurationSeconds)
+{
+	std::vector<double>& Sorted = Stats.LatenciesMs;
+	std::sort(Sorted.begin(), Sorted.end());
+
+	const size_t Requests = Sorted.size();
+	std::printf("%-16s %8zu %8.1f %9.2f %9.2f %9.2f %9.2f %7.2f%%\n", Name, Requests,
+		DurationSeconds > 0.0 ? Requests / DurationSeconds : 0.0,
+		GetPercentile(Sorted, 50), GetPercentile(Sorted, 90), GetPercentile(Sorted, 99), Requests ? Sorted.back() : 0.0,
+		Requests ? 100.0 * Stats.Errors / Requests : 0.0);
+
+	for (const auto& [Kind, Count] : Stats.ErrorKinds)
+		std::printf("%-16s   %s: %llu\n", "", Kind.c_str(), static_cast<unsigned long long>(Count));
+}
+
+void PrintReport(FLoadTestReport& Report)
+{
+	std::printf("%-16s %8s %8s %9s %9s %9s %9s %8s\n", "endpoint", "requests", "rps", "p50 ms", "p90 ms", "p99 ms", "max ms", "errors");
+	for (auto& [Name, Stats] : Report.Endpoints)
+		PrintEndpointRow(Name.c_str(), Stats, Report.DurationSeconds);
+	PrintEndpointRow("(stall probe)", Report.StallProbe, Report.DurationSeconds);
+}
+
+static int CompareEndpoint(const std::string& Name, const FJsonNode& Baseline, const FJsonNode& Current, const FCompareOptions& Options)
+{
+	int Regressions = 0;
+
+	const FJsonNode* BaselineLatency = Baseline.Find("latency_ms");
+	const FJsonNode* CurrentLatency = Current.Find("latency_ms");
+	for (const char* Metric : {"p50", "p99"})
+	{
+		const double Before = BaselineLatency ? BaselineLatency->GetNumber(Metric) : 0.0;
+		const double After = CurrentLatency ? CurrentLatency->GetNumber(Metric) : 0.0;
+		const bool bRegressed = After - Before > Options.MinLatencyDeltaMs && After > Before * (1.0 + Options.LatencyThreshold);
+		Regressions += bRegressed ? 1 : 0;
+
+		std::printf("%-16s %-10s %10.2f %10.2f %+8.1f%%%s\n", Name.c_str(), Metric, Before, After,
+			Before > 0.0 ? 100.0 * (After - Before) / Before : 0.0, bRegressed ? "  REGRESSION" : "");
+	}
+
+	const double Before = Baseline.GetNumber("error_rate");
+	const double After = Current.GetNumber("error_rate");
+	const bool bRegressed = After - Before > Options.ErrorRateThreshold;
+	Regressions += bRegressed ? 1 : 0;
+
+	std::printf("%-16s %-10s %9.2f%% %9.2f%%%s\n", Name.c_str(), "errors", 100.0 * Before, 100.0 * After, bRegressed ? "  REGRESSION" : "");
+	return Regressions;
+}
+
+int CompareResults(const FJsonNode& Baseline, const FJsonNode& Current, const FCompareOptions& Options)
+{
+	std::printf("%-16s %-10s %10s %10s %9s\n", "endpoint", "metric", "baseline", "current", "change");
+
+	int Regressions = 0;
+
+	const FJsonNode* BaselineEndpoints = Baseline.Find("endpoints");
+	const FJsonNode* CurrentEndpoints = Current.Find("endpoints");
+	if (BaselineEndpoints && CurrentEndpoints && CurrentEndpoints->IsObject())
+	{
+		for (uint32_t i = 0; i < CurrentEndpoints->Count; i++)
+		{
+			const std::string Name(CurrentEndpoints->Keys[i]);
+			const FJsonNode* Before = BaselineEndpoints->Find(Name);
+			if (!Before)
+			{
+				std::printf("%-16s (not in baseline)\n", Name.c_str());
+				continue;
+			}
+			Regressions += CompareEndpoint(Name, *Before, CurrentEndpoints->Children[i], Options);
+		}
+	}
+
+	const FJsonNode* BaselineProbe = Baseline.Find("stall_probe");
+	const FJsonNode* CurrentProbe = Current.Find("stall_probe");
+	if (BaselineProbe && CurrentProbe)
+		Regressions += CompareEndpoint("(stall probe)", *BaselineProbe, *CurrentProbe, Options);
+
+	return Regressions;
+}
+
+} // namespace BlueprintTools
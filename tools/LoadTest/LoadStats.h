@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Json.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace BlueprintTools
+{
+
+/** Samples and failures for one endpoint; one per worker, merged after the run. */
+struct FEndpointStats
+{
+	std::vector<double> LatenciesMs;
+	uint64_t Errors = 0;
+
+	/** Failure category ("http_500", "timeout", "success_false", ...) to count */
+	std::map<std::string, uint64_t> ErrorKinds;
+
+	void AddSample(double LatencyMs, const std::string& ErrorKind);
+	void Merge(const FEndpointStats& Other);
+};
+
+struct FLoadTestReport
+{
+	/** Free-form run description copied into the results (host, concurrency, mix, ...) */
+	std::map<std::string, std::string> Config;
+
+	double DurationSeconds = 0.0;
+	std::map<std::string, FEndpointStats> Endpoints;
+
+	/** /ping samples from the dedicated probe thread; rising latency means the game thread is stalling */
+	FEndpointStats StallProbe;
+};
+
+/** Nearest-rank percentile of an ascending-sorted sample array; 0 when empty. */
+double GetPercentile(const std::vector<double>& Sorted, double Percentile);
+
+/** Results as JSON, stable across runs so two files can be diffed or passed to CompareResults. */
+std::string BuildResultsJson(FLoadTestReport& Report);
+
+void PrintReport(FLoadTestReport& Report);
+
+struct FCompareOptions
+{
+	/** Relative latency increase (0.10 = 10%) that counts as a regression */
+	double LatencyThreshold = 0.10;
+
+	/** Absolute floor below which latency differences are treated as noise */
+	double MinLatencyDeltaMs = 1.0;
+
+	/** Absolute error rate increase that counts as a regression */
+	double ErrorRateThreshold = 0.01;
+};
+
+/** Prints a per-endpoint comparison and returns the number of regressions found. */
+int CompareResults(const FJsonNode& Baseline, const FJsonNode& Current, const FCompareOptions& Options);
+
+} // namespace BlueprintTools
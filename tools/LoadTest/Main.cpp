@@ -0,0 +1,420 @@
+// bp_loadtest: concurrent load generator for the BlueprintExporter HTTP API.
+//
+//   bp_loadtest [options]                          run against a live editor
+//   bp_loadtest --compare <baseline.json> <current.json>
+//
+// Worker threads issue a weighted mix of /ping, /list, /export, /export-struct and
+// /export-enum requests over a chosen asset set. A separate probe thread pings at a
+// fixed interval: /ping is answered on the editor's game thread, so its latency
+// tracks how long the game thread stalls while the other requests are served.
+
+#include "HttpClient.h"
+#include "Json.h"
+#include "LoadStats.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace BlueprintTools;
+using FClock = std::chrono::steady_clock;
+
+static const char* const EndpointNames[] = {"ping", "list", "export", "export-struct", "export-enum"};
+
+enum EEndpoint
+{
+	Endpoint_Ping,
+	Endpoint_List,
+	Endpoint_Export,
+	Endpoint_ExportStruct,
+	Endpoint_ExportEnum,
+	Endpoint_Count
+};
+
+struct FCommandLine
+{
+	std::string Host = "127.0.0.1";
+	int Port = 7233;
+	unsigned Concurrency = 8;
+	double DurationSeconds = 30.0;
+	double WarmupSeconds = 2.0;
+	std::string Mix = "ping=1,list=1,export=4,export-struct=1,export-enum=1";
+	std::string Filter;
+	std::string ExportQuery;
+	std::string BlueprintsFile;
+	std::string StructsFile;
+	std::string EnumsFile;
+	int ProbeIntervalMs = 100;
+	int TimeoutMs = 30000;
+	unsigned Seed = 1;
+	std::string OutputFile;
+
+	std::vector<std::string> CompareFiles;
+	FCompareOptions Compare;
+};
+
+static void PrintUsage()
+{
+	std::fprintf(stderr,
+		"Usage: bp_loadtest [options]\n"
+		"       bp_loadtest --compare <baseline.json> <current.json> [--threshold <pct>]\n"
+		"\n"
+		"Load-tests a running editor's BlueprintExporter HTTP server.\n"
+		"\n"
+		"Options:\n"
+		"      --host <host>          Editor host (default: 127.0.0.1)\n"
+		"      --port <port>          Editor port (default: 7233)\n"
+		"  -c, --concurrency <n>      Concurrent clients (default: 8)\n"
+		"  -d, --duration <s>         Measured run time in seconds (default: 30)\n"
+		"      --warmup <s>           Unmeasured time before the run (default: 2)\n"
+		"      --mix <spec>           Endpoint weights (default: ping=1,list=1,export=4,export-struct=1,export-enum=1)\n"
+		"      --blueprints <file>    Blueprint paths for /export, one per line (default: discovered via /list)\n"
+		"      --structs <file>       UserDefinedStruct paths for /export-struct\n"
+		"      --enums <file>         UserDefinedEnum paths for /export-enum\n"
+		"      --filter <text>        Filter for /list and Blueprint discovery\n"
+		"      --export-query <q>     Extra query string for /export, e.g. \"prune=1&compress=gzip\"\n"
+		"      --probe-interval <ms>  Stall probe /ping interval, 0 to disable (default: 100)\n"
+		"      --timeout <ms>         Per-request timeout (default: 30000)\n"
+		"      --seed <n>             Random seed for the request sequence (default: 1)\n"
+		"  -o, --out <file>           Write results JSON\n"
+		"      --threshold <pct>      Latency regression threshold for --compare (default: 10)\n");
+}
+
+static bool ParseCommandLine(int Argc, char** Argv, FCommandLine& Out)
+{
+	for (int i = 1; i < Argc; i++)
+	{
+		const char* Arg = Argv[i];
+		auto NextValue = [&](const char*& Value) -> bool
+		{
+			if (i + 1 >= Argc)
+			{
+				std::fprintf(stderr, "bp_loadtest: %s expects a value\n", Arg);
+				return false;
+			}
+			Value = Argv[++i];
+			return true;
+		};
+
+		const char* Value = nullptr;
+		if (!std::strcmp(Arg, "--compare"))
+		{
+			if (i + 2 >= Argc)
+			{
+				std::fprintf(stderr, "bp_loadtest: --compare expects two files\n");
+				return false;
+			}
+			Out.CompareFiles = {Argv[i + 1], Argv[i + 2]};
+			i += 2;
+		}
+		else if (!std::strcmp(Arg, "-h") || !std::strcmp(Arg, "--help"))
+			return false;
+		else if (Arg[0] != '-' || !NextValue(Value))
+		{
+			if (Arg[0] != '-')
+				std::fprintf(stderr, "bp_loadtest: unexpected argument %s\n", Arg);
+			return false;
+		}
+		else if (!std::strcmp(Arg, "--host"))
+			Out.Host = Value;
+		else if (!std::strcmp(Arg, "--port"))
+			Out.Port = std::atoi(Value);
+		else if (!std::strcmp(Arg, "-c") || !std::strcmp(Arg, "--concurrency"))
+			Out.Concurrency = static_cast<unsigned>(std::max(1, std::atoi(Value)));
+		else if (!std::strcmp(Arg, "-d") || !std::strcmp(Arg, "--duration"))
+			Out.DurationSeconds = std::max(0.1, std::atof(Value));
+		else if (!std::strcmp(Arg, "--warmup"))
+			Out.WarmupSeconds = std::max(0.0, std::atof(Value));
+		else if (!std::strcmp(Arg, "--mix"))
+			Out.Mix = Value;
+		else if (!std::strcmp(Arg, "--blueprints"))
+			Out.BlueprintsFile = Value;
+		else if (!std::strcmp(Arg, "--structs"))
+			Out.StructsFile = Value;
+		else if (!std::strcmp(Arg, "--enums"))
+			Out.EnumsFile = Value;
+		else if (!std::strcmp(Arg, "--filter"))
+			Out.Filter = Value;
+		else if (!std::strcmp(Arg, "--export-query"))
+			Out.ExportQuery = Value;
+		else if (!std::strcmp(Arg, "--probe-interval"))
+			Out.ProbeIntervalMs = std::max(0, std::atoi(Value));
+		else if (!std::strcmp(Arg, "--timeout"))
+			Out.TimeoutMs = std::max(1, std::atoi(Value));
+		else if (!std::strcmp(Arg, "--seed"))
+			Out.Seed = static_cast<unsigned>(std::strtoul(Value, nullptr, 10));
+		else if (!std::strcmp(Arg, "-o") || !std::strcmp(Arg, "--out"))
+			Out.OutputFile = Value;
+		else if (!std::strcmp(Arg, "--threshold"))
+			Out.Compare.LatencyThreshold = std::max(0.0, std::atof(Value)) / 100.0;
+		else
+		{
+			std::fprintf(stderr, "bp_loadtest: unknown option %s\n", Arg);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool ParseMix(const std::string& Spec, double (&OutWeights)[Endpoint_Count])
+{
+	std::fill(std::begin(OutWeights), std::end(OutWeights), 0.0);
+
+	size_t Start = 0;
+	while (Start <= Spec.size())
+	{
+		size_t End = Spec.find(',', Start);
+		if (End == std::string::npos)
+			End = Spec.size();
+
+		const std::string Entry = Spec.substr(Start, End - Start);
+		const size_t Equals = Entry.find('=');
+		const std::string Name = Entry.substr(0, Equals);
+		const double Weight = Equals != std::string::npos ? std::atof(Entry.c_str() + Equals + 1) : 1.0;
+
+		const auto Found = std::find_if(std::begin(EndpointNames), std::end(EndpointNames), [&](const char* Known) { return Name == Known; });
+		if (Found == std::end(EndpointNames) || Weight < 0.0)
+		{
+			std::fprintf(stderr, "bp_loadtest: bad mix entry '%s'\n", Entry.c_str());
+			return false;
+		}
+		OutWeights[Found - std::begin(EndpointNames)] = Weight;
+
+		Start = End + 1;
+	}
+	return true;
+}
+
+static bool ReadAssetList(const std::string& Path, std::vector<std::string>& Out)
+{
+	std::string Text;
+	if (!ReadFileToString(Path, Text))
+	{
+		std::fprintf(stderr, "bp_loadtest: could not read %s\n", Path.c_str());
+		return false;
+	}
+
+	size_t Start = 0;
+	while (Start < Text.size())
+	{
+		size_t End = Text.find('\n', Start);
+		if (End == std::string::npos)
+			End = Text.size();
+
+		std::string Line = Text.substr(Start, End - Start);
+		while (!Line.empty() && (Line.back() == '\r' || Line.back() == ' ' || Line.back() == '\t'))
+			Line.pop_back();
+		if (!Line.empty() && Line[0] != '#')
+			Out.push_back(Line);
+
+		Start = End + 1;
+	}
+	return true;
+}
+
+static bool DiscoverBlueprints(const FCommandLine& Options, std::vector<std::string>& Out)
+{
+	FHttpResponse Response;
+	const std::string Target = "/list?filter=" + UrlEncode(Options.Filter);
+	if (!HttpGet(Options.Host, Options.Port, Target, Options.TimeoutMs, Response) || Response.Status != 200)
+	{
+		std::fprintf(stderr, "bp_loadtest: /list failed (%s); is the editor running on %s:%d?\n",
+			Response.Error.empty() ? ("HTTP " + std::to_string(Response.Status)).c_str() : Response.Error.c_str(), Options.Host.c_str(), Options.Port);
+		return false;
+	}
+
+	FJsonDocument Document;
+	if (!Document.Parse(std::move(Response.Body)))
+	{
+		std::fprintf(stderr, "bp_loadtest: bad /list response: %s\n", Document.GetError().c_str());
+		return false;
+	}
+
+	for (const FJsonNode& Path : Document.Root().GetArray("blueprints"))
+		Out.emplace_back(Path.String);
+	return true;
+}
+
+/** Empty when the request succeeded, otherwise a short failure category */
+static std::string ClassifyResponse(bool bReceived, FHttpResponse& Response)
+{
+	if (!bReceived)
+		return Response.Error.empty() ? "io" : Response.Error;
+	if (Response.Status != 200)
+		return "http_" + std::to_string(Response.Status);
+
+	FJsonDocument Document;
+	if (!Document.Parse(std::move(Response.Body)))
+		return "bad_json";
+	if (!Document.Root().GetBool("success", true))
+		return "success_false";
+	return {};
+}
+
+static int RunCompare(const FCommandLine& Options)
+{
+	FJsonDocument Baseline;
+	FJsonDocument Current;
+	if (!Baseline.ParseFile(Options.CompareFiles[0]) || !Current.ParseFile(Options.CompareFiles[1]))
+	{
+		std::fprintf(stderr, "bp_loadtest: %s\n", !Baseline.GetError().empty() ? Baseline.GetError().c_str() : Current.GetError().c_str());
+		return 2;
+	}
+
+	const int Regressions = CompareResults(Baseline.Root(), Current.Root(), Options.Compare);
+	std::printf("bp_loadtest: %d regression%s\n", Regressions, Regressions == 1 ? "" : "s");
+	return Regressions > 0 ? 1 : 0;
+}
+
+int main(int Argc, char** Argv)
+{
+	FCommandLine Options;
+	if (!ParseCommandLine(Argc, Argv, Options))
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	if (!Options.CompareFiles.empty())
+		return RunCompare(Options);
+
+	double Weights[Endpoint_Count];
+	if (!ParseMix(Options.Mix, Weights))
+		return 2;
+
+	std::vector<std::string> Assets[Endpoint_Count];
+	if (!Options.BlueprintsFile.empty() && !ReadAssetList(Options.BlueprintsFile, Assets[Endpoint_Export]))
+		return 2;
+	if (!Options.StructsFile.empty() && !ReadAssetList(Options.StructsFile, Assets[Endpoint_ExportStruct]))
+		return 2;
+	if (!Options.EnumsFile.empty() && !ReadAssetList(Options.EnumsFile, Assets[Endpoint_ExportEnum]))
+		return 2;
+
+	if (Weights[Endpoint_Export] > 0.0 && Assets[Endpoint_Export].empty() && !DiscoverBlueprints(Options, Assets[Endpoint_Export]))
+		return 1;
+
+	for (int Endpoint : {Endpoint_Export, Endpoint_ExportStruct, Endpoint_ExportEnum})
+	{
+		if (Weights[Endpoint] > 0.0 && Assets[Endpoint].empty())
+		{
+			std::fprintf(stderr, "bp_loadtest: no assets for %s; dropping it from the mix\n", EndpointNames[Endpoint]);
+			Weights[Endpoint] = 0.0;
+		}
+	}
+
+	if (std::all_of(std::begin(Weights), std::end(Weights), [](double Weight) { return Weight <= 0.0; }))
+	{
+		std::fprintf(stderr, "bp_loadtest: request mix is empty\n");
+		return 2;
+	}
+
+	const FClock::time_point StartTime = FClock::now();
+	const FClock::time_point MeasureStart = StartTime + std::chrono::duration_cast<FClock::duration>(std::chrono::duration<double>(Options.WarmupSeconds));
+	const FClock::time_point EndTime = MeasureStart + std::chrono::duration_cast<FClock::duration>(std::chrono::duration<double>(Options.DurationSeconds));
+
+	std::vector<std::array<FEndpointStats, Endpoint_Count>> WorkerStats(Options.Concurrency);
+	std::vector<std::thread> Workers;
+
+	for (unsigned Worker = 0; Worker < Options.Concurrency; Worker++)
+	{
+		Workers.emplace_back([&, Worker]()
+		{
+			std::mt19937 Random(Options.Seed + Worker);
+			std::discrete_distribution<int> PickEndpoint(std::begin(Weights), std::end(Weights));
+
+			for (FClock::time_point Now = FClock::now(); Now < EndTime; Now = FClock::now())
+			{
+				const int Endpoint = PickEndpoint(Random);
+
+				std::string Target = std::string("/") + EndpointNames[Endpoint];
+				if (Endpoint == Endpoint_List)
+					Target += "?filter=" + UrlEncode(Options.Filter);
+				else if (Endpoint != Endpoint_Ping)
+				{
+					const std::vector<std::string>& Paths = Assets[Endpoint];
+					Target += "?path=" + UrlEncode(Paths[std::uniform_int_distribution<size_t>(0, Paths.size() - 1)(Random)]);
+					if (Endpoint == Endpoint_Export && !Options.ExportQuery.empty())
+						Target += "&" + Options.ExportQuery;
+				}
+
+				FHttpResponse Response;
+				const bool bReceived = HttpGet(Options.Host, Options.Port, Target, Options.TimeoutMs, Response);
+				const FClock::time_point Finished = FClock::now();
+				const std::string ErrorKind = ClassifyResponse(bReceived, Response);
+
+				if (Now >= MeasureStart)
+					WorkerStats[Worker][Endpoint].AddSample(std::chrono::duration<double, std::milli>(Finished - Now).count(), ErrorKind);
+			}
+		});
+	}
+
+	FEndpointStats ProbeStats;
+	std::thread Probe([&]()
+	{
+		if (Options.ProbeIntervalMs <= 0)
+			return;
+
+		for (FClock::time_point Now = FClock::now(); Now < EndTime; Now = FClock::now())
+		{
+			FHttpResponse Response;
+			const bool bReceived = HttpGet(Options.Host, Options.Port, "/ping", Options.TimeoutMs, Response);
+			const FClock::time_point Finished = FClock::now();
+
+			if (Now >= MeasureStart)
+				ProbeStats.AddSample(std::chrono::duration<double, std::milli>(Finished - Now).count(), ClassifyResponse(bReceived, Response));
+
+			std::this_thread::sleep_until(Now + std::chrono::milliseconds(Options.ProbeIntervalMs));
+		}
+	});
+
+	for (std::thread& Thread : Workers)
+		Thread.join();
+	Probe.join();
+
+	FLoadTestReport Report;
+	Report.DurationSeconds = std::chrono::duration<double>(std::max(FClock::now(), EndTime) - MeasureStart).count();
+	Report.StallProbe = std::move(ProbeStats);
+
+	for (int Endpoint = 0; Endpoint < Endpoint_Count; Endpoint++)
+	{
+		if (Weights[Endpoint] <= 0.0)
+			continue;
+
+		FEndpointStats& Merged = Report.Endpoints[EndpointNames[Endpoint]];
+		for (const auto& Stats : WorkerStats)
+			Merged.Merge(Stats[Endpoint]);
+	}
+
+	Report.Config["host"] = Options.Host + ":" + std::to_string(Options.Port);
+	Report.Config["concurrency"] = std::to_string(Options.Concurrency);
+	Report.Config["mix"] = Options.Mix;
+	Report.Config["filter"] = Options.Filter;
+	Report.Config["export_query"] = Options.ExportQuery;
+	Report.Config["blueprints"] = std::to_string(Assets[Endpoint_Export].size());
+	Report.Config["structs"] = std::to_string(Assets[Endpoint_ExportStruct].size());
+	Report.Config["enums"] = std::to_string(Assets[Endpoint_ExportEnum].size());
+	Report.Config["seed"] = std::to_string(Options.Seed);
+
+	PrintReport(Report);
+
+	if (!Options.OutputFile.empty())
+	{
+		if (!WriteStringToFile(Options.OutputFile, BuildResultsJson(Report)))
+		{
+			std::fprintf(stderr, "bp_loadtest: could not write %s\n", Options.OutputFile.c_str());
+			return 1;
+		}
+		std::printf("bp_loadtest: results written to %s\n", Options.OutputFile.c_str());
+	}
+
+	return 0;
+}
@@ -0,0 +1,331 @@
+// bp_asverify: offline compile check for generated AngelScript, on a stock AngelScript engine.
+//
+//   bp_asverify [-e <exports>]... [-j <Jobs>] [--print-stubs] <script.as | directory>...
+//
+// Every script is scanned first, so declarations made by other files in the run are known;
+// anything still missing gets a stub from the exporter JSON passed with -e (the same /export,
+// /export-struct and /export-enum documents bp2as converts). Files then compile in parallel,
+// one engine per worker, each together with the stubs and the files it references.
+
+#include "Json.h"
+#include "ScriptCompiler.h"
+#include "ScriptPreprocessor.h"
+#include "StubGenerator.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace BlueprintTools;
+
+static const char* StubSectionName = "<stubs>";
+
+struct FCommandLine
+{
+	std::vector<std::string> Inputs;
+	std::vector<std::string> Exports;
+	unsigned Jobs = GetDefaultWorkerCount();
+	bool bPrintStubs = false;
+	bool bQuiet = false;
+};
+
+struct FScriptFile
+{
+	std::string Path;
+	std::string Source;
+	FScriptScan Scan;
+	FScriptSection Section;
+	bool bLoaded = false;
+
+	/** Other files declaring types this one uses, transitively */
+	std::vector<size_t> Dependencies;
+};
+
+static void PrintUsage()
+{
+	std::fprintf(stderr,
+		"Usage: bp_asverify [options] <script.as | directory>...\n"
+		"\n"
+		"Compiles generated AngelScript against stubs of the native types it uses and reports errors per file.\n"
+		"\n"
+		"Options:\n"
+		"  -e, --exports <path>  Exporter JSON file or directory to build stubs from (repeatable)\n"
+		"  -j, --jobs <n>        Worker threads (default: hardware concurrency)\n"
+		"      --print-stubs     Print the generated stub declarations and exit\n"
+		"  -q, --quiet           Only print failures and the summary\n");
+}
+
+static bool ParseCommandLine(int Argc, char** Argv, FCommandLine& Out)
+{
+	for (int i = 1; i < Argc; i++)
+	{
+		const char* Arg = Argv[i];
+		auto NextValue = [&](const char*& Value) -> bool
+		{
+			if (i + 1 >= Argc)
+			{
+				std::fprintf(stderr, "bp_asverify: %s expects a value\n", Arg);
+				return false;
+			}
+			Value = Argv[++i];
+			return true;
+		};
+
+		const char* Value = nullptr;
+		if (!std::strcmp(Arg, "-e") || !std::strcmp(Arg, "--exports"))
+		{
+			if (!NextValue(Value))
+				return false;
+			Out.Exports.push_back(Value);
+		}
+		else if (!std::strcmp(Arg, "-j") || !std::strcmp(Arg, "--jobs"))
+		{
+			if (!NextValue(Value))
+				return false;
+			Out.Jobs = static_cast<unsigned>(std::max(1, std::atoi(Value)));
+		}
+		else if (!std::strcmp(Arg, "--print-stubs"))
+			Out.bPrintStubs = true;
+		else if (!std::strcmp(Arg, "-q") || !std::strcmp(Arg, "--quiet"))
+			Out.bQuiet = true;
+		else if (!std::strcmp(Arg, "-h") || !std::strcmp(Arg, "--help"))
+			return false;
+		else if (Arg[0] == '-')
+		{
+			std::fprintf(stderr, "bp_asverify: unknown option %s\n", Arg);
+			return false;
+		}
+		else
+			Out.Inputs.push_back(Arg);
+	}
+
+	return !Out.Inputs.empty() || Out.bPrintStubs;
+}
+
+static void CollectInputFiles(const std::vector<std::string>& Inputs, const char* Extension, std::vector<std::string>& OutFiles)
+{
+	for (const std::string& Input : Inputs)
+	{
+		std::error_code Error;
+		if (fs::is_directory(Input, Error))
+		{
+			for (fs::recursive_directory_iterator It(Input, Error), End; It != End; It.increment(Error))
+			{
+				if (It->is_regular_file(Error) && It->path().extension() == Extension)
+					OutFiles.push_back(It->path().string());
+			}
+		}
+		else
+		{
+			OutFiles.push_back(Input);
+		}
+	}
+}
+
+static void AppendMessage(std::string& Out, const FCompileMessage& Message)
+{
+	Out += "  " + Message.Section + ":" + std::to_string(Message.Row) + ":" + std::to_string(Message.Column)
+		+ (Message.bError ? ": error: " : ": warning: ") + Message.Text + "\n";
+}
+
+int main(int Argc, char** Argv)
+{
+	FCommandLine Options;
+	if (!ParseCommandLine(Argc, Argv, Options))
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	const auto StartTime = std::chrono::steady_clock::now();
+
+	std::vector<std::string> ScriptPaths;
+	CollectInputFiles(Options.Inputs, ".as", ScriptPaths);
+
+	std::vector<std::string> ExportPaths;
+	CollectInputFiles(Options.Exports, ".json", ExportPaths);
+
+	std::mutex OutputMutex;
+	std::atomic<size_t> NumFailed{0};
+
+	// Pass 1: read and scan scripts, gather stub members from exports
+	std::vector<FScriptFile> Files(ScriptPaths.size());
+	ParallelFor(Files.size(), Options.Jobs, [&](size_t Index, unsigned)
+	{
+		FScriptFile& File = Files[Index];
+		File.Path = ScriptPaths[Index];
+		if (!ReadFileToString(File.Path, File.Source))
+		{
+			std::lock_guard<std::mutex> Lock(OutputMutex);
+			std::fprintf(stderr, "FAILED  %s: could not read file\n", File.Path.c_str());
+			NumFailed++;
+			return;
+		}
+		ScanScript(File.Source, File.Scan);
+		File.bLoaded = true;
+	});
+
+	FStubCatalogue Stubs;
+	std::mutex StubsMutex;
+	ParallelFor(ExportPaths.size(), Options.Jobs, [&](size_t Index, unsigned)
+	{
+		FJsonDocument Document;
+		if (!Document.ParseFile(ExportPaths[Index]))
+		{
+			std::lock_guard<std::mutex> Lock(OutputMutex);
+			std::fprintf(stderr, "SKIPPED %s: %s\n", ExportPaths[Index].c_str(), Document.GetError().c_str());
+			return;
+		}
+
+		std::lock_guard<std::mutex> Lock(StubsMutex);
+		Stubs.AddExport(Document.Root());
+	});
+
+	std::unordered_map<std::string, size_t> DeclaringFile;
+	std::unordered_set<std::string> ScriptTypes;
+	for (size_t i = 0; i < Files.size(); i++)
+	{
+		Stubs.AddScriptScan(Files[i].Scan);
+		for (const std::string& Type : Files[i].Scan.DeclaredTypes)
+		{
+			ScriptTypes.insert(Type);
+			if (!DeclaringFile.emplace(Type, i).second && !Options.bQuiet)
+				std::fprintf(stderr, "warning: %s is declared in both %s and %s\n", Type.c_str(), Files[DeclaringFile[Type]].Path.c_str(), Files[i].Path.c_str());
+		}
+	}
+	Stubs.Finalize(ScriptTypes);
+
+	const std::string StubSource = Stubs.GenerateSource();
+	if (Options.bPrintStubs)
+	{
+		std::fwrite(StubSource.data(), 1, StubSource.size(), stdout);
+		return 0;
+	}
+
+	std::unordered_set<std::string> HandleTypes;
+	Stubs.GetObjectTypes(HandleTypes);
+	for (const std::string& Type : ScriptTypes)
+	{
+		if (IsObjectTypeName(Type))
+			HandleTypes.insert(Type);
+	}
+
+	const FScriptSection StubSection{StubSectionName, PreprocessScript(StubSource, HandleTypes)};
+
+	ParallelFor(Files.size(), Options.Jobs, [&](size_t Index, unsigned)
+	{
+		FScriptFile& File = Files[Index];
+		if (!File.bLoaded)
+			return;
+
+		File.Section.Name = File.Path;
+		File.Section.Code = PreprocessScript(File.Source, HandleTypes);
+
+		std::vector<size_t> Pending = {Index};
+		std::unordered_set<size_t> Visited = {Index};
+		while (!Pending.empty())
+		{
+			const size_t Current = Pending.back();
+			Pending.pop_back();
+			for (const std::string& Type : Files[Current].Scan.ReferencedTypes)
+			{
+				auto It = DeclaringFile.find(Type);
+				if (It != DeclaringFile.end() && Visited.insert(It->second).second)
+				{
+					File.Dependencies.push_back(It->second);
+					Pending.push_back(It->second);
+				}
+			}
+		}
+	});
+
+	// The stubs are shared by every file; if they don't compile nothing will
+	{
+		FScriptCompiler Compiler;
+		std::vector<FCompileMessage> Messages;
+		if (!Compiler.GetSetupError().empty())
+		{
+			std::fprintf(stderr, "bp_asverify: engine setup failed: %s\n", Compiler.GetSetupError().c_str());
+			return 1;
+		}
+		if (!Compiler.Compile({&StubSection}, Messages))
+		{
+			std::string Report;
+			for (const FCompileMessage& Message : Messages)
+				AppendMessage(Report, Message);
+			std::fprintf(stderr, "bp_asverify: generated stubs do not compile (see --print-stubs)\n%s", Report.c_str());
+			return 1;
+		}
+	}
+
+	// Pass 2: compile each file with the stubs and its dependencies, one engine per worker
+	std::vector<std::unique_ptr<FScriptCompiler>> Compilers(Options.Jobs);
+	std::atomic<size_t> NumPassed{0};
+
+	ParallelFor(Files.size(), Options.Jobs, [&](size_t Index, unsigned Worker)
+	{
+		const FScriptFile& File = Files[Index];
+		if (!File.bLoaded)
+			return;
+
+		if (!Compilers[Worker])
+			Compilers[Worker] = std::make_unique<FScriptCompiler>();
+
+		std::vector<const FScriptSection*> Sections = {&StubSection, &File.Section};
+		for (size_t Dependency : File.Dependencies)
+			Sections.push_back(&Files[Dependency].Section);
+
+		std::vector<FCompileMessage> Messages;
+		const bool bSuccess = Compilers[Worker]->Compile(Sections, Messages);
+
+		std::string Report;
+		std::string FailedDependency;
+		for (const FCompileMessage& Message : Messages)
+		{
+			if (Message.Section == File.Path)
+			{
+				if (Message.bError || !Options.bQuiet)
+					AppendMessage(Report, Message);
+			}
+			else if (Message.bError && FailedDependency.empty())
+				FailedDependency = Message.Section;
+		}
+
+		if (bSuccess)
+		{
+			NumPassed++;
+			if (Options.bQuiet)
+				return;
+			Report = "OK      " + File.Path + "\n" + Report;
+		}
+		else
+		{
+			NumFailed++;
+			Report = "FAILED  " + File.Path + "\n" + Report;
+			if (!FailedDependency.empty())
+				Report += "  errors in dependency " + FailedDependency + "\n";
+		}
+
+		std::lock_guard<std::mutex> Lock(OutputMutex);
+		std::fwrite(Report.data(), 1, Report.size(), bSuccess ? stdout : stderr);
+	});
+
+	const double ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+	std::printf("bp_asverify: %zu passed, %zu failed in %.1f ms (%u jobs)\n",
+		NumPassed.load(), NumFailed.load(), ElapsedMs, Options.Jobs);
+
+	return NumFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,242 @@
+#include "ScriptCompiler.h"
+
+#include <angelscript.h>
+
+#include <initializer_list>
+#include <utility>
+
+namespace BlueprintTools
+{
+
+/** Every registered function; scripts are only compiled, never executed */
+static void CompileOnlyStub(asIScriptGeneric*)
+{
+}
+
+/** String literals compile to FString constants; their contents are never needed */
+class FStubStringFactory : public asIStringFactory
+{
+public:
+	const void* GetStringConstant(const char*, asUINT) override { return &Placeholder; }
+	int ReleaseStringConstant(const void*) override { return asSUCCESS; }
+
+	int GetRawStringData(const void*, char*, asUINT* Length) const override
+	{
+		if (Length)
+			*Length = 0;
+		return asSUCCESS;
+	}
+
+private:
+	char Placeholder = 0;
+};
+
+static FStubStringFactory StringFactory;
+
+FScriptCompiler::FScriptCompiler()
+{
+	Engine = asCreateScriptEngine();
+	if (!Engine)
+	{
+		SetupError = "could not create the script engine";
+		return;
+	}
+
+	Engine->SetMessageCallback(asFUNCTION(MessageCallback), this, asCALL_CDECL);
+
+	// Unreal AngelScript passes structs by plain reference everywhere
+	Engine->SetEngineProperty(asEP_ALLOW_UNSAFE_REFERENCES, true);
+
+	RegisterTypes();
+}
+
+FScriptCompiler::~FScriptCompiler()
+{
+	if (Engine)
+		Engine->ShutDownAndRelease();
+}
+
+void FScriptCompiler::MessageCallback(const asSMessageInfo* Message, void* Param)
+{
+	FScriptCompiler* Compiler = static_cast<FScriptCompiler*>(Param);
+
+	// Information messages only name the function the next error is in
+	if (Message->type == asMSGTYPE_INFORMATION)
+		return;
+
+	if (!Compiler->Messages)
+	{
+		if (Message->type == asMSGTYPE_ERROR && Compiler->SetupError.empty())
+			Compiler->SetupError = Message->message;
+		return;
+	}
+
+	FCompileMessage Entry;
+	Entry.Section = Message->section ? Message->section : "";
+	Entry.Row = Message->row;
+	Entry.Column = Message->col;
+	Entry.bError = Message->type == asMSGTYPE_ERROR;
+	Entry.Text = Message->message;
+	Compiler->Messages->push_back(std::move(Entry));
+}
+
+bool FScriptCompiler::RegisterTypes()
+{
+	auto Check = [this](int Result, const char* What)
+	{
+		if (Result < 0 && SetupError.empty())
+			SetupError = std::string("failed to register ") + What + " (" + std::to_string(Result) + ")";
+	};
+	auto Type = [&](const char* Name, asQWORD Flags)
+	{
+		Check(Engine->RegisterObjectType(Name, sizeof(void*), asOBJ_VALUE | asOBJ_APP_CLASS_CDAK | Flags), Name);
+	};
+	auto Behaviour = [&](const char* TypeName, asEBehaviours Kind, const char* Declaration)
+	{
+		Check(Engine->RegisterObjectBehaviour(TypeName, Kind, Declaration, asFUNCTION(CompileOnlyStub), asCALL_GENERIC), Declaration);
+	};
+	auto Methods = [&](const char* TypeName, std::initializer_list<const char*> Declarations)
+	{
+		for (const char* Declaration : Declarations)
+			Check(Engine->RegisterObjectMethod(TypeName, Declaration, asFUNCTION(CompileOnlyStub), asCALL_GENERIC), Declaration);
+	};
+
+	// Declare all three first: each one's methods mention the others
+	Type("FString", 0);
+	Type("FName", 0);
+	Type("FText", 0);
+
+	Behaviour("FString", asBEHAVE_CONSTRUCT, "void f()");
+	Behaviour("FString", asBEHAVE_CONSTRUCT, "void f(const FString&in)");
+	Behaviour("FString", asBEHAVE_DESTRUCT, "void f()");
+	Methods("FString", {
+		"FString& opAssign(const FString&in)",
+		"FString& opAddAssign(const FString&in)",
+		"FString opAdd(const FString&in) const",
+		"FString opAdd(int) const",
+		"FString opAdd(float) const",
+		"bool opEquals(const FString&in) const",
+		"int opCmp(const FString&in) const",
+		"FName opImplConv() const",
+		"int Len() const",
+		"bool IsEmpty() const",
+		"bool Contains(const FString&in) const",
+		"bool StartsWith(const FString&in) const",
+		"bool EndsWith(const FString&in) const",
+		"FString ToUpper() const",
+		"FString ToLower() const",
+	});
+
+	Behaviour("FName", asBEHAVE_CONSTRUCT, "void f()");
+	Behaviour("FName", asBEHAVE_CONSTRUCT, "void f(const FName&in)");
+	Behaviour("FName", asBEHAVE_DESTRUCT, "void f()");
+	Methods("FName", {
+		"FName& opAssign(const FName&in)",
+		"bool opEquals(const FName&in) const",
+		"FString ToString() const",
+		"bool IsNone() const",
+	});
+
+	Behaviour("FText", asBEHAVE_CONSTRUCT, "void f()");
+	Behaviour("FText", asBEHAVE_CONSTRUCT, "void f(const FText&in)");
+	Behaviour("FText", asBEHAVE_CONSTRUCT, "void f(const FString&in)");
+	Behaviour("FText", asBEHAVE_DESTRUCT, "void f()");
+	Methods("FText", {
+		"FText& opAssign(const FText&in)",
+		"FString ToString() const",
+		"bool IsEmpty() const",
+	});
+
+	Check(Engine->RegisterStringFactory("FString", &StringFactory), "string factory");
+
+	// Containers are value templates; the hidden int&in is the instance's type info
+	Type("TArray<class T>", asOBJ_TEMPLATE);
+	Behaviour("TArray<T>", asBEHAVE_CONSTRUCT, "void f(int&in)");
+	Behaviour("TArray<T>", asBEHAVE_CONSTRUCT, "void f(int&in, const TArray<T>&in)");
+	Behaviour("TArray<T>", asBEHAVE_DESTRUCT, "void f()");
+	Methods("TArray<T>", {
+		"TArray<T>& opAssign(const TArray<T>&in)",
+		"T& opIndex(int)",
+		"const T& opIndex(int) const",
+		"int Num() const",
+		"bool IsEmpty() const",
+		"bool IsValidIndex(int) const",
+		"void Add(const T&in)",
+		"void AddUnique(const T&in)",
+		"void Insert(const T&in, int)",
+		"bool Contains(const T&in) const",
+		"int FindIndex(const T&in) const",
+		"void Remove(const T&in)",
+		"void RemoveAt(int)",
+		"void SetNum(int)",
+		"void Empty()",
+		"void Reset()",
+		"T& Last()",
+	});
+
+	Type("TSet<class T>", asOBJ_TEMPLATE);
+	Behaviour("TSet<T>", asBEHAVE_CONSTRUCT, "void f(int&in)");
+	Behaviour("TSet<T>", asBEHAVE_CONSTRUCT, "void f(int&in, const TSet<T>&in)");
+	Behaviour("TSet<T>", asBEHAVE_DESTRUCT, "void f()");
+	Methods("TSet<T>", {
+		"TSet<T>& opAssign(const TSet<T>&in)",
+		"int Num() const",
+		"void Add(const T&in)",
+		"bool Contains(const T&in) const",
+		"void Remove(const T&in)",
+		"void Empty()",
+	});
+
+	Type("TMap<class K, class V>", asOBJ_TEMPLATE);
+	Behaviour("TMap<K, V>", asBEHAVE_CONSTRUCT, "void f(int&in)");
+	Behaviour("TMap<K, V>", asBEHAVE_CONSTRUCT, "void f(int&in, const TMap<K, V>&in)");
+	Behaviour("TMap<K, V>", asBEHAVE_DESTRUCT, "void f()");
+	Methods("TMap<K, V>", {
+		"TMap<K, V>& opAssign(const TMap<K, V>&in)",
+		"V& opIndex(const K&in)",
+		"int Num() const",
+		"void Add(const K&in, const V&in)",
+		"bool Contains(const K&in) const",
+		"bool Find(const K&in, V&out) const",
+		"V& FindOrAdd(const K&in)",
+		"void Remove(const K&in)",
+		"void Empty()",
+	});
+
+	Type("TSubclassOf<class T>", asOBJ_TEMPLATE);
+	Behaviour("TSubclassOf<T>", asBEHAVE_CONSTRUCT, "void f(int&in)");
+	Behaviour("TSubclassOf<T>", asBEHAVE_CONSTRUCT, "void f(int&in, const TSubclassOf<T>&in)");
+	Behaviour("TSubclassOf<T>", asBEHAVE_DESTRUCT, "void f()");
+	Methods("TSubclassOf<T>", {
+		"TSubclassOf<T>& opAssign(const TSubclassOf<T>&in)",
+		"bool IsValid() const",
+	});
+
+	Check(Engine->RegisterTypedef("float32", "float"), "float32");
+	Check(Engine->RegisterTypedef("float64", "double"), "float64");
+
+	return SetupError.empty();
+}
+
+bool FScriptCompiler::Compile(const std::vector<const FScriptSection*>& Sections, std::vector<FCompileMessage>& OutMessages)
+{
+	if (!Engine || !SetupError.empty())
+		return false;
+
+	Messages = &OutMessages;
+
+	asIScriptModule* Module = Engine->GetModule("Verify", asGM_ALWAYS_CREATE);
+	for (const FScriptSection* Section : Sections)
+		Module->AddScriptSection(Section->Name.c_str(), Section->Code.data(), Section->Code.size());
+
+	const int Result = Module->Build();
+
+	// Script class types outlive the module until collected; keep the engine from growing per file
+	Module->Discard();
+	Engine->GarbageCollect();
+
+	Messages = nullptr;
+	return Result >= 0;
+}
+
+} // namespace BlueprintTools
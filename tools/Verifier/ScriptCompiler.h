@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+class asIScriptEngine;
+struct asSMessageInfo;
+
+namespace BlueprintTools
+{
+
+struct FCompileMessage
+{
+	std::string Section;
+	int Row = 0;
+	int Column = 0;
+	bool bError = true;
+	std::string Text;
+};
+
+struct FScriptSection
+{
+	std::string Name;
+	std::string Code;
+};
+
+/**
+ * One AngelScript engine with the Unreal value types and containers registered as
+ * compile-only stubs (FString, FName, FText, TArray, TSet, TMap, TSubclassOf). Nothing
+ * registered here can run; modules are built and discarded. Engines are not thread-safe,
+ * so each worker owns one.
+ */
+class FScriptCompiler
+{
+public:
+	FScriptCompiler();
+	~FScriptCompiler();
+
+	FScriptCompiler(const FScriptCompiler&) = delete;
+	FScriptCompiler& operator=(const FScriptCompiler&) = delete;
+
+	/** Empty when the engine was created and every registration succeeded */
+	const std::string& GetSetupError() const { return SetupError; }
+
+	/** Builds Sections into a throwaway module; messages from every section are returned */
+	bool Compile(const std::vector<const FScriptSection*>& Sections, std::vector<FCompileMessage>& OutMessages);
+
+private:
+	bool RegisterTypes();
+
+	static void MessageCallback(const asSMessageInfo* Message, void* Param);
+
+	asIScriptEngine* Engine = nullptr;
+	std::vector<FCompileMessage>* Messages = nullptr;
+	std::string SetupError;
+};
+
+} // namespace BlueprintTools
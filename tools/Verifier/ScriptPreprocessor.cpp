@@ -0,0 +1,320 @@
+#include "ScriptPreprocessor.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace BlueprintTools
+{
+
+enum class ETokenKind
+{
+	Identifier,
+	Number,
+	String,
+	Comment,
+	Whitespace,
+	Newline,
+	Punct
+};
+
+struct FToken
+{
+	ETokenKind Kind;
+	std::string_view Text;
+};
+
+static bool IsIdentifierStart(char C)
+{
+	return std::isalpha(static_cast<unsigned char>(C)) || C == '_';
+}
+
+static bool IsIdentifierChar(char C)
+{
+	return std::isalnum(static_cast<unsigned char>(C)) || C == '_';
+}
+
+static bool StartsWith(std::string_view Str, std::string_view Prefix)
+{
+	return Str.size() >= Prefix.size() && Str.compare(0, Prefix.size(), Prefix) == 0;
+}
+
+static void Tokenize(std::string_view Source, std::vector<FToken>& Out)
+{
+	size_t Pos = 0;
+	while (Pos < Source.size())
+	{
+		const size_t Start = Pos;
+		const char C = Source[Pos];
+		ETokenKind Kind;
+
+		if (C == '\n')
+		{
+			Kind = ETokenKind::Newline;
+			Pos++;
+		}
+		else if (C == ' ' || C == '\t' || C == '\r')
+		{
+			Kind = ETokenKind::Whitespace;
+			while (Pos < Source.size() && (Source[Pos] == ' ' || Source[Pos] == '\t' || Source[Pos] == '\r'))
+				Pos++;
+		}
+		else if (C == '/' && Pos + 1 < Source.size() && Source[Pos + 1] == '/')
+		{
+			Kind = ETokenKind::Comment;
+			while (Pos < Source.size() && Source[Pos] != '\n')
+				Pos++;
+		}
+		else if (C == '/' && Pos + 1 < Source.size() && Source[Pos + 1] == '*')
+		{
+			// Block comments keep their newlines inside the token; rows are preserved by copying it whole
+			Kind = ETokenKind::Comment;
+			const size_t Close = Source.find("*/", Pos + 2);
+			Pos = Close == std::string_view::npos ? Source.size() : Close + 2;
+		}
+		else if (C == '"' || C == '\'')
+		{
+			Kind = ETokenKind::String;
+			Pos++;
+			while (Pos < Source.size() && Source[Pos] != C && Source[Pos] != '\n')
+				Pos += Source[Pos] == '\\' ? 2 : 1;
+			Pos = std::min(Pos + 1, Source.size());
+		}
+		else if (IsIdentifierStart(C))
+		{
+			Kind = ETokenKind::Identifier;
+			while (Pos < Source.size() && IsIdentifierChar(Source[Pos]))
+				Pos++;
+		}
+		else if (std::isdigit(static_cast<unsigned char>(C)))
+		{
+			Kind = ETokenKind::Number;
+			while (Pos < Source.size() && (IsIdentifierChar(Source[Pos]) || Source[Pos] == '.'))
+				Pos++;
+		}
+		else if (C == ':' && Pos + 1 < Source.size() && Source[Pos + 1] == ':')
+		{
+			Kind = ETokenKind::Punct;
+			Pos += 2;
+		}
+		else
+		{
+			Kind = ETokenKind::Punct;
+			Pos++;
+		}
+
+		Out.push_back({Kind, Source.substr(Start, Pos - Start)});
+	}
+}
+
+static bool IsSignificant(const FToken& Token)
+{
+	return Token.Kind != ETokenKind::Whitespace && Token.Kind != ETokenKind::Newline && Token.Kind != ETokenKind::Comment;
+}
+
+bool IsUnrealTypeName(std::string_view Name)
+{
+	if (Name.size() < 3 || std::string_view("AUFE").find(Name[0]) == std::string_view::npos || !std::isupper(static_cast<unsigned char>(Name[1])))
+		return false;
+
+	for (char C : Name)
+	{
+		if (std::islower(static_cast<unsigned char>(C)))
+			return true;
+	}
+	return false;
+}
+
+bool IsObjectTypeName(std::string_view Name)
+{
+	return IsUnrealTypeName(Name) && (Name[0] == 'A' || Name[0] == 'U');
+}
+
+void ScanScript(std::string_view Source, FScriptScan& Out)
+{
+	std::vector<FToken> AllTokens;
+	Tokenize(Source, AllTokens);
+
+	std::vector<std::string_view> Tokens;
+	for (const FToken& Token : AllTokens)
+	{
+		// Strings become a placeholder so they can't be mistaken for identifiers or punctuation
+		if (Token.Kind == ETokenKind::String)
+			Tokens.push_back("\"");
+		else if (IsSignificant(Token))
+			Tokens.push_back(Token.Text);
+	}
+
+	for (size_t i = 0; i < Tokens.size(); i++)
+	{
+		const std::string_view Token = Tokens[i];
+		const std::string_view Prev = i > 0 ? Tokens[i - 1] : std::string_view();
+		const std::string_view Next = i + 1 < Tokens.size() ? Tokens[i + 1] : std::string_view();
+
+		if ((Token == "class" || Token == "struct" || Token == "enum") && !Next.empty() && IsIdentifierStart(Next[0]))
+		{
+			Out.DeclaredTypes.emplace_back(Next);
+			i++;
+			continue;
+		}
+
+		if (!IsUnrealTypeName(Token) || Prev == "." || Prev == "::")
+			continue;
+
+		if (Next == "::" && i + 2 < Tokens.size() && Token[0] == 'E' && IsIdentifierStart(Tokens[i + 2][0]))
+		{
+			Out.ReferencedTypes.emplace(Token);
+			Out.EnumValues[std::string(Token)].emplace(Tokens[i + 2]);
+			continue;
+		}
+
+		// Followed by these it is a variable or member being used, not a type
+		if (Next == "." || Next == "=" || Next == ";" || Next == ")")
+			continue;
+
+		Out.ReferencedTypes.emplace(Token);
+	}
+}
+
+/** Length of a leading UPROPERTY(...)-style macro including its arguments, 0 if there is none or it doesn't close on this line */
+static size_t GetSpecifierMacroLength(std::string_view Line)
+{
+	static const std::string_view Macros[] = { "UPROPERTY", "UFUNCTION", "UCLASS", "USTRUCT", "UENUM" };
+
+	for (std::string_view Macro : Macros)
+	{
+		if (!StartsWith(Line, Macro))
+			continue;
+
+		size_t Pos = Macro.size();
+		while (Pos < Line.size() && (Line[Pos] == ' ' || Line[Pos] == '\t'))
+			Pos++;
+		if (Pos >= Line.size() || Line[Pos] != '(')
+			return 0;
+
+		int Depth = 0;
+		for (; Pos < Line.size(); Pos++)
+		{
+			if (Line[Pos] == '(')
+				Depth++;
+			else if (Line[Pos] == ')' && --Depth == 0)
+				return Pos + 1;
+		}
+		return 0;
+	}
+	return 0;
+}
+
+static std::string RewriteLine(std::string_view Line, size_t Row)
+{
+	const size_t IndentLength = Line.find_first_not_of(" \t");
+	if (IndentLength == std::string_view::npos)
+		return std::string(Line);
+
+	const std::string_view Indent = Line.substr(0, IndentLength);
+	std::string_view Body = Line.substr(IndentLength);
+
+	if (const size_t MacroLength = GetSpecifierMacroLength(Body))
+	{
+		Body.remove_prefix(MacroLength);
+		const size_t Rest = Body.find_first_not_of(" \t");
+		Body = Rest == std::string_view::npos ? std::string_view() : Body.substr(Rest);
+	}
+
+	if (StartsWith(Body, "default "))
+	{
+		std::string_view Statement = Body.substr(8);
+		while (!Statement.empty() && (Statement.back() == '\r' || Statement.back() == ' ' || Statement.back() == '\t'))
+			Statement.remove_suffix(1);
+		return std::string(Indent) + "void __Default_" + std::to_string(Row) + "() { " + std::string(Statement) + " }";
+	}
+
+	if (StartsWith(Body, "struct ") || StartsWith(Body, "struct\t"))
+		return std::string(Indent) + "class" + std::string(Body.substr(6));
+
+	if (StartsWith(Body, "};"))
+		return std::string(Indent) + "}" + std::string(Body.substr(2));
+
+	return std::string(Indent) + std::string(Body);
+}
+
+std::string PreprocessScript(std::string_view Source, const std::unordered_set<std::string>& HandleTypes)
+{
+	std::string Lines;
+	Lines.reserve(Source.size() + Source.size() / 8);
+
+	size_t Row = 1;
+	size_t LineStart = 0;
+	while (LineStart <= Source.size())
+	{
+		const size_t LineEnd = Source.find('\n', LineStart);
+		const std::string_view Line = Source.substr(LineStart, LineEnd == std::string_view::npos ? std::string_view::npos : LineEnd - LineStart);
+
+		Lines += RewriteLine(Line, Row++);
+		if (LineEnd == std::string_view::npos)
+			break;
+		Lines += '\n';
+		LineStart = LineEnd + 1;
+	}
+
+	std::vector<FToken> Tokens;
+	Tokenize(Lines, Tokens);
+
+	std::string Result;
+	Result.reserve(Lines.size() + Lines.size() / 16);
+
+	std::string_view PrevSignificant;
+	for (size_t i = 0; i < Tokens.size(); i++)
+	{
+		const FToken& Token = Tokens[i];
+		if (Token.Kind != ETokenKind::Identifier)
+		{
+			Result += Token.Text;
+			if (IsSignificant(Token))
+				PrevSignificant = Token.Text;
+			continue;
+		}
+
+		auto NextIndex = [&Tokens](size_t From, bool bSkipNewlines)
+		{
+			size_t Index = From + 1;
+			while (Index < Tokens.size() && (Tokens[Index].Kind == ETokenKind::Whitespace || (bSkipNewlines && !IsSignificant(Tokens[Index]))))
+				Index++;
+			return Index;
+		};
+
+		const std::string_view Name = Token.Text;
+
+		if (Name == "nullptr")
+			Result += "null";
+		else if (Name == "n" && i + 1 < Tokens.size() && Tokens[i + 1].Kind == ETokenKind::String)
+		{
+			// n"Name" literal: the FName is built from the string by the registered conversion
+		}
+		else if (Name == "FText" && NextIndex(i, true) < Tokens.size() && Tokens[NextIndex(i, true)].Text == "::"
+			&& NextIndex(NextIndex(i, true), true) < Tokens.size() && Tokens[NextIndex(NextIndex(i, true), true)].Text == "FromString")
+		{
+			Result += "FText";
+			i = NextIndex(NextIndex(i, true), true);
+		}
+		else if (HandleTypes.count(std::string(Name)) && PrevSignificant != "class" && PrevSignificant != "::")
+		{
+			Result += Name;
+
+			const size_t Next = NextIndex(i, false);
+			if (Next < Tokens.size())
+			{
+				const FToken& NextToken = Tokens[Next];
+				if (NextToken.Kind == ETokenKind::Identifier || NextToken.Text == ">" || NextToken.Text == "&")
+					Result += '@';
+			}
+		}
+		else
+			Result += Name;
+
+		PrevSignificant = Name;
+	}
+
+	return Result;
+}
+
+} // namespace BlueprintTools
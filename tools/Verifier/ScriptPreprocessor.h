@@ -0,0 +1,51 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace BlueprintTools
+{
+
+/** AFoo, UFoo, FFoo, EFoo; all-caps names are macros or acronyms, not types */
+bool IsUnrealTypeName(std::string_view Name);
+
+/** AFoo and UFoo: classes, which Unreal AngelScript always passes by handle */
+bool IsObjectTypeName(std::string_view Name);
+
+/** Type names a script declares and the ones it uses, gathered before any stubs exist. */
+struct FScriptScan
+{
+	std::vector<std::string> DeclaredTypes;
+
+	/** Identifiers in type positions that look like Unreal types (AFoo, UFoo, FFoo, EFoo) */
+	std::unordered_set<std::string> ReferencedTypes;
+
+	/** EFoo::Bar references, so enums that only exist natively get stub values */
+	std::unordered_map<std::string, std::set<std::string>> EnumValues;
+};
+
+void ScanScript(std::string_view Source, FScriptScan& Out);
+
+/**
+ * Rewrites Unreal AngelScript into plain AngelScript that a stock engine compiles, keeping every
+ * line on its original row so compiler messages point at the generated file:
+ *
+ *   UPROPERTY(...) / UFUNCTION(...) / UCLASS(...)   removed
+ *   default X.Y = V;                                void __Default_<row>() { X.Y = V; }
+ *   struct FFoo                                     class FFoo
+ *   };                                              }
+ *   n"Name"                                         "Name"
+ *   FText::FromString(...)                          FText(...)
+ *   nullptr                                         null
+ *   UFoo Name / TArray<UFoo> / UFoo&                UFoo@ Name / TArray<UFoo@> / UFoo@&
+ *
+ * The last rule makes object types handles, which Unreal AngelScript does implicitly; it
+ * applies to every name in HandleTypes.
+ */
+std::string PreprocessScript(std::string_view Source, const std::unordered_set<std::string>& HandleTypes);
+
+} // namespace BlueprintTools
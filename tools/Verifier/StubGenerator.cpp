@@ -0,0 +1,365 @@
+#include "StubGenerator.h"
+
+#include "AngelScriptConverter.h"
+
+#include <cctype>
+#include <climits>
+#include <vector>
+
+namespace BlueprintTools
+{
+
+/** Value types the compiler registers natively; never stubbed */
+static bool IsRegisteredType(const std::string& Name)
+{
+	return Name == "FString" || Name == "FName" || Name == "FText";
+}
+
+static bool EndsWith(const std::string& Str, const char* Suffix)
+{
+	const size_t Length = std::char_traits<char>::length(Suffix);
+	return Str.size() >= Length && Str.compare(Str.size() - Length, Length, Suffix) == 0;
+}
+
+static bool IsIdentifier(const std::string& Name)
+{
+	if (Name.empty() || !(std::isalpha(static_cast<unsigned char>(Name[0])) || Name[0] == '_'))
+		return false;
+	for (char C : Name)
+	{
+		if (!std::isalnum(static_cast<unsigned char>(C)) && C != '_')
+			return false;
+	}
+	return true;
+}
+
+/** Health_2_0123456789ABCDEF0123456789ABCDEF -> Health, matching the converter's field names */
+static std::string StripMemberGuid(std::string_view Name)
+{
+	const size_t GuidStart = Name.rfind('_');
+	if (GuidStart == std::string_view::npos || Name.size() - GuidStart - 1 != 32)
+		return std::string(Name);
+
+	const size_t IndexStart = Name.rfind('_', GuidStart - 1);
+	if (IndexStart == std::string_view::npos)
+		return std::string(Name);
+	return std::string(Name.substr(0, IndexStart));
+}
+
+static std::string ToIdentifier(std::string_view Name)
+{
+	std::string Result;
+	for (char C : Name)
+		Result += std::isalnum(static_cast<unsigned char>(C)) ? C : '_';
+	if (!Result.empty() && std::isdigit(static_cast<unsigned char>(Result[0])))
+		Result.insert(Result.begin(), '_');
+	return Result;
+}
+
+/** Where a native class sits when nothing says otherwise; close enough for member lookup */
+static std::string GetDefaultBase(const std::string& Name)
+{
+	if (Name == "UObject")
+		return std::string();
+	if (Name == "AActor" || Name == "UActorComponent")
+		return "UObject";
+	if (Name[0] == 'A')
+		return "AActor";
+	if (Name == "USceneComponent")
+		return "UActorComponent";
+	if (EndsWith(Name, "Component"))
+		return "USceneComponent";
+	return "UObject";
+}
+
+FStubCatalogue::FStubCatalogue()
+{
+	// Math structs the converter writes constructor literals for
+	struct FBuiltinStruct
+	{
+		const char* Name;
+		const char* MemberType;
+		std::vector<const char*> Members;
+	};
+
+	static const FBuiltinStruct Builtins[] =
+	{
+		{ "FVector", "float", { "X", "Y", "Z" } },
+		{ "FVector2D", "float", { "X", "Y" } },
+		{ "FRotator", "float", { "Pitch", "Yaw", "Roll" } },
+		{ "FQuat", "float", { "X", "Y", "Z", "W" } },
+		{ "FLinearColor", "float", { "R", "G", "B", "A" } },
+		{ "FIntPoint", "int", { "X", "Y" } },
+		{ "FColor", "uint8", { "R", "G", "B", "A" } },
+	};
+
+	for (const FBuiltinStruct& Builtin : Builtins)
+	{
+		FStub& Stub = FindOrAddStub(Builtin.Name);
+		std::string Parameters;
+		for (const char* Member : Builtin.Members)
+		{
+			Stub.Members[Member] = Builtin.MemberType;
+			Parameters += std::string(Parameters.empty() ? "" : ", ") + Builtin.MemberType + " In" + Member;
+		}
+		Stub.ExtraSource = "\t" + std::string(Builtin.Name) + "() {}\n\t" + Builtin.Name + "(" + Parameters + ") {}\n";
+	}
+
+	FStub& Transform = FindOrAddStub("FTransform");
+	Transform.Members["Rotation"] = "FQuat";
+	Transform.Members["Translation"] = "FVector";
+	Transform.Members["Scale3D"] = "FVector";
+	Transform.ExtraSource = "\tFTransform() {}\n\tFTransform(const FQuat&in InRotation, const FVector&in InTranslation, const FVector&in InScale3D) {}\n";
+}
+
+FStubCatalogue::FStub& FStubCatalogue::FindOrAddStub(const std::string& Name)
+{
+	auto It = Stubs.find(Name);
+	if (It != Stubs.end())
+		return It->second;
+
+	FStub& Stub = Stubs[Name];
+	if (Name[0] == 'E')
+		Stub.Kind = EStubKind::Enum;
+	else if (Name[0] == 'F')
+		Stub.Kind = EStubKind::Struct;
+	else
+	{
+		Stub.Base = GetDefaultBase(Name);
+		if (!Stub.Base.empty())
+			FindOrAddStub(Stub.Base);
+	}
+	return Stub;
+}
+
+void FStubCatalogue::AddMember(const std::string& TypeName, const std::string& MemberName, const std::string& MemberType)
+{
+	if (TypeName.empty() || !IsUnrealTypeName(TypeName) || IsRegisteredType(TypeName) || MemberType.empty() || !IsIdentifier(MemberName))
+		return;
+
+	FStub& Stub = FindOrAddStub(TypeName);
+	if (Stub.Kind != EStubKind::Enum)
+		Stub.Members.emplace(MemberName, MemberType);
+}
+
+void FStubCatalogue::AddExport(const FJsonNode& Root)
+{
+	switch (GetExportKind(Root))
+	{
+	case EExportKind::Blueprint:
+	{
+		const std::string_view Name = Root.GetString("name");
+		const std::string Parent = GetScriptTypeName(Root.GetString("parent_class", "Object"));
+		const bool bActor = Name.substr(0, 2) != "W_" && !Parent.empty() && Parent[0] == 'A';
+
+		FBlueprintInfo& Info = Blueprints[GetScriptClassName(Name, bActor)];
+		Info.Parent = Parent;
+
+		for (const FJsonNode& Variable : Root.GetArray("variables"))
+			Info.OwnMembers.emplace(Variable.GetString("name"));
+
+		for (const FJsonNode& Default : Root.GetArray("class_defaults"))
+		{
+			if (!Default.GetBool("is_blueprint_reference"))
+				Info.Defaults.emplace(Default.GetString("name"), GetScriptTypeName(Default.GetString("type"), false, Default.Find("struct_source") != nullptr));
+		}
+
+		for (const FJsonNode& Component : Root.GetArray("components"))
+		{
+			Info.OwnMembers.emplace(Component.GetString("name"));
+
+			const std::string ComponentType = GetScriptTypeName(Component.GetString("type"));
+			for (const FJsonNode& Property : Component.GetArray("properties"))
+			{
+				if (!Property.GetBool("is_blueprint_reference"))
+					AddMember(ComponentType, std::string(Property.GetString("name")), GetScriptTypeName(Property.GetString("type"), false, Property.Find("struct_source") != nullptr));
+			}
+		}
+		break;
+	}
+
+	case EExportKind::Struct:
+	{
+		const std::string StructName = GetScriptStructName(Root.GetString("name"));
+		FindOrAddStub(StructName);
+		for (const FJsonNode& Field : Root.GetArray("fields"))
+			AddMember(StructName, StripMemberGuid(Field.GetString("name")), GetScriptTypeName(Field.GetString("type"), false, Field.Find("struct_source") != nullptr));
+		break;
+	}
+
+	case EExportKind::Enum:
+	{
+		FStub& Stub = FindOrAddStub(GetScriptEnumName(Root.GetString("name")));
+		for (const FJsonNode& Entry : Root.GetArray("values"))
+		{
+			std::string_view EntryName = Entry.GetString("display_name");
+			if (EntryName.empty())
+			{
+				EntryName = Entry.GetString("name");
+				const size_t Scope = EntryName.rfind("::");
+				if (Scope != std::string_view::npos)
+					EntryName = EntryName.substr(Scope + 2);
+			}
+			Stub.Values[ToIdentifier(EntryName)] = Entry.Find("value") ? static_cast<long long>(Entry.GetNumber("value")) : LLONG_MIN;
+		}
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+void FStubCatalogue::AddScriptScan(const FScriptScan& Scan)
+{
+	for (const std::string& Name : Scan.ReferencedTypes)
+	{
+		if (!IsRegisteredType(Name))
+			FindOrAddStub(Name);
+	}
+
+	for (const auto& Entry : Scan.EnumValues)
+	{
+		FStub& Stub = FindOrAddStub(Entry.first);
+		for (const std::string& Value : Entry.second)
+			Stub.Values.emplace(Value, LLONG_MIN);
+	}
+}
+
+bool FStubCatalogue::HasInheritedMember(const FStub& Stub, const std::string& MemberName) const
+{
+	std::string Base = Stub.Base;
+	for (int Depth = 0; !Base.empty() && Depth < 64; Depth++)
+	{
+		auto It = Stubs.find(Base);
+		if (It == Stubs.end())
+			return false;
+		if (It->second.Members.count(MemberName))
+			return true;
+		Base = It->second.Base;
+	}
+	return false;
+}
+
+void FStubCatalogue::Finalize(const std::unordered_set<std::string>& ScriptTypes)
+{
+	// Blueprint class defaults are inherited native properties; hang them on the native root
+	for (const auto& Entry : Blueprints)
+	{
+		std::unordered_set<std::string> ChainMembers = Entry.second.OwnMembers;
+		std::string Root = Entry.second.Parent;
+		for (int Depth = 0; Depth < 64; Depth++)
+		{
+			auto It = Blueprints.find(Root);
+			if (It == Blueprints.end())
+				break;
+			ChainMembers.insert(It->second.OwnMembers.begin(), It->second.OwnMembers.end());
+			Root = It->second.Parent;
+		}
+
+		if (ScriptTypes.count(Root))
+			continue;
+
+		for (const auto& Default : Entry.second.Defaults)
+		{
+			if (!ChainMembers.count(Default.first))
+				AddMember(Root, Default.first, Default.second);
+		}
+	}
+
+	// Member types need declarations of their own
+	std::vector<std::string> MemberTypes;
+	for (const auto& Entry : Stubs)
+	{
+		for (const auto& Member : Entry.second.Members)
+		{
+			const std::string& Type = Member.second;
+			for (size_t Pos = 0; Pos < Type.size();)
+			{
+				size_t End = Pos;
+				while (End < Type.size() && (std::isalnum(static_cast<unsigned char>(Type[End])) || Type[End] == '_'))
+					End++;
+				if (End > Pos)
+					MemberTypes.push_back(Type.substr(Pos, End - Pos));
+				Pos = End + 1;
+			}
+		}
+	}
+	for (const std::string& Type : MemberTypes)
+	{
+		if (IsUnrealTypeName(Type) && !IsRegisteredType(Type))
+			FindOrAddStub(Type);
+	}
+
+	for (const std::string& Name : ScriptTypes)
+		Stubs.erase(Name);
+
+	// Blueprints referenced but not converted in this run still know their real parent
+	for (auto& Entry : Stubs)
+	{
+		auto It = Blueprints.find(Entry.first);
+		if (It != Blueprints.end() && !It->second.Parent.empty() && (Stubs.count(It->second.Parent) || ScriptTypes.count(It->second.Parent)))
+			Entry.second.Base = It->second.Parent;
+	}
+
+	for (auto& Entry : Stubs)
+	{
+		FStub& Stub = Entry.second;
+		if (!Stub.Base.empty() && !Stubs.count(Stub.Base) && !ScriptTypes.count(Stub.Base))
+			Stub.Base.clear();
+
+		for (auto It = Stub.Members.begin(); It != Stub.Members.end();)
+			It = HasInheritedMember(Stub, It->first) ? Stub.Members.erase(It) : std::next(It);
+	}
+}
+
+void FStubCatalogue::GetObjectTypes(std::unordered_set<std::string>& Out) const
+{
+	for (const auto& Entry : Stubs)
+	{
+		if (Entry.second.Kind == EStubKind::Class)
+			Out.insert(Entry.first);
+	}
+}
+
+std::string FStubCatalogue::GenerateSource() const
+{
+	std::string Source = "// Stub declarations generated by bp_asverify\n";
+
+	for (const auto& Entry : Stubs)
+	{
+		const FStub& Stub = Entry.second;
+		Source += "\n";
+
+		if (Stub.Kind == EStubKind::Enum)
+		{
+			Source += "enum " + Entry.first + "\n{\n";
+			if (Stub.Values.empty())
+				Source += "\tUnknown\n";
+
+			size_t Index = 0;
+			for (const auto& Value : Stub.Values)
+			{
+				Source += "\t" + Value.first;
+				if (Value.second != LLONG_MIN)
+					Source += " = " + std::to_string(Value.second);
+				Source += ++Index < Stub.Values.size() ? ",\n" : "\n";
+			}
+			Source += "};\n";
+			continue;
+		}
+
+		Source += (Stub.Kind == EStubKind::Struct ? "struct " : "class ") + Entry.first;
+		if (!Stub.Base.empty())
+			Source += " : " + Stub.Base;
+		Source += "\n{\n";
+		for (const auto& Member : Stub.Members)
+			Source += "\t" + Member.second + " " + Member.first + ";\n";
+		Source += Stub.ExtraSource;
+		Source += "};\n";
+	}
+
+	return Source;
+}
+
+} // namespace BlueprintTools
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Json.h"
+#include "ScriptPreprocessor.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace BlueprintTools
+{
+
+/**
+ * Declarations for everything generated scripts use but don't define: native parent classes,
+ * component classes, native structs and enums. Built from two sources:
+ *
+ *   - Exporter JSON: class_defaults land on the native class at the root of each Blueprint's
+ *     parent chain, component properties on the component class, /export-struct fields and
+ *     /export-enum values on their types (used when the converted file isn't part of the run).
+ *   - Script scans: any other referenced AFoo/UFoo/FFoo/EFoo becomes an empty stub, and enums
+ *     get every EFoo::Bar value the scripts mention.
+ *
+ * Members are only as complete as the exports: a hand-written script calling native functions
+ * still reports them as missing.
+ */
+class FStubCatalogue
+{
+public:
+	FStubCatalogue();
+
+	void AddExport(const FJsonNode& Root);
+
+	void AddScriptScan(const FScriptScan& Scan);
+
+	/**
+	 * Resolves Blueprint defaults onto native classes, drops stubs the scripts declare themselves
+	 * and adds stubs for types the members reference. Call once, after all Add* calls.
+	 */
+	void Finalize(const std::unordered_set<std::string>& ScriptTypes);
+
+	/** Object type names among the stubs; these are passed by handle */
+	void GetObjectTypes(std::unordered_set<std::string>& Out) const;
+
+	/** Unreal AngelScript source declaring every stub, ready for PreprocessScript */
+	std::string GenerateSource() const;
+
+private:
+	enum class EStubKind
+	{
+		Class,
+		Struct,
+		Enum
+	};
+
+	struct FStub
+	{
+		EStubKind Kind = EStubKind::Class;
+		std::string Base;
+
+		/** Member name -> script type */
+		std::map<std::string, std::string> Members;
+
+		/** Enum values, with explicit numbers where the export has them */
+		std::map<std::string, long long> Values;
+
+		/** Verbatim declarations for built-in math structs (constructors) */
+		std::string ExtraSource;
+	};
+
+	struct FBlueprintInfo
+	{
+		std::string Parent;
+		std::unordered_set<std::string> OwnMembers;
+		std::map<std::string, std::string> Defaults;
+	};
+
+	FStub& FindOrAddStub(const std::string& Name);
+	void AddMember(const std::string& TypeName, const std::string& MemberName, const std::string& MemberType);
+	bool HasInheritedMember(const FStub& Stub, const std::string& MemberName) const;
+
+	std::map<std::string, FStub> Stubs;
+	std::unordered_map<std::string, FBlueprintInfo> Blueprints;
+};
+
+} // namespace BlueprintTools